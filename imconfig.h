@@ -47,6 +47,8 @@
 //#define IMGUI_DISABLE_DEFAULT_MATH_FUNCTIONS              // Don't implement ImFabs/ImSqrt/ImPow/ImFmod/ImCos/ImSin/ImAcos/ImAtan2 so you can implement them yourself.
 //#define IMGUI_DISABLE_FILE_FUNCTIONS                      // Don't implement ImFileOpen/ImFileClose/ImFileRead/ImFileWrite and ImFileHandle at all (replace them with dummies)
 //#define IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS              // Don't implement ImFileOpen/ImFileClose/ImFileRead/ImFileWrite and ImFileHandle so you can implement them yourself if you don't want to link with fopen/fclose/fread/fwrite. This will also disable the LogToTTY() function.
+//#define IMGUI_DISABLE_DEFAULT_FILE_MAPPING_FUNCTIONS      // Don't use mmap()/MapViewOfFile() in ImFileMapOpen(), load the whole file with ImFileLoadToMemory() instead.
+//#define IMGUI_DISABLE_DEFAULT_TIME_FUNCTIONS              // Don't implement ImTimeGetSeconds() with QueryPerformanceCounter()/clock_gettime(). Timings in Metrics/Debugger window will show as 0.
 //#define IMGUI_DISABLE_DEFAULT_ALLOCATORS                  // Don't implement default allocators calling malloc()/free() to avoid linking with them. You will need to call ImGui::SetAllocatorFunctions().
 //#define IMGUI_DISABLE_DEFAULT_FONT                        // Disable default embedded font (ProggyClean.ttf), remove ~9.5 KB from output binary. AddFontDefault() will assert.
 //#define IMGUI_DISABLE_SSE                                 // Disable use of SSE intrinsics even if available
@@ -118,6 +120,19 @@
 // Read about ImGuiBackendFlags_RendererHasVtxOffset for details.
 //#define ImDrawIdx unsigned int
 
+//---- Override ImDrawVert layout to match your renderer's native vertex format, so vertex buffers can be uploaded without conversion.
+// ImDrawList only writes 'pos', 'uv' and 'col'. Use IMGUI_OVERRIDE_DRAWVERT_STRUCT_INIT() to initialize other fields of every vertex reserved by ImDrawList::PrimReserve().
+// e.g. native layout for imgui_impl_dx9.cpp (upload becomes a single memcpy() per draw list):
+//#define IMGUI_USE_BGRA_PACKED_COLOR
+//#define IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT     struct ImDrawVert { ImVec2 pos; float z; ImU32 col; ImVec2 uv; }
+//#define IMGUI_OVERRIDE_DRAWVERT_STRUCT_INIT(_VTX) (_VTX)->z = 0.0f
+
+//---- Use packed 12 bytes ImDrawVert instead of 20 bytes, to reduce memory and upload bandwidth of vertex heavy contents (e.g. large logs, plots).
+// Positions are 12.4 fixed-point relative to ImDrawList::VtxPosOrigin (+/-2048 pixels around the center of the list's first clipping rectangle, 1/16th pixel precision).
+// UVs are 16-bit normalized (texture coordinates outside of 0..1 are clamped). Your renderer backend needs to decode them, see ImDrawVert in imgui.h.
+// Cannot be used with IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT.
+//#define IMGUI_USE_PACKED_DRAWVERT
+
 //---- Override ImDrawCallback signature (will need to modify renderer backends accordingly)
 //struct ImDrawList;
 //struct ImDrawCmd;
@@ -1171,6 +1171,7 @@ IMPLEMENTING SUPPORT for ImGuiBackendFlags_RendererHasTextures:
 #define IMGUI_DISABLE_WIN32_DEFAULT_CLIPBOARD_FUNCTIONS
 #define IMGUI_DISABLE_WIN32_DEFAULT_IME_FUNCTIONS
 #define IMGUI_DISABLE_DEFAULT_SHELL_FUNCTIONS
+#define IMGUI_DISABLE_DEFAULT_FILE_MAPPING_FUNCTIONS
 #endif
 #endif
 
@@ -1241,6 +1242,9 @@ static const float NAV_ACTIVATE_HIGHLIGHT_TIMER             = 0.10f;    // Time
 static const float WINDOWS_RESIZE_FROM_EDGES_FEEDBACK_TIMER = 0.04f;    // Reduce visual noise by only highlighting the border after a certain time.
 static const float WINDOWS_MOUSE_WHEEL_SCROLL_LOCK_TIMER    = 0.70f;    // Lock scrolled window (so it doesn't pick child windows that are scrolling through) for a certain time, unless mouse moved.
 
+// Text layouts cache: above this number of entries, we evict those which haven't been used during last frame.
+static const int TEXT_LAYOUTS_COUNT_SOFT_MAX = 256;
+
 // Tooltip offset
 static const ImVec2 TOOLTIP_DEFAULT_OFFSET_MOUSE = ImVec2(16, 10);      // Multiplied by g.Style.MouseCursorScale
 static const ImVec2 TOOLTIP_DEFAULT_OFFSET_TOUCH = ImVec2(0, -20);      // Multiplied by g.Style.MouseCursorScale
@@ -1320,6 +1324,9 @@ static void             UpdateFontsNewFrame();
 static void             UpdateFontsEndFrame();
 static void             UpdateTexturesNewFrame();
 static void             UpdateTexturesEndFrame();
+static void             UpdateTexturesRender();
+static ImGuiID          TextLayoutGetSeed(ImFont* font, float font_size, float wrap_width);
+static ImU64            TextLayoutHashText(const char* text, int text_len, ImGuiID seed);
 static void             UpdateSettings();
 static int              UpdateWindowManualResize(ImGuiWindow* window, const ImVec2& size_auto_fit, int* border_hovered, int* border_held, int resize_grip_count, ImU32 resize_grip_col[4], const ImRect& visibility_rect);
 static void             RenderWindowOuterBorders(ImGuiWindow* window);
@@ -2464,6 +2471,199 @@ void*   ImFileLoadToMemory(const char* filename, const char* mode, size_t* out_f
     return file_data;
 }
 
+// Helpers: File Mapping
+#ifndef IMGUI_DISABLE_FILE_FUNCTIONS
+
+#ifndef IMGUI_DISABLE_DEFAULT_FILE_MAPPING_FUNCTIONS
+#if defined(IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS) || defined(__3DS__) || defined(__EMSCRIPTEN__)
+#define IMGUI_DISABLE_DEFAULT_FILE_MAPPING_FUNCTIONS
+#endif
+#if defined(_WIN32) && defined(IMGUI_DISABLE_WIN32_FUNCTIONS)
+#define IMGUI_DISABLE_DEFAULT_FILE_MAPPING_FUNCTIONS
+#endif
+#endif // #ifndef IMGUI_DISABLE_DEFAULT_FILE_MAPPING_FUNCTIONS
+
+#if !defined(IMGUI_DISABLE_DEFAULT_FILE_MAPPING_FUNCTIONS) && !defined(_WIN32)
+#include <fcntl.h>      // open()
+#include <sys/mman.h>   // mmap(), munmap()
+#include <sys/stat.h>   // fstat()
+#include <unistd.h>     // close()
+#endif
+
+static void ImFileMapUnmap(ImFileMapping* map)
+{
+#if defined(IMGUI_DISABLE_DEFAULT_FILE_MAPPING_FUNCTIONS)
+    IM_FREE(map->PlatformMapping);
+#elif defined(_WIN32)
+    if (map->Data)
+        ::UnmapViewOfFile(map->Data);
+    if (map->PlatformMapping)
+        ::CloseHandle((HANDLE)map->PlatformMapping);
+#else
+    if (map->Data)
+        ::munmap((void*)map->Data, (size_t)map->Size);
+#endif
+    map->Data = NULL;
+    map->Size = 0;
+    map->PlatformMapping = NULL;
+}
+
+// Map the first 'size' bytes of the already opened file. Size 0 is valid and leaves Data == NULL.
+static bool ImFileMapRemap(ImFileMapping* map, ImU64 size)
+{
+    ImFileMapUnmap(map);
+    if (size == 0)
+        return true;
+    if ((ImU64)(size_t)size != size) // Doesn't fit in address space
+        return false;
+#if defined(IMGUI_DISABLE_DEFAULT_FILE_MAPPING_FUNCTIONS)
+    size_t file_size = 0;
+    map->PlatformMapping = ImFileLoadToMemory(map->Filename, "rb", &file_size);
+    if (map->PlatformMapping == NULL)
+        return false;
+    map->Data = (const char*)map->PlatformMapping;
+    map->Size = (ImU64)file_size;
+#elif defined(_WIN32)
+    HANDLE mapping = ::CreateFileMappingW((HANDLE)(intptr_t)map->PlatformFile, NULL, PAGE_READONLY, (DWORD)(size >> 32), (DWORD)(size & 0xFFFFFFFF), NULL);
+    if (mapping == NULL)
+        return false;
+    const void* data = ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, (SIZE_T)size);
+    if (data == NULL)
+    {
+        ::CloseHandle(mapping);
+        return false;
+    }
+    map->PlatformMapping = (void*)mapping;
+    map->Data = (const char*)data;
+    map->Size = size;
+#else
+    void* data = ::mmap(NULL, (size_t)size, PROT_READ, MAP_SHARED, (int)map->PlatformFile, 0);
+    if (data == MAP_FAILED)
+        return false;
+    map->Data = (const char*)data;
+    map->Size = size;
+#endif
+    return true;
+}
+
+// Return current size of the file, or (ImU64)-1 on error.
+static ImU64 ImFileMapGetFileSize(ImFileMapping* map)
+{
+#if defined(IMGUI_DISABLE_DEFAULT_FILE_MAPPING_FUNCTIONS)
+    ImFileHandle f = ImFileOpen(map->Filename, "rb");
+    if (f == NULL)
+        return (ImU64)-1;
+    ImU64 size = ImFileGetSize(f);
+    ImFileClose(f);
+    return size;
+#elif defined(_WIN32)
+    LARGE_INTEGER size;
+    return ::GetFileSizeEx((HANDLE)(intptr_t)map->PlatformFile, &size) ? (ImU64)size.QuadPart : (ImU64)-1;
+#else
+    struct stat st;
+    return (::fstat((int)map->PlatformFile, &st) == 0) ? (ImU64)st.st_size : (ImU64)-1;
+#endif
+}
+
+bool ImFileMapOpen(ImFileMapping* map, const char* filename)
+{
+    IM_ASSERT(map != NULL && filename != NULL);
+    IM_ASSERT(map->Filename == NULL && "Call ImFileMapClose() first!");
+    map->Filename = ImStrdup(filename);
+#if defined(IMGUI_DISABLE_DEFAULT_FILE_MAPPING_FUNCTIONS)
+    // No file handle kept open: ImFileMapGetFileSize() reopens the file.
+#elif defined(_WIN32)
+    // Allow other processes to keep writing to the file (e.g. a log being appended to).
+    const int filename_wsize = ::MultiByteToWideChar(CP_UTF8, 0, filename, -1, NULL, 0);
+    ImVector<wchar_t> filename_wbuf;
+    filename_wbuf.resize(filename_wsize);
+    ::MultiByteToWideChar(CP_UTF8, 0, filename, -1, filename_wbuf.Data, filename_wsize);
+    HANDLE file = ::CreateFileW(filename_wbuf.Data, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    map->PlatformFile = (ImS64)(intptr_t)file; // INVALID_HANDLE_VALUE == -1
+#else
+    map->PlatformFile = (ImS64)::open(filename, O_RDONLY);
+#endif
+#if !defined(IMGUI_DISABLE_DEFAULT_FILE_MAPPING_FUNCTIONS)
+    if (map->PlatformFile == -1)
+    {
+        ImFileMapClose(map);
+        return false;
+    }
+#endif
+    ImU64 size = ImFileMapGetFileSize(map);
+    if (size == (ImU64)-1 || !ImFileMapRemap(map, size))
+    {
+        ImFileMapClose(map);
+        return false;
+    }
+    return true;
+}
+
+// When the file shrunk, only release the mapping: the caller must drop pointers into previous Data before the next call maps it again.
+ImFileMapUpdateResult ImFileMapUpdate(ImFileMapping* map)
+{
+    if (map->Filename == NULL)
+        return ImFileMapUpdateResult_Unchanged;
+    ImU64 size = ImFileMapGetFileSize(map);
+    if (size == (ImU64)-1 || size == map->Size)
+        return ImFileMapUpdateResult_Unchanged;
+    if (size < map->Size)
+    {
+        ImFileMapUnmap(map);
+        return ImFileMapUpdateResult_Truncated;
+    }
+    if (!ImFileMapRemap(map, size)) // On failure this leaves an empty mapping
+        return ImFileMapUpdateResult_Truncated;
+    return ImFileMapUpdateResult_Grown;
+}
+
+void ImFileMapClose(ImFileMapping* map)
+{
+    ImFileMapUnmap(map);
+#if defined(IMGUI_DISABLE_DEFAULT_FILE_MAPPING_FUNCTIONS)
+#elif defined(_WIN32)
+    if (map->PlatformFile != -1)
+        ::CloseHandle((HANDLE)(intptr_t)map->PlatformFile);
+#else
+    if (map->PlatformFile != -1)
+        ::close((int)map->PlatformFile);
+#endif
+    map->PlatformFile = -1;
+    IM_FREE(map->Filename);
+    map->Filename = NULL;
+}
+
+#endif // #ifndef IMGUI_DISABLE_FILE_FUNCTIONS
+
+// Helpers: Time
+#ifndef IMGUI_DISABLE_DEFAULT_TIME_FUNCTIONS
+#if defined(_WIN32) && defined(IMGUI_DISABLE_WIN32_FUNCTIONS)
+#define IMGUI_DISABLE_DEFAULT_TIME_FUNCTIONS
+#endif
+#endif
+#if !defined(IMGUI_DISABLE_DEFAULT_TIME_FUNCTIONS) && !defined(_WIN32)
+#include <time.h>       // clock_gettime()
+#endif
+
+double ImTimeGetSeconds()
+{
+#if defined(IMGUI_DISABLE_DEFAULT_TIME_FUNCTIONS)
+    return 0.0;
+#elif defined(_WIN32)
+    static LARGE_INTEGER frequency = {};
+    if (frequency.QuadPart == 0)
+        ::QueryPerformanceFrequency(&frequency);
+    LARGE_INTEGER counter;
+    ::QueryPerformanceCounter(&counter);
+    return (double)counter.QuadPart / (double)frequency.QuadPart;
+#else
+    struct timespec ts;
+    if (clock_gettime(CLOCK_MONOTONIC, &ts) != 0)
+        return 0.0;
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+#endif
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] MISC HELPERS/UTILITIES (ImText* functions)
 //-----------------------------------------------------------------------------
@@ -2667,6 +2867,28 @@ int ImTextCountLines(const char* in_text, const char* in_text_end)
     return count;
 }
 
+// Used by text functions to skip UTF-8 decoding and control character checks over runs of printable ASCII characters.
+// When the end is known, 16 bytes are tested at a time: as signed bytes, values outside 0x20..0x7F are all < 0x20.
+const char* ImTextFindPrintableAsciiEnd(const char* in_text, const char* in_text_end)
+{
+#ifdef IMGUI_ENABLE_SSE2
+    if (in_text_end != NULL)
+    {
+        const __m128i min_printable = _mm_set1_epi8(0x20);
+        while (in_text_end - in_text >= 16)
+        {
+            const __m128i chars = _mm_loadu_si128((const __m128i*)(const void*)in_text);
+            if (_mm_movemask_epi8(_mm_cmplt_epi8(chars, min_printable)) != 0)
+                break;
+            in_text += 16;
+        }
+    }
+#endif
+    while ((in_text_end == NULL || in_text < in_text_end) && (unsigned char)*in_text >= 0x20 && (unsigned char)*in_text < 0x80)
+        in_text++;
+    return in_text;
+}
+
 IM_MSVC_RUNTIME_CHECKS_RESTORE
 
 //-----------------------------------------------------------------------------
@@ -3068,7 +3290,22 @@ void ImGuiTextIndex::append(const char* base, int old_size, int new_size)
     if (EndOffset == 0 || base[EndOffset - 1] == '\n')
         LineOffsets.push_back(EndOffset);
     const char* base_end = base + new_size;
-    for (const char* p = base + old_size; (p = (const char*)ImMemchr(p, '\n', base_end - p)) != 0; )
+    const char* p = base + old_size;
+#ifdef IMGUI_ENABLE_SSE2
+    // Compare 16 bytes at a time and walk the set bits of the match mask: faster than repeated memchr() calls on short lines.
+    const __m128i newlines = _mm_set1_epi8('\n');
+    for (; base_end - p >= 16; p += 16)
+    {
+        unsigned int mask = (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(const void*)p), newlines));
+        for (; mask != 0; mask &= mask - 1)
+        {
+            const char* line_begin = p + ImCountTrailingZeros(mask) + 1;
+            if (line_begin < base_end) // Don't push a trailing offset on last \n
+                LineOffsets.push_back((int)(intptr_t)(line_begin - base));
+        }
+    }
+#endif
+    for (; (p = (const char*)ImMemchr(p, '\n', base_end - p)) != 0; )
         if (++p < base_end) // Don't push a trailing offset on last \n
             LineOffsets.push_back((int)(intptr_t)(p - base));
     EndOffset = ImMax(EndOffset, new_size);
@@ -3110,14 +3347,13 @@ static void ImGuiListClipper_SortAndFuseRanges(ImVector<ImGuiListClipperRange>&
     }
 }
 
-static void ImGuiListClipper_SeekCursorAndSetupPrevLine(float pos_y, float line_height)
+static void ImGuiListClipper_SeekCursorAndSetupPrevLine(float pos_y, float line_height, int row_increase)
 {
     // Set cursor position and a few other things so that SetScrollHereY() and Columns() can work when seeking cursor.
     // FIXME: It is problematic that we have to do that here, because custom/equivalent end-user code would stumble on the same issue.
     // The clipper should probably have a final step to display the last item in a regular manner, maybe with an opt-out flag for data sets which may have costly seek?
     ImGuiContext& g = *GImGui;
     ImGuiWindow* window = g.CurrentWindow;
-    float off_y = pos_y - window->DC.CursorPos.y;
     window->DC.CursorPos.y = pos_y;
     window->DC.CursorMaxPos.y = ImMax(window->DC.CursorMaxPos.y, pos_y - g.Style.ItemSpacing.y);
     window->DC.CursorPosPrevLine.y = window->DC.CursorPos.y - line_height;  // Setting those fields so that SetScrollHereY() can properly function after the end of our clipper usage.
@@ -3129,12 +3365,101 @@ static void ImGuiListClipper_SeekCursorAndSetupPrevLine(float pos_y, float line_
         if (table->IsInsideRow)
             ImGui::TableEndRow(table);
         table->RowPosY2 = window->DC.CursorPos.y;
-        const int row_increase = (int)((off_y / line_height) + 0.5f);
         table->CurrentRow += row_increase;
         table->RowBgColorCounter += row_increase;
     }
 }
 
+// Fenwick tree (binary indexed tree) of measured heights: node 'i' stores the sum over items [i - (i & -i), i - 1].
+// Unmeasured items are accounted for by counting measured items, so changing EstimatedHeight doesn't need any update.
+void ImGuiListClipperHeights::Resize(int items_count)
+{
+    IM_ASSERT(items_count >= 0);
+    const int old_count = Heights.Size;
+    if (items_count == old_count)
+        return;
+    Heights.resize(items_count, -1.0f);
+    TreeSums.resize(items_count + 1);
+    TreeCounts.resize(items_count + 1);
+    TreeSums[0] = 0.0;
+    TreeCounts[0] = 0;
+
+    // Shrinking: remaining nodes stay valid as a node never covers items after its own index.
+    // Growing: new nodes may cover existing items, build them from existing nodes covering the same range.
+    for (int node_n = old_count + 1; node_n <= items_count; node_n++)
+    {
+        double sum = 0.0;
+        int count = 0;
+        for (int i = node_n - 1, i_end = node_n - (node_n & -node_n); i > i_end; i -= (i & -i))
+        {
+            sum += TreeSums[i];
+            count += TreeCounts[i];
+        }
+        TreeSums[node_n] = sum;
+        TreeCounts[node_n] = count;
+    }
+}
+
+void ImGuiListClipperHeights::SetItemHeight(int item_n, float height)
+{
+    IM_ASSERT(item_n >= 0 && item_n < Heights.Size);
+    if (height < 0.0f)
+        height = -1.0f;
+    const float old_height = Heights[item_n];
+    if (old_height == height)
+        return;
+    Heights[item_n] = height;
+    const double delta_sum = (double)ImMax(height, 0.0f) - (double)ImMax(old_height, 0.0f);
+    const int delta_count = (height >= 0.0f ? 1 : 0) - (old_height >= 0.0f ? 1 : 0);
+    for (int i = item_n + 1; i <= Heights.Size; i += (i & -i))
+    {
+        TreeSums[i] += delta_sum;
+        TreeCounts[i] += delta_count;
+    }
+}
+
+float ImGuiListClipperHeights::GetItemHeight(int item_n) const
+{
+    IM_ASSERT(item_n >= 0 && item_n < Heights.Size);
+    return (Heights[item_n] >= 0.0f) ? Heights[item_n] : ImMax(EstimatedHeight, 0.0f);
+}
+
+double ImGuiListClipperHeights::GetItemOffset(int item_n) const
+{
+    IM_ASSERT(item_n >= 0 && item_n <= Heights.Size);
+    double sum = 0.0;
+    int count = 0;
+    for (int i = item_n; i > 0; i -= (i & -i))
+    {
+        sum += TreeSums[i];
+        count += TreeCounts[i];
+    }
+    return sum + (double)(item_n - count) * ImMax(EstimatedHeight, 0.0f);
+}
+
+int ImGuiListClipperHeights::FindItemAtOffset(double offset) const
+{
+    if (Heights.Size == 0)
+        return 0;
+
+    // Descend the tree from its largest node, accumulating all nodes which fully fit before 'offset'.
+    const double estimated_height = ImMax(EstimatedHeight, 0.0f);
+    int item_n = 0;
+    for (int step = ImUpperPowerOfTwo(Heights.Size + 1) >> 1; step > 0; step >>= 1)
+    {
+        const int node_n = item_n + step;
+        if (node_n > Heights.Size)
+            continue;
+        const double node_height = TreeSums[node_n] + (double)(step - TreeCounts[node_n]) * estimated_height;
+        if (node_height <= offset)
+        {
+            item_n = node_n;
+            offset -= node_height;
+        }
+    }
+    return ImMin(item_n, Heights.Size - 1);
+}
+
 ImGuiListClipper::ImGuiListClipper()
 {
     memset(this, 0, sizeof(*this));
@@ -3160,6 +3485,7 @@ void ImGuiListClipper::Begin(int items_count, float items_height)
 
     StartPosY = window->DC.CursorPos.y;
     ItemsHeight = items_height;
+    ItemsHeights = NULL;
     ItemsCount = items_count;
     DisplayStart = -1;
     DisplayEnd = 0;
@@ -3174,6 +3500,17 @@ void ImGuiListClipper::Begin(int items_count, float items_height)
     StartSeekOffsetY = data->LossynessOffset;
 }
 
+// Variable height mode: items are submitted one by one so each of them can be measured and its height stored in 'heights'.
+// Unmeasured items are assumed to be heights->EstimatedHeight tall, and converting positions to item indices is O(log N).
+void ImGuiListClipper::BeginVariableHeight(int items_count, ImGuiListClipperHeights* heights)
+{
+    IM_ASSERT(heights != NULL);
+    IM_ASSERT(items_count >= 0 && items_count < INT_MAX && "Variable height mode requires a known items count.");
+    heights->Resize(items_count);
+    Begin(items_count, heights->EstimatedHeight);
+    ItemsHeights = heights;
+}
+
 void ImGuiListClipper::End()
 {
     if (ImGuiListClipperData* data = (ImGuiListClipperData*)TempData)
@@ -3213,8 +3550,21 @@ void ImGuiListClipper::SeekCursorForItem(int item_n)
     // - Perform the add and multiply with double to allow seeking through larger ranges.
     // - StartPosY starts from ItemsFrozen, by adding SeekOffsetY we generally cancel that out (SeekOffsetY == LossynessOffset - ItemsFrozen * ItemsHeight).
     // - The reason we store SeekOffsetY instead of inferring it, is because we want to allow user to perform Seek after the last step, where ImGuiListClipperData is already done.
+    // - In variable height mode, SeekOffsetY == LossynessOffset - offset of item ItemsFrozen, and we know exactly how many table rows are skipped.
+    ImGuiWindow* window = Ctx->CurrentWindow;
+    if (ImGuiListClipperHeights* heights = ItemsHeights)
+    {
+        ImGuiListClipperData* data = (ImGuiListClipperData*)TempData;
+        float pos_y = (float)((double)StartPosY + StartSeekOffsetY + heights->GetItemOffset(item_n));
+        int row_increase = data ? item_n - data->CursorItem : 0;
+        if (data)
+            data->CursorItem = item_n;
+        ImGuiListClipper_SeekCursorAndSetupPrevLine(pos_y, item_n > 0 ? heights->GetItemHeight(item_n - 1) : ItemsHeight, row_increase);
+        return;
+    }
     float pos_y = (float)((double)StartPosY + StartSeekOffsetY + (double)item_n * ItemsHeight);
-    ImGuiListClipper_SeekCursorAndSetupPrevLine(pos_y, ItemsHeight);
+    int row_increase = (int)(((pos_y - window->DC.CursorPos.y) / ItemsHeight) + 0.5f);
+    ImGuiListClipper_SeekCursorAndSetupPrevLine(pos_y, ItemsHeight, row_increase);
 }
 
 static bool ImGuiListClipper_StepInternal(ImGuiListClipper* clipper)
@@ -3228,6 +3578,15 @@ static bool ImGuiListClipper_StepInternal(ImGuiListClipper* clipper)
     if (table && table->IsInsideRow)
         ImGui::TableEndRow(table);
 
+    // Variable height mode: store height of the item submitted by previous step
+    ImGuiListClipperHeights* heights = clipper->ItemsHeights;
+    if (heights != NULL && data->MeasureItem >= 0)
+    {
+        if (!ImIsFloatAboveGuaranteedIntegerPrecision(data->MeasureStartPosY) && !ImIsFloatAboveGuaranteedIntegerPrecision(window->DC.CursorPos.y))
+            heights->SetItemHeight(data->MeasureItem, ImMax(window->DC.CursorPos.y - data->MeasureStartPosY, 0.0f));
+        data->MeasureItem = -1;
+    }
+
     // No items
     if (clipper->ItemsCount == 0 || GetSkipItemForListClipping())
         return false;
@@ -3255,6 +3614,11 @@ static bool ImGuiListClipper_StepInternal(ImGuiListClipper* clipper)
             clipper->DisplayStart = ImMax(data->Ranges[0].Min, data->ItemsFrozen);
             clipper->DisplayEnd = ImMin(data->Ranges[0].Max, clipper->ItemsCount);
             data->StepNo = 1;
+            if (heights != NULL)
+            {
+                data->MeasureItem = clipper->DisplayStart;
+                data->MeasureStartPosY = window->DC.CursorPos.y;
+            }
             return true;
         }
         calc_clipping = true;   // If on the first step with known item height, calculate clipping.
@@ -3281,6 +3645,8 @@ static bool ImGuiListClipper_StepInternal(ImGuiListClipper* clipper)
         if (clipper->ItemsHeight == 0.0f && clipper->ItemsCount == INT_MAX) // Accept that no item have been submitted if in indeterminate mode.
             return false;
         IM_ASSERT(clipper->ItemsHeight > 0.0f && "Unable to calculate item height! First item hasn't moved the cursor vertically!");
+        if (heights != NULL && heights->EstimatedHeight <= 0.0f)
+            heights->EstimatedHeight = clipper->ItemsHeight;
         calc_clipping = true;   // If item height had to be calculated, calculate clipping afterwards.
     }
 
@@ -3289,7 +3655,10 @@ static bool ImGuiListClipper_StepInternal(ImGuiListClipper* clipper)
     if (calc_clipping)
     {
         // Record seek offset, this is so ImGuiListClipper::Seek() can be called after ImGuiListClipperData is done
-        clipper->StartSeekOffsetY = (double)data->LossynessOffset - data->ItemsFrozen * (double)clipper->ItemsHeight;
+        if (heights != NULL)
+            clipper->StartSeekOffsetY = (double)data->LossynessOffset - heights->GetItemOffset(data->ItemsFrozen);
+        else
+            clipper->StartSeekOffsetY = (double)data->LossynessOffset - data->ItemsFrozen * (double)clipper->ItemsHeight;
 
         if (g.LogEnabled)
         {
@@ -3341,8 +3710,18 @@ static bool ImGuiListClipper_StepInternal(ImGuiListClipper* clipper)
         // - Very important: when a starting position is after our maximum item, we set Min to (ItemsCount - 1). This allows us to handle most forms of wrapping.
         // - Due to how Selectable extra padding they tend to be "unaligned" with exact unit in the item list,
         //   which with the flooring/ceiling tend to lead to 2 items instead of one being submitted.
+        // - In variable height mode, the cursor is at item 'already_submitted' and we search item offsets in O(log N).
         for (ImGuiListClipperRange& range : data->Ranges)
-            if (range.PosToIndexConvert)
+            if (range.PosToIndexConvert && heights != NULL)
+            {
+                const double base_offset = heights->GetItemOffset(already_submitted) - window->DC.CursorPos.y - data->LossynessOffset;
+                int m1 = heights->FindItemAtOffset((double)range.Min + base_offset);
+                int m2 = heights->FindItemAtOffset((double)range.Max + base_offset) + 1;
+                range.Min = ImClamp(m1 + range.PosToIndexOffsetMin, already_submitted, clipper->ItemsCount - 1);
+                range.Max = ImClamp(m2 + range.PosToIndexOffsetMax, range.Min + 1, clipper->ItemsCount);
+                range.PosToIndexConvert = false;
+            }
+            else if (range.PosToIndexConvert)
             {
                 int m1 = (int)(((double)range.Min - window->DC.CursorPos.y - data->LossynessOffset) / clipper->ItemsHeight);
                 int m2 = (int)((((double)range.Max - window->DC.CursorPos.y - data->LossynessOffset) / clipper->ItemsHeight) + 0.999999f);
@@ -3358,11 +3737,22 @@ static bool ImGuiListClipper_StepInternal(ImGuiListClipper* clipper)
     {
         clipper->DisplayStart = ImMax(data->Ranges[data->StepNo].Min, already_submitted);
         clipper->DisplayEnd = ImMin(data->Ranges[data->StepNo].Max, clipper->ItemsCount);
+        if (heights != NULL && clipper->DisplayEnd - clipper->DisplayStart > 1)
+        {
+            // Variable height mode: submit one item at a time so we can measure it, leave the rest of the range to next step.
+            data->Ranges.insert(data->Ranges.Data + data->StepNo + 1, ImGuiListClipperRange::FromIndices(clipper->DisplayStart + 1, clipper->DisplayEnd));
+            clipper->DisplayEnd = clipper->DisplayStart + 1;
+        }
         data->StepNo++;
         if (clipper->DisplayStart >= clipper->DisplayEnd)
             continue;
         if (clipper->DisplayStart > already_submitted)
             clipper->SeekCursorForItem(clipper->DisplayStart);
+        if (heights != NULL)
+        {
+            data->MeasureItem = clipper->DisplayStart;
+            data->MeasureStartPosY = window->DC.CursorPos.y;
+        }
         return true;
     }
 
@@ -3387,6 +3777,7 @@ bool ImGuiListClipper::Step()
         IMGUI_DEBUG_LOG_CLIPPER("Clipper: Step(): computed ItemsHeight: %.2f.\n", ItemsHeight);
     if (ret)
     {
+        ((ImGuiListClipperData*)TempData)->CursorItem = DisplayEnd;
         IMGUI_DEBUG_LOG_CLIPPER("Clipper: Step(): display %d to %d.\n", DisplayStart, DisplayEnd);
     }
     else
@@ -3730,7 +4121,38 @@ void ImGui::RenderTextWrapped(ImVec2 pos, const char* text, const char* text_end
 
     if (text != text_end)
     {
-        window->DrawList->AddText(g.Font, g.FontSize, pos, GetColorU32(ImGuiCol_Text), text, text_end, wrap_width);
+        if (wrap_width > 0.0f)
+        {
+            // Render visible lines using cached line breaks, instead of word-wrapping the text again.
+            // When called right after CalcTextSize() on the same text (e.g. TextEx()) we reuse its result without hashing the text again.
+            ImGuiTextLayout* layout = NULL;
+            if (g.TextLayoutsLastIdx != -1)
+            {
+                ImGuiTextLayout* last_layout = g.TextLayouts.GetByIndex(g.TextLayoutsLastIdx);
+                if (last_layout->LastText == text && last_layout->TextLength == (int)(text_end - text) && last_layout->LastFrameUsed == g.FrameCount && last_layout->Seed == TextLayoutGetSeed(g.Font, g.FontSize, wrap_width))
+                    layout = last_layout;
+            }
+            if (layout == NULL)
+                layout = CalcTextLayoutWrapped(text, text_end, wrap_width);
+            g.TextLayoutsLastIdx = -1;
+
+            const ImU32 col = GetColorU32(ImGuiCol_Text);
+            const float line_height = g.FontSize;
+            const ImVec4& clip_rect = window->DrawList->_CmdHeader.ClipRect;
+            const float y0 = IM_TRUNC(pos.y);
+            const int lines_count = layout->Lines.Size / 2;
+            for (int line_n = (int)ImClamp((clip_rect.y - y0) / line_height - 1.0f, 0.0f, (float)lines_count); line_n < lines_count; line_n++)
+            {
+                const float y = y0 + line_n * line_height;
+                if (y > clip_rect.w)
+                    break;
+                window->DrawList->AddText(g.Font, g.FontSize, ImVec2(pos.x, y), col, text + layout->Lines[line_n * 2], text + layout->Lines[line_n * 2 + 1]);
+            }
+        }
+        else
+        {
+            window->DrawList->AddText(g.Font, g.FontSize, pos, GetColorU32(ImGuiCol_Text), text, text_end, wrap_width);
+        }
         if (g.LogEnabled)
             LogRenderedText(&pos, text, text_end);
     }
@@ -4125,6 +4547,7 @@ ImGuiContext::ImGuiContext(ImFontAtlas* shared_font_atlas)
     NavWindowingToggleKey = ImGuiKey_None;
 
     DimBgRatio = 0.0f;
+    TexUploadRectsRequested = 0;
 
     DragDropActive = DragDropWithinSource = DragDropWithinTarget = false;
     DragDropSourceFlags = ImGuiDragDropFlags_None;
@@ -4142,6 +4565,7 @@ ImGuiContext::ImGuiContext(ImFontAtlas* shared_font_atlas)
 
     CurrentTable = NULL;
     TablesTempDataStacked = 0;
+    TextLayoutsLastIdx = -1;
     CurrentTabBar = NULL;
     CurrentMultiSelect = NULL;
     MultiSelectTempDataStacked = 0;
@@ -4347,7 +4771,8 @@ void ImGui::Shutdown()
 
     g.Tables.Clear();
     g.TablesTempData.clear_destruct();
-    g.DrawChannelsTempMergeBuffer.clear();
+    g.TextLayouts.Clear();
+    g.TextLayoutsLastIdx = -1;
 
     g.MultiSelectStorage.Clear();
     g.MultiSelectTempData.clear_destruct();
@@ -5517,6 +5942,7 @@ void ImGui::NewFrame()
     for (ImGuiTableTempData& table_temp_data : g.TablesTempData)
         if (table_temp_data.LastTimeActive >= 0.0f && table_temp_data.LastTimeActive < memory_compact_start_time)
             TableGcCompactTransientBuffers(&table_temp_data);
+    GcCompactTextLayouts(memory_compact_start_time);
     if (g.GcCompactAll)
         GcCompactTransientMiscBuffers();
     g.GcCompactAll = false;
@@ -5658,7 +6084,7 @@ static void InitViewportDrawData(ImGuiViewportP* viewport)
 
     draw_data->Valid = true;
     draw_data->CmdListsCount = 0;
-    draw_data->TotalVtxCount = draw_data->TotalIdxCount = 0;
+    draw_data->TotalVtxCount = draw_data->TotalIdxCount = draw_data->TotalIdx32Count = 0;
     draw_data->DisplayPos = viewport->Pos;
     draw_data->DisplaySize = viewport->Size;
     draw_data->FramebufferScale = io.DisplayFramebufferScale;
@@ -5939,6 +6365,9 @@ void ImGui::Render()
         g.IO.MetricsRenderIndices += draw_data->TotalIdxCount;
     }
 
+    // Merge texture updates and count what the backend will have to upload
+    UpdateTexturesRender();
+
 #ifndef IMGUI_DISABLE_DEBUG_TOOLS
     if (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasTextures)
         for (ImFontAtlas* atlas : g.FontAtlases)
@@ -5964,7 +6393,11 @@ ImVec2 ImGui::CalcTextSize(const char* text, const char* text_end, bool hide_tex
     const float font_size = g.FontSize;
     if (text == text_display_end)
         return ImVec2(0.0f, font_size);
-    ImVec2 text_size = font->CalcTextSizeA(font_size, FLT_MAX, wrap_width, text, text_display_end, NULL);
+    ImVec2 text_size;
+    if (wrap_width > 0.0f)
+        text_size = CalcTextLayoutWrapped(text, text_display_end, wrap_width)->Size;
+    else
+        text_size = font->CalcTextSizeA(font_size, FLT_MAX, wrap_width, text, text_display_end, NULL);
 
     // Round
     // FIXME: This has been here since Dec 2015 (7b0bf230) but down the line we want this out.
@@ -5976,6 +6409,94 @@ ImVec2 ImGui::CalcTextSize(const char* text, const char* text_end, bool hide_tex
     return text_size;
 }
 
+static ImGuiID ImGui::TextLayoutGetSeed(ImFont* font, float font_size, float wrap_width)
+{
+    struct { ImFont* Font; ImGuiID FontId; float FontSize; float RasterizerDensity; float WrapWidth; } hashed_data;
+    memset(&hashed_data, 0, sizeof(hashed_data)); // Clear padding
+    hashed_data.Font = font;
+    hashed_data.FontId = font->FontId;
+    hashed_data.FontSize = font_size;
+    hashed_data.RasterizerDensity = font->CurrentRasterizerDensity;
+    hashed_data.WrapWidth = wrap_width;
+    return ImHashData(&hashed_data, sizeof(hashed_data));
+}
+
+// Text contents may be large (e.g. a help panel) and are hashed every frame: ImHashData() processes one byte at a time
+// and is several times slower than measuring non-wrapped text, so we use a 64-bit multiply-xorshift hash over 8 bytes at a time.
+static ImU64 ImGui::TextLayoutHashText(const char* text, int text_len, ImGuiID seed)
+{
+    const ImU64 k = 0x9E3779B97F4A7C15ULL;
+    ImU64 h = (seed ^ (ImU64)text_len) * k;
+    const char* p = text;
+    const char* p_end = text + text_len;
+    for (; p_end - p >= 8; p += 8)
+    {
+        ImU64 v;
+        memcpy(&v, p, 8);
+        h = (h ^ v) * k;
+        h ^= h >> 32;
+    }
+    for (; p < p_end; p++)
+        h = (h ^ (unsigned char)*p) * k;
+    h ^= h >> 29;
+    h *= k;
+    h ^= h >> 32;
+    return h;
+}
+
+// Measure wrapped text with current font, using the text layout cache.
+// Wrapped text is typically long and measured every frame, and word-wrapping it is costly (see ImFont::CalcWordWrapPosition()).
+// Caching line breaks also lets RenderTextWrapped() render visible lines only. Non-wrapped text is not cached: it is cheap to measure and mostly short labels, for which a lookup costs about as much.
+ImGuiTextLayout* ImGui::CalcTextLayoutWrapped(const char* text, const char* text_end, float wrap_width)
+{
+    ImGuiContext& g = *GImGui;
+    if (!text_end)
+        text_end = text + ImStrlen(text);
+    const int text_len = (int)(text_end - text);
+    ImFont* font = g.Font;
+    const ImGuiID seed = TextLayoutGetSeed(font, g.FontSize, wrap_width);
+    const ImU64 text_hash = TextLayoutHashText(text, text_len, seed);
+    const ImGuiID id = (ImGuiID)text_hash;
+
+    ImGuiTextLayout* layout = g.TextLayouts.GetOrAddByKey(id);
+    if (layout->LastFrameUsed == -1 || layout->TextHash != text_hash || layout->TextLength != text_len || layout->BakedGeneration != font->ContainerAtlas->BakedGeneration)
+    {
+        layout->ID = id;
+        layout->Seed = seed;
+        layout->TextHash = text_hash;
+        layout->TextLength = text_len;
+        layout->Size = ImFontCalcTextSizeWithLines(font, g.FontSize, wrap_width, text, text_end, &layout->Lines);
+        layout->BakedGeneration = font->ContainerAtlas->BakedGeneration;
+    }
+    layout->LastFrameUsed = g.FrameCount;
+    layout->LastTimeUsed = (float)g.Time;
+    layout->LastText = text;
+    g.TextLayoutsLastIdx = g.TextLayouts.GetIndex(layout);
+    return layout;
+}
+
+// Evict text layouts which haven't been used for a while.
+// Wrapped text changing every frame creates a new entry every frame: when over capacity, also evict entries not used during last frame.
+void ImGui::GcCompactTextLayouts(float memory_compact_start_time)
+{
+    ImGuiContext& g = *GImGui;
+    g.TextLayoutsLastIdx = -1;
+    if (g.TextLayouts.GetAliveCount() == 0)
+        return;
+    // - memory_compact_start_time is FLT_MAX when ConfigMemoryCompactTimer < 0.0f (disabled): only use it when compacting is enabled or requested.
+    // - Entries used during last frame are always kept, otherwise the cache would never hit.
+    const bool compact_unused = (g.IO.ConfigMemoryCompactTimer >= 0.0f || g.GcCompactAll);
+    const bool compact_over_max = (g.TextLayouts.GetAliveCount() > TEXT_LAYOUTS_COUNT_SOFT_MAX);
+    if (!compact_unused && !compact_over_max)
+        return;
+    for (int n = 0; n < g.TextLayouts.GetMapSize(); n++)
+        if (ImGuiTextLayout* layout = g.TextLayouts.TryGetMapData(n))
+            if (layout->LastFrameUsed < g.FrameCount - 1 && (compact_over_max || layout->LastTimeUsed < memory_compact_start_time))
+                g.TextLayouts.Remove(layout->ID, layout);
+    if (g.TextLayouts.GetMapSize() > g.TextLayouts.GetAliveCount() * 2 + 64)
+        g.TextLayouts.CompactMap();
+}
+
 // Find window given position, search front-to-back
 // - Typically write output back to g.HoveredWindow and g.HoveredWindowUnderMovingWindow.
 // - FIXME: Note that we have an inconsequential lag here: OuterRectClipped is updated in Begin(), so windows moved programmatically
@@ -8669,6 +9190,7 @@ bool ImGui::IsRectVisible(const ImVec2& rect_min, const ImVec2& rect_max)
 //-----------------------------------------------------------------------------
 // - UpdateTexturesNewFrame() [Internal]
 // - UpdateTexturesEndFrame() [Internal]
+// - UpdateTexturesRender() [Internal]
 // - UpdateFontsNewFrame() [Internal]
 // - UpdateFontsEndFrame() [Internal]
 // - GetDefaultFont() [Internal]
@@ -8723,6 +9245,40 @@ static void ImGui::UpdateTexturesEndFrame()
         g.PlatformIO.Textures.push_back(tex);
 }
 
+// Merge update rectangles of atlas textures (requests may still have been queued while rendering, so this is done as late as possible)
+// and update texture upload metrics.
+static void ImGui::UpdateTexturesRender()
+{
+    ImGuiContext& g = *GImGui;
+    int merged_rects_count = 0;
+    if (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasTextures)
+        for (ImFontAtlas* atlas : g.FontAtlases)
+            for (ImTextureData* tex : atlas->TexList)
+                if (tex->Status == ImTextureStatus_WantUpdates)
+                {
+                    merged_rects_count += tex->Updates.Size;
+                    ImTextureDataMergeUpdates(tex, atlas->TexUpdatesMergeWaste);
+                    merged_rects_count -= tex->Updates.Size;
+                }
+
+    g.IO.MetricsTexUploadRects = g.IO.MetricsTexUploadBytes = 0;
+    for (ImTextureData* tex : g.PlatformIO.Textures)
+    {
+        if (tex->Status == ImTextureStatus_WantCreate)
+        {
+            g.IO.MetricsTexUploadRects++;
+            g.IO.MetricsTexUploadBytes += tex->GetSizeInBytes();
+        }
+        else if (tex->Status == ImTextureStatus_WantUpdates)
+        {
+            g.IO.MetricsTexUploadRects += tex->Updates.Size;
+            for (const ImTextureRect& r : tex->Updates)
+                g.IO.MetricsTexUploadBytes += r.w * r.h * tex->BytesPerPixel;
+        }
+    }
+    g.TexUploadRectsRequested = g.IO.MetricsTexUploadRects + merged_rects_count;
+}
+
 void ImGui::UpdateFontsNewFrame()
 {
     ImGuiContext& g = *GImGui;
@@ -8821,6 +9377,7 @@ void ImGui::SetCurrentFont(ImFont* font, float font_size_before_scaling, float f
 #ifndef IMGUI_DISABLE_OBSOLETE_FUNCTIONS
         IM_ASSERT(font->Scale > 0.0f);
 #endif
+        IM_ASSERT_USER_ERROR((font->Flags & ImFontFlags_SDF) == 0 || (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasSdfFonts), "Using a ImFontFlags_SDF font requires a renderer backend supporting ImGuiBackendFlags_RendererHasSdfFonts!");
         ImFontAtlas* atlas = font->ContainerAtlas;
         g.DrawListSharedData.FontAtlas = atlas;
         g.DrawListSharedData.Font = font;
@@ -16032,6 +16589,8 @@ void ImGui::ShowFontAtlas(ImFontAtlas* atlas)
     if (Button("Clear All"))
         ImFontAtlasBuildClear(atlas);
     SetItemTooltip("Destroy cache and custom rectangles.");
+    if (ImFontAtlasGlyphCache* cache = atlas->GlyphCache)
+        Text("Glyph cache: %d blocks, %d glyphs loaded from cache", cache->BlocksCount, cache->GlyphsLoadedCount);
 
     for (int tex_n = 0; tex_n < atlas->TexList.Size; tex_n++)
     {
@@ -16044,6 +16603,13 @@ void ImGui::ShowFontAtlas(ImFontAtlas* atlas)
     const int discarded_surface_sqrt = (int)sqrtf((float)atlas->Builder->RectsDiscardedSurface);
     Text("Packed rects: %d, area: about %d px ~%dx%d px", atlas->Builder->RectsPackedCount, atlas->Builder->RectsPackedSurface, packed_surface_sqrt, packed_surface_sqrt);
     Text("incl. Discarded rects: %d, area: about %d px ~%dx%d px", atlas->Builder->RectsDiscardedCount, atlas->Builder->RectsDiscardedSurface, discarded_surface_sqrt, discarded_surface_sqrt);
+    if (atlas->Builder->Pages.Size > 1)
+        for (int page_n = 0; page_n < atlas->Builder->Pages.Size; page_n++)
+        {
+            ImFontAtlasPage* page = atlas->Builder->Pages[page_n];
+            BulletText("Page %d: Texture #%03d %dx%d, packed rects: %d, area: %d px, discarded area: %d px%s", page_n, page->Tex->UniqueID, page->Tex->Width, page->Tex->Height,
+                page->RectsPackedCount, page->RectsPackedSurface, page->RectsDiscardedSurface, (page_n == atlas->Builder->PagesCurrent) ? " (current)" : "");
+        }
 
     ImFontAtlasRectId highlight_r_id = ImFontAtlasRectId_Invalid;
     if (TreeNode("Rects Index", "Rects Index (%d)", atlas->Builder->RectsPackedCount)) // <-- Use count of used rectangles
@@ -16058,13 +16624,13 @@ void ImGui::ShowFontAtlas(ImFontAtlas* atlas)
                     ImFontAtlasRect r = {};
                     atlas->GetCustomRect(id, &r);
                     const char* buf;
-                    ImFormatStringToTempBuffer(&buf, NULL, "ID:%08X, used:%d, { w:%3d, h:%3d } { x:%4d, y:%4d }", id, entry.IsUsed, r.w, r.h, r.x, r.y);
+                    ImFormatStringToTempBuffer(&buf, NULL, "ID:%08X, used:%d, page:%d, { w:%3d, h:%3d } { x:%4d, y:%4d }", id, entry.IsUsed, entry.Page, r.w, r.h, r.x, r.y);
                     TableNextColumn();
                     Selectable(buf);
                     if (IsItemHovered())
                         highlight_r_id = id;
                     TableNextColumn();
-                    Image(atlas->TexRef, ImVec2(r.w, r.h), r.uv0, r.uv1);
+                    Image(atlas->Builder->Pages[entry.Page]->Tex->GetTexRef(), ImVec2(r.w, r.h), r.uv0, r.uv1);
                 }
             EndTable();
         }
@@ -16075,13 +16641,17 @@ void ImGui::ShowFontAtlas(ImFontAtlas* atlas)
     // Texture list
     // (ensure the last texture always use the same ID, so we can keep it open neatly)
     ImFontAtlasRect highlight_r;
+    ImTextureData* highlight_tex = NULL;
     if (highlight_r_id != ImFontAtlasRectId_Invalid)
+    {
         atlas->GetCustomRect(highlight_r_id, &highlight_r);
+        highlight_tex = atlas->Builder->Pages[ImFontAtlasPackGetRectPage(atlas, highlight_r_id)]->Tex;
+    }
     for (int tex_n = 0; tex_n < atlas->TexList.Size; tex_n++)
     {
         if (tex_n == atlas->TexList.Size - 1)
             SetNextItemOpen(true, ImGuiCond_Once);
-        DebugNodeTexture(atlas->TexList[tex_n], atlas->TexList.Size - 1 - tex_n, (highlight_r_id != ImFontAtlasRectId_Invalid) ? &highlight_r : NULL);
+        DebugNodeTexture(atlas->TexList[tex_n], atlas->TexList.Size - 1 - tex_n, (highlight_tex == atlas->TexList[tex_n]) ? &highlight_r : NULL);
     }
 }
 
@@ -16147,6 +16717,7 @@ void ImGui::ShowMetricsWindow(bool* p_open)
     Text("Application average %.3f ms/frame (%.1f FPS)", 1000.0f / io.Framerate, io.Framerate);
     Text("%d vertices, %d indices (%d triangles)", io.MetricsRenderVertices, io.MetricsRenderIndices, io.MetricsRenderIndices / 3);
     Text("%d visible windows, %d current allocations", io.MetricsRenderWindows, g.DebugAllocInfo.TotalAllocCount - g.DebugAllocInfo.TotalFreeCount);
+    Text("%d texture uploads (%d before merging), %.1f KB", io.MetricsTexUploadRects, g.TexUploadRectsRequested, io.MetricsTexUploadBytes / 1024.0f);
     //SameLine(); if (SmallButton("GC")) { g.GcCompactAll = true; }
 
     Separator();
@@ -16399,12 +16970,27 @@ void ImGui::ShowMetricsWindow(bool* p_open)
     // Details for Tables
     if (TreeNode("Tables", "Tables (%d)", g.Tables.GetAliveCount()))
     {
+        float merge_time = 0.0f;
+        for (int n = 0; n < g.Tables.GetMapSize(); n++)
+            if (ImGuiTable* table = g.Tables.TryGetMapData(n))
+                if (table->LastFrameActive >= g.FrameCount - 1)
+                    merge_time += table->DrawChannelsMergeTime;
+        BulletText("Draw channels merge: %.3f ms (all active tables)", merge_time * 1000.0f);
         for (int n = 0; n < g.Tables.GetMapSize(); n++)
             if (ImGuiTable* table = g.Tables.TryGetMapData(n))
                 DebugNodeTable(table);
         TreePop();
     }
 
+    // Details for text layouts cache
+    if (TreeNode("TextLayouts", "Text layouts (%d)", g.TextLayouts.GetAliveCount()))
+    {
+        for (int n = 0; n < g.TextLayouts.GetMapSize(); n++)
+            if (ImGuiTextLayout* layout = g.TextLayouts.TryGetMapData(n))
+                BulletText("0x%08X: %d bytes, %d lines, size (%.1f,%.1f), last used %d frames ago", layout->ID, layout->TextLength, layout->Lines.Size / 2, layout->Size.x, layout->Size.y, g.FrameCount - layout->LastFrameUsed);
+        TreePop();
+    }
+
     // Details for InputText
     if (TreeNode("InputText"))
     {
@@ -16832,7 +17418,7 @@ void ImGui::DebugNodeDrawList(ImGuiWindow* window, ImGuiViewportP* viewport, con
         {
             ImVec2 triangle[3];
             for (int n = 0; n < 3; n++, idx_n++)
-                triangle[n] = vtx_buffer[idx_buffer ? idx_buffer[idx_n] : idx_n].pos;
+                triangle[n] = draw_list->GetVtxPos(vtx_buffer[idx_buffer ? idx_buffer[idx_n] : idx_n]);
             total_area += ImTriangleArea(triangle[0], triangle[1], triangle[2]);
         }
 
@@ -16853,9 +17439,10 @@ void ImGui::DebugNodeDrawList(ImGuiWindow* window, ImGuiViewportP* viewport, con
                 for (int n = 0; n < 3; n++, idx_i++)
                 {
                     const ImDrawVert& v = vtx_buffer[idx_buffer ? idx_buffer[idx_i] : idx_i];
-                    triangle[n] = v.pos;
+                    const ImVec2 uv = draw_list->GetVtxUV(v);
+                    triangle[n] = draw_list->GetVtxPos(v);
                     buf_p += ImFormatString(buf_p, buf_end - buf_p, "%s %04d: pos (%8.2f,%8.2f), uv (%.6f,%.6f), col %08X\n",
-                        (n == 0) ? "Vert:" : "     ", idx_i, v.pos.x, v.pos.y, v.uv.x, v.uv.y, v.col);
+                        (n == 0) ? "Vert:" : "     ", idx_i, triangle[n].x, triangle[n].y, uv.x, uv.y, v.col);
                 }
 
                 Selectable(buf, false);
@@ -16889,7 +17476,7 @@ void ImGui::DebugNodeDrawCmdShowMeshAndBoundingBox(ImDrawList* out_draw_list, co
 
         ImVec2 triangle[3];
         for (int n = 0; n < 3; n++, idx_n++)
-            vtxs_rect.Add((triangle[n] = vtx_buffer[idx_buffer ? idx_buffer[idx_n] : idx_n].pos));
+            vtxs_rect.Add((triangle[n] = draw_list->GetVtxPos(vtx_buffer[idx_buffer ? idx_buffer[idx_n] : idx_n])));
         if (show_mesh)
             out_draw_list->AddPolyline(triangle, 3, IM_COL32(255, 255, 0, 255), ImDrawFlags_Closed, 1.0f); // In yellow: mesh triangles
     }
@@ -17129,7 +17716,7 @@ void ImGui::DebugNodeFontGlyph(ImFont* font, const ImFontGlyph* glyph)
     if (glyph->PackId >= 0)
     {
         ImTextureRect* r = ImFontAtlasPackGetRect(font->ContainerAtlas, glyph->PackId);
-        Text("PackId: %d (%dx%d rect at %d,%d)", glyph->PackId, r->w, r->h, r->x, r->y);
+        Text("PackId: %d (%dx%d rect at %d,%d, page %d)", glyph->PackId, r->w, r->h, r->x, r->y, glyph->TexPage);
     }
     Text("SourceIdx: %d", glyph->SourceIdx);
 }
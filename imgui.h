@@ -48,7 +48,7 @@ Index of this file:
 // [SECTION] Misc data structures (ImGuiInputTextCallbackData, ImGuiSizeCallbackData, ImGuiPayload)
 // [SECTION] Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextBuffer, ImGuiStorage, ImGuiListClipper, Math Operators, ImColor)
 // [SECTION] Multi-Select API flags and structures (ImGuiMultiSelectFlags, ImGuiMultiSelectIO, ImGuiSelectionRequest, ImGuiSelectionBasicStorage, ImGuiSelectionExternalStorage)
-// [SECTION] Drawing API (ImDrawCallback, ImDrawCmd, ImDrawIdx, ImDrawVert, ImDrawChannel, ImDrawListSplitter, ImDrawFlags, ImDrawListFlags, ImDrawList, ImDrawData)
+// [SECTION] Drawing API (ImDrawCallback, ImDrawCmd, ImDrawIdx, ImDrawVert, ImDrawChannel, ImDrawListSplitter, ImDrawFlags, ImDrawListFlags, ImDrawList, ImDrawData, ImDrawDataDamageTracker)
 // [SECTION] Texture API (ImTextureFormat, ImTextureStatus, ImTextureRect, ImTextureData)
 // [SECTION] Font API (ImFontConfig, ImFontGlyph, ImFontGlyphRangesBuilder, ImFontAtlasFlags, ImFontAtlas, ImFontBaked, ImFont)
 // [SECTION] Viewports (ImGuiViewportFlags, ImGuiViewport)
@@ -165,13 +165,15 @@ typedef unsigned long long  ImU64;  // 64-bit unsigned integer
 struct ImDrawChannel;               // Temporary storage to output draw commands out of order, used by ImDrawListSplitter and ImDrawList::ChannelsSplit()
 struct ImDrawCmd;                   // A single draw command within a parent ImDrawList (generally maps to 1 GPU draw call, unless it is a callback)
 struct ImDrawData;                  // All draw command lists required to render the frame + pos/size coordinates to use for the projection matrix.
+struct ImDrawDataDamageTracker;     // Helper to compute which rectangles of the screen may have changed between two consecutive ImDrawData.
 struct ImDrawList;                  // A single draw command list (generally one per window, conceptually you may see this as a dynamic "mesh" builder)
 struct ImDrawListSharedData;        // Data shared among multiple draw lists (typically owned by parent ImGui context, but you may create one yourself)
 struct ImDrawListSplitter;          // Helper to split a draw list into different layers which can be drawn into out of order, then flattened back.
-struct ImDrawVert;                  // A single vertex (pos + uv + col = 20 bytes by default. Override layout with IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
+struct ImDrawVert;                  // A single vertex (pos + uv + col = 20 bytes by default, 12 bytes with IMGUI_USE_PACKED_DRAWVERT. Override layout with IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
 struct ImFont;                      // Runtime data for a single font within a parent ImFontAtlas
 struct ImFontAtlas;                 // Runtime data for multiple fonts, bake multiple fonts into a single texture, TTF/OTF font loader
 struct ImFontAtlasBuilder;          // Opaque storage for building a ImFontAtlas
+struct ImFontAtlasGlyphCache;       // Opaque storage for a persistent cache of baked glyphs (see ImFontAtlas::LoadGlyphCacheFromFile())
 struct ImFontAtlasRect;             // Output of ImFontAtlas::GetCustomRect() when using custom rectangles.
 struct ImFontBaked;                 // Baked data for a ImFont at a given size.
 struct ImFontConfig;                // Configuration data when adding a font or merging fonts
@@ -188,6 +190,7 @@ struct ImGuiIO;                     // Main configuration and I/O between your a
 struct ImGuiInputTextCallbackData;  // Shared state of InputText() when using custom ImGuiInputTextCallback (rare/advanced use)
 struct ImGuiKeyData;                // Storage for ImGuiIO and IsKeyDown(), IsKeyPressed() etc functions.
 struct ImGuiListClipper;            // Helper to manually clip large list of items
+struct ImGuiListClipperHeights;     // Persistent storage of item heights for ImGuiListClipper::BeginVariableHeight()
 struct ImGuiMultiSelectIO;          // Structure to interact with a BeginMultiSelect()/EndMultiSelect() block
 struct ImGuiOnceUponAFrame;         // Helper for running a block of code not more than once a frame
 struct ImGuiPayload;                // User data payload for drag and drop operations
@@ -202,6 +205,7 @@ struct ImGuiStoragePair;            // Helper for key->value storage (pair)
 struct ImGuiStyle;                  // Runtime data for styling/colors
 struct ImGuiTableSortSpecs;         // Sorting specifications for a table (often handling sort specs for a single column, occasionally more)
 struct ImGuiTableColumnSortSpecs;   // Sorting specification for one column of a table
+struct ImGuiTableSorter;            // Helper to sort rows according to table sort specs, without writing a comparator
 struct ImGuiTextBuffer;             // Helper to hold and append into a text buffer (~string builder)
 struct ImGuiTextFilter;             // Helper to parse and apply text filters (e.g. "aaaaa[,bbbbb][,ccccc]")
 struct ImGuiViewport;               // A Platform Window (always only one in 'master' branch), in the future may represent Platform Monitor
@@ -279,6 +283,8 @@ typedef int     (*ImGuiInputTextCallback)(ImGuiInputTextCallbackData* data);
 typedef void    (*ImGuiSizeCallback)(ImGuiSizeCallbackData* data);              // Callback function for ImGui::SetNextWindowSizeConstraints()
 typedef void*   (*ImGuiMemAllocFunc)(size_t sz, void* user_data);               // Function signature for ImGui::SetAllocatorFunctions()
 typedef void    (*ImGuiMemFreeFunc)(void* ptr, void* user_data);                // Function signature for ImGui::SetAllocatorFunctions()
+typedef void    (*ImFontAtlasJobFunc)(int job_index, void* job_data);           // Job function passed to ImFontAtlas::ParallelFor
+typedef void    (*ImFontAtlasParallelForFunc)(int jobs_count, ImFontAtlasJobFunc job_func, void* job_data, void* user_data); // Function signature for ImFontAtlas::ParallelFor
 
 // ImVec2: 2D vector used to store positions, sizes etc. [Compile-time configurable type]
 // - This is a frequently used type in the API. Consider using IM_VEC2_CLASS_EXTRA to create implicit cast from/to our preferred type.
@@ -880,6 +886,7 @@ namespace ImGui
     //    - If you are using tables as a sort of grid, where every column is holding the same type of contents,
     //      you may prefer using TableNextColumn() instead of TableNextRow() + TableSetColumnIndex().
     //      TableNextColumn() will automatically wrap-around into the next row if needed.
+    //    - With many columns and horizontal scrolling, use TableNextRow() + 'while (TableNextVisibleColumn())' to only submit visible cells.
     //    - IMPORTANT: Comparatively to the old Columns() API, we need to call TableNextColumn() for the first column!
     //    - Summary of possible call flow:
     //        - TableNextRow() -> TableSetColumnIndex(0) -> Text("Hello 0") -> TableSetColumnIndex(1) -> Text("Hello 1")  // OK
@@ -892,6 +899,7 @@ namespace ImGui
     IMGUI_API void          TableNextRow(ImGuiTableRowFlags row_flags = 0, float min_row_height = 0.0f); // append into the first cell of a new row.
     IMGUI_API bool          TableNextColumn();                                  // append into the next column (or first column of next row if currently in last column). Return true when column is visible.
     IMGUI_API bool          TableSetColumnIndex(int column_n);                  // append into the specified column. Return true when column is visible.
+    IMGUI_API bool          TableNextVisibleColumn();                           // append into the next visible column of the current row, skipping clipped columns. Return false when there are none left. Use 'while (TableNextVisibleColumn())' in tables with very many columns.
 
     // Tables: Headers & Columns declaration
     // - Use TableSetupColumn() to specify label, resizing policy, default width/weight, id, various other flags etc.
@@ -1701,6 +1709,7 @@ enum ImGuiBackendFlags_
     ImGuiBackendFlags_HasSetMousePos        = 1 << 2,   // Backend Platform supports io.WantSetMousePos requests to reposition the OS mouse position (only used if io.ConfigNavMoveSetMousePos is set).
     ImGuiBackendFlags_RendererHasVtxOffset  = 1 << 3,   // Backend Renderer supports ImDrawCmd::VtxOffset. This enables output of large meshes (64K+ vertices) while still using 16-bit indices.
     ImGuiBackendFlags_RendererHasTextures   = 1 << 4,   // Backend Renderer supports ImTextureData requests to create/update/destroy textures. This enables incremental texture updates and texture reloads. See https://github.com/ocornut/imgui/blob/master/docs/BACKENDS.md for instructions on how to upgrade your custom backend.
+    ImGuiBackendFlags_RendererHasSdfFonts   = 1 << 5,   // Backend Renderer supports ImDrawCallback_SetSdfRenderState. This enables using fonts with ImFontFlags_SDF.
 };
 
 // Enumeration for PushStyleColor() / PopStyleColor()
@@ -2509,6 +2518,8 @@ struct ImGuiIO
     int         MetricsRenderIndices;               // Indices output during last call to Render() = number of triangles * 3
     int         MetricsRenderWindows;               // Number of visible windows
     int         MetricsActiveWindows;               // Number of active windows
+    int         MetricsTexUploadRects;              // Texture rectangles backend was requested to upload during last call to Render(): 1 per created texture + ImTextureData::Updates[] of updated ones.
+    int         MetricsTexUploadBytes;              // Texture bytes backend was requested to upload during last call to Render(), in source ImTextureData format.
     ImVec2      MouseDelta;                         // Mouse delta. Note that this is zero if either current or previous position are invalid (-FLT_MAX,-FLT_MAX), so a disappearing/reappearing mouse won't have a huge delta.
 
     //------------------------------------------------------------------
@@ -2793,6 +2804,13 @@ struct ImGuiStorage
 //   while (clipper.Step())
 //       for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++)
 //           ImGui::Text("line number %d", i);
+// Usage with items of variable height:
+//   static ImGuiListClipperHeights heights; // Must persist across frames. One instance per list.
+//   ImGuiListClipper clipper;
+//   clipper.BeginVariableHeight(1000, &heights);
+//   while (clipper.Step())
+//       for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++)
+//           ImGui::TextWrapped("%s", my_items[i]);
 // Generally what happens is:
 // - Clipper lets you process the first element (DisplayStart = 0, DisplayEnd = 1) regardless of it being visible or not.
 // - User code submit that one element.
@@ -2807,6 +2825,7 @@ struct ImGuiListClipper
     int             DisplayEnd;         // End of items to display (exclusive)
     int             ItemsCount;         // [Internal] Number of items
     float           ItemsHeight;        // [Internal] Height of item after a first step and item submission can calculate it
+    ImGuiListClipperHeights* ItemsHeights; // [Internal] Heights storage when using BeginVariableHeight(), otherwise NULL
     double          StartPosY;          // [Internal] Cursor position at the time of Begin() or after table frozen rows are all processed
     double          StartSeekOffsetY;   // [Internal] Account for frozen rows in a table and initial loss of precision in very large windows.
     void*           TempData;           // [Internal] Internal data
@@ -2816,6 +2835,7 @@ struct ImGuiListClipper
     IMGUI_API ImGuiListClipper();
     IMGUI_API ~ImGuiListClipper();
     IMGUI_API void  Begin(int items_count, float items_height = -1.0f);
+    IMGUI_API void  BeginVariableHeight(int items_count, ImGuiListClipperHeights* heights); // Items may have different heights, which are measured while stepping and stored in 'heights'.
     IMGUI_API void  End();             // Automatically called on the last call of Step() that returns false.
     IMGUI_API bool  Step();            // Call until it returns false. The DisplayStart/DisplayEnd fields will be set and you can process/draw those items.
 
@@ -2836,6 +2856,67 @@ struct ImGuiListClipper
 #endif
 };
 
+// Helper: Persistent storage of item heights, for ImGuiListClipper::BeginVariableHeight().
+// - Keep one instance per list alive across frames. BeginVariableHeight() resizes it to the number of items.
+// - Visible items are submitted one at a time so the clipper can measure and store their height.
+// - Items which have never been displayed are assumed to be EstimatedHeight tall (by default: the height of the first measured item).
+// - Heights are stored in a Fenwick tree (binary indexed tree): converting a scroll position to an item index,
+//   retrieving the offset of an item and updating the height of an item are all O(log N).
+// - If you insert or remove items other than at the end of your list, call Clear() or SetItemHeight(n, -1.0f) on the affected items.
+struct ImGuiListClipperHeights
+{
+    ImVector<float>     Heights;            // Measured height of each item, or -1.0f when not measured yet
+    ImVector<double>    TreeSums;           // [Internal] Fenwick tree of measured heights (1-based, TreeSums[0] is unused)
+    ImVector<int>       TreeCounts;         // [Internal] Fenwick tree of measured items count (1-based, TreeCounts[0] is unused)
+    float               EstimatedHeight;    // Height assumed for items not measured yet. Leave to -1.0f to use the height of the first measured item.
+
+    ImGuiListClipperHeights()               { EstimatedHeight = -1.0f; }
+    void                Clear()             { Heights.clear(); TreeSums.clear(); TreeCounts.clear(); }
+    int                 GetItemsCount() const { return Heights.Size; }
+    double              GetTotalHeight() const { return GetItemOffset(Heights.Size); }
+    IMGUI_API void      Resize(int items_count);                        // New items are added at the end, unmeasured.
+    IMGUI_API void      SetItemHeight(int item_n, float height);        // Pass -1.0f to forget a measurement (e.g. after modifying the item contents).
+    IMGUI_API float     GetItemHeight(int item_n) const;                // Return measured height, or estimated height if not measured yet.
+    IMGUI_API double    GetItemOffset(int item_n) const;                // Return sum of heights of items before 'item_n'.
+    IMGUI_API int       FindItemAtOffset(double offset) const;          // Return index of item overlapping 'offset', clamped to valid range.
+};
+
+// Helper: Sort rows of a table according to its sort specs, without writing a comparator.
+// - Call SetColumnKey() once per sortable column to describe where its key is stored: address for row 0 + stride between rows.
+//   e.g. sorter.SetColumnKey(1, ImGuiDataType_S32, &items[0].Quantity, sizeof(items[0]));
+//   All scalar types are supported, plus ImGuiDataType_Bool and ImGuiDataType_String (pointing to a 'const char*' field).
+// - Call Sort() when sort specs are dirty. Indices[] then holds a permutation of rows in display order:
+//   display row 'n' is your item 'Indices[n]'. Sorting is stable: rows with equal keys preserve their relative order.
+// - Each sort key is applied with a stable LSD radix sort pass, from lowest to highest priority. The result after each pass
+//   is kept, so when sort specs change only the passes for changed keys are redone. e.g. changing the primary key of a
+//   multi-key sort, or flipping its direction, only redo one pass.
+// - Call ClearCache() after modifying your data, else results would be reused. SetColumnKey() with a different type/address/stride already does it.
+// - Optionally set ParallelFor (same contract as ImFontAtlas::ParallelFor) to split passes over very large row counts (>= 100000) into chunks processed in parallel.
+struct ImGuiTableSorterKey
+{
+    ImGuiDataType               DataType;       // Data type of key, or -1 if not set
+    const void*                 Data;           // Address of key for row 0
+    size_t                      Stride;         // Stride between rows
+    int                         RanksOffset;    // For ImGuiDataType_String: offset of cached ranks in ImGuiTableSorter::StringRanks[], or -1 if not computed yet
+};
+
+struct ImGuiTableSorter
+{
+    ImVector<int>               Indices;        // Output: sorted row indices
+    ImVector<ImGuiTableSorterKey> Keys;         // [Internal] Per column index
+    ImVector<ImGuiTableColumnSortSpecs> CachedSpecs; // [Internal] Specs applied by last Sort()
+    ImVector<int>               CachedPasses;   // [Internal] Row indices after each pass but the last one, lowest priority pass first: (CachedSpecs.Size - 1) * RowsCount
+    ImVector<ImU32>             StringRanks;    // [Internal] Rank of each row's string (equal strings share a rank), for string columns used so far
+    int                         RowsCount;      // [Internal] Rows count for cached data
+    ImFontAtlasParallelForFunc  ParallelFor;    // = NULL   // Optional: run 'jobs_count' independent jobs, possibly in parallel, and return once they are all done. Default to sorting on the calling thread.
+    void*                       ParallelForUserData;// = NULL // User data passed to ParallelFor.
+
+    ImGuiTableSorter()          { RowsCount = 0; ParallelFor = NULL; ParallelForUserData = NULL; }
+    IMGUI_API void              SetColumnKey(int column_index, ImGuiDataType data_type, const void* p_data, size_t stride);
+    IMGUI_API void              Sort(const ImGuiTableSortSpecs* sort_specs, int rows_count); // Doesn't clear sort_specs->SpecsDirty: do it yourself.
+    IMGUI_API void              ClearCache();
+};
+
 // Helpers: ImVec2/ImVec4 operators
 // - It is important that we are keeping those disabled by default so they don't leak in user space.
 // - This is in order to allow user enabling implicit cast operators between ImVec2/ImVec4 and their own types (using IM_VEC2_CLASS_EXTRA in imconfig.h)
@@ -3066,7 +3147,7 @@ struct ImGuiSelectionExternalStorage
 };
 
 //-----------------------------------------------------------------------------
-// [SECTION] Drawing API (ImDrawCmd, ImDrawIdx, ImDrawVert, ImDrawChannel, ImDrawListSplitter, ImDrawListFlags, ImDrawList, ImDrawData)
+// [SECTION] Drawing API (ImDrawCmd, ImDrawIdx, ImDrawVert, ImDrawChannel, ImDrawListSplitter, ImDrawListFlags, ImDrawList, ImDrawData, ImDrawDataDamageTracker)
 // Hold a series of drawing commands. The user provides a renderer for ImDrawData which essentially contains an array of ImDrawList.
 //-----------------------------------------------------------------------------
 
@@ -3078,6 +3159,7 @@ struct ImGuiSelectionExternalStorage
 // ImDrawIdx: vertex index. [Compile-time configurable type]
 // - To use 16-bit indices + allow large meshes: backend need to set 'io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset' and handle ImDrawCmd::VtxOffset (recommended).
 // - To use 32-bit indices: override with '#define ImDrawIdx unsigned int' in your imconfig.h file.
+//   Most draw lists have less than 64K vertices: backends may still upload their indices as 16-bit to save bandwidth, see ImDrawList::CalcIdxSize().
 #ifndef ImDrawIdx
 typedef unsigned short ImDrawIdx;   // Default: 16-bit (for maximum compatibility with renderer backends)
 #endif
@@ -3099,6 +3181,11 @@ typedef void (*ImDrawCallback)(const ImDrawList* parent_list, const ImDrawCmd* c
 // Render state is not reset by default because they are many perfectly useful way of altering render state (e.g. changing shader/blending settings before an Image call).
 #define ImDrawCallback_ResetRenderState     (ImDrawCallback)(-8)
 
+// Special Draw callback value to request renderer backend to interpret the alpha channel of following textured triangles as a signed distance field.
+// Emitted by ImDrawList when rendering text with a ImFontFlags_SDF font. Back to normal rendering after the next ImDrawCallback_ResetRenderState, or at the end of the ImDrawList.
+// Backends using those fonts need to handle this value and set ImGuiBackendFlags_RendererHasSdfFonts. See IM_FONT_SDF_ONEDGE_VALUE for the sampling math.
+#define ImDrawCallback_SetSdfRenderState    (ImDrawCallback)(-7)
+
 // Typically, 1 command = 1 GPU draw call (unless command is a callback)
 // - VtxOffset: When 'io.BackendFlags & ImGuiBackendFlags_RendererHasVtxOffset' is enabled,
 //   this fields allow us to render meshes larger than 64K vertices while keeping 16-bit indices.
@@ -3124,7 +3211,26 @@ struct ImDrawCmd
 };
 
 // Vertex layout
-#ifndef IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT
+#if defined(IMGUI_USE_PACKED_DRAWVERT)
+// Packed vertex layout (12 bytes instead of 20), enabled by '#define IMGUI_USE_PACKED_DRAWVERT' in imconfig.h. Renderer backend needs to decode it:
+// - pos: 12.4 signed fixed-point, relative to the parent ImDrawList::VtxPosOrigin: position = VtxPosOrigin + pos[] / IM_DRAWVERT_PACKED_POS_SCALE.
+// - uv:  16-bit normalized: uv = uv[] / IM_DRAWVERT_PACKED_UV_SCALE. Texture coordinates outside of 0..1 range are clamped.
+// Use ImDrawList::GetVtxPos()/GetVtxUV() to decode on CPU side, or decode in your vertex shader (e.g. with a signed/unsigned 16-bit integer vertex attribute).
+#ifdef IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT
+#error "IMGUI_USE_PACKED_DRAWVERT and IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT cannot be used together."
+#endif
+#define IM_DRAWVERT_PACKED_POS_SCALE    16.0f
+#define IM_DRAWVERT_PACKED_UV_SCALE     65535.0f
+struct ImDrawVert
+{
+    ImS16   pos[2];
+    ImU16   uv[2];
+    ImU32   col;
+
+    static inline ImS16 PackPos(float v)    { v *= IM_DRAWVERT_PACKED_POS_SCALE; v = (v < -32768.0f) ? -32768.0f : (v > 32767.0f) ? 32767.0f : v; return (ImS16)(int)(v >= 0.0f ? v + 0.5f : v - 0.5f); }
+    static inline ImU16 PackUV(float v)     { v = (v < 0.0f) ? 0.0f : (v > 1.0f) ? 1.0f : v; return (ImU16)(int)(v * IM_DRAWVERT_PACKED_UV_SCALE + 0.5f); }
+};
+#elif !defined(IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
 struct ImDrawVert
 {
     ImVec2  pos;
@@ -3136,6 +3242,7 @@ struct ImDrawVert
 // The code expect ImVec2 pos (8 bytes), ImVec2 uv (8 bytes), ImU32 col (4 bytes), but you can re-order them or add other fields as needed to simplify integration in your engine.
 // The type has to be described within the macro (you can either declare the struct or use a typedef). This is because ImVec2/ImU32 are likely not declared at the time you'd want to set your type up.
 // NOTE: IMGUI DOESN'T CLEAR THE STRUCTURE AND DOESN'T CALL A CONSTRUCTOR SO ANY CUSTOM FIELD WILL BE UNINITIALIZED. IF YOU ADD EXTRA FIELDS (SUCH AS A 'Z' COORDINATES) YOU WILL NEED TO CLEAR THEM DURING RENDER OR TO IGNORE THEM.
+// You may also define IMGUI_OVERRIDE_DRAWVERT_STRUCT_INIT(_VTX) in imconfig.h to initialize them when they are reserved, e.g. '#define IMGUI_OVERRIDE_DRAWVERT_STRUCT_INIT(_VTX) (_VTX)->z = 0.0f'.
 IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT;
 #endif
 
@@ -3167,7 +3274,7 @@ struct ImDrawListSplitter
     inline void                 Clear() { _Current = 0; _Count = 1; } // Do not clear Channels[] so our allocations are reused next frame
     IMGUI_API void              ClearFreeMemory();
     IMGUI_API void              Split(ImDrawList* draw_list, int count);
-    IMGUI_API void              Merge(ImDrawList* draw_list);
+    IMGUI_API void              Merge(ImDrawList* draw_list, const int* channels_order = NULL); // Optionally pass _Count channel indices (starting with 0) to append channels in a different order.
     IMGUI_API void              SetCurrentChannel(ImDrawList* draw_list, int channel_idx);
 };
 
@@ -3231,7 +3338,11 @@ struct ImDrawList
     ImVector<ImTextureRef>  _TextureStack;      // [Internal]
     ImVector<ImU8>          _CallbacksDataBuf;  // [Internal]
     float                   _FringeScale;       // [Internal] anti-alias fringe is scaled by this value, this helps to keep things sharp while zooming at vertex buffer content
+    bool                    _SdfActive;         // [Internal] ImDrawCallback_SetSdfRenderState was emitted and not reset yet
     const char*             _OwnerName;         // Pointer to owner window's name for debugging
+#ifdef IMGUI_USE_PACKED_DRAWVERT
+    ImVec2                  VtxPosOrigin;       // Origin of packed vertex positions (see ImDrawVert). Set to the center of the first clipping rectangle pushed into the list, generally the viewport or parent window.
+#endif
 
     // If you want to create ImDrawList instances, pass them ImGui::GetDrawListSharedData().
     // (advanced: you may create and use your own ImDrawListSharedData so you can use ImDrawList without ImGui, but that's more involved)
@@ -3317,6 +3428,7 @@ struct ImDrawList
     // Advanced: Miscellaneous
     IMGUI_API void  AddDrawCmd();                                               // This is useful if you need to forcefully create a new draw call (to allow for dependent rendering / blending). Otherwise primitives are merged into the same draw-call as much as possible
     IMGUI_API ImDrawList* CloneOutput() const;                                  // Create a clone of the CmdBuffer/IdxBuffer/VtxBuffer.
+    inline    int   CalcIdxSize() const { return (sizeof(ImDrawIdx) == 2 || VtxBuffer.Size <= (1 << 16)) ? 2 : 4; } // Smallest index size (2 or 4 bytes) able to represent IdxBuffer[] values. With 32-bit ImDrawIdx, backends may narrow indices of lists returning 2.
 
     // Advanced: Channels
     // - Use to split render into layers. By switching channels to can render out-of-order (e.g. submit FG primitives before BG primitives)
@@ -3336,10 +3448,22 @@ struct ImDrawList
     IMGUI_API void  PrimRect(const ImVec2& a, const ImVec2& b, ImU32 col);      // Axis aligned rectangle (composed of two triangles)
     IMGUI_API void  PrimRectUV(const ImVec2& a, const ImVec2& b, const ImVec2& uv_a, const ImVec2& uv_b, ImU32 col);
     IMGUI_API void  PrimQuadUV(const ImVec2& a, const ImVec2& b, const ImVec2& c, const ImVec2& d, const ImVec2& uv_a, const ImVec2& uv_b, const ImVec2& uv_c, const ImVec2& uv_d, ImU32 col);
-    inline    void  PrimWriteVtx(const ImVec2& pos, const ImVec2& uv, ImU32 col)    { _VtxWritePtr->pos = pos; _VtxWritePtr->uv = uv; _VtxWritePtr->col = col; _VtxWritePtr++; _VtxCurrentIdx++; }
+    inline    void  PrimWriteVtx(const ImVec2& pos, const ImVec2& uv, ImU32 col)    { SetVtx(_VtxWritePtr, pos, uv, col); _VtxWritePtr++; _VtxCurrentIdx++; }
     inline    void  PrimWriteIdx(ImDrawIdx idx)                                     { *_IdxWritePtr = idx; _IdxWritePtr++; }
     inline    void  PrimVtx(const ImVec2& pos, const ImVec2& uv, ImU32 col)         { PrimWriteIdx((ImDrawIdx)_VtxCurrentIdx); PrimWriteVtx(pos, uv, col); } // Write vertex with unique index
 
+    // Advanced: Vertices encoding/decoding
+    // - Always use those to access ImDrawVert::pos/uv so your code works with IMGUI_USE_PACKED_DRAWVERT. Otherwise they are simple field accesses.
+#ifdef IMGUI_USE_PACKED_DRAWVERT
+    inline    void  SetVtx(ImDrawVert* vtx, const ImVec2& pos, const ImVec2& uv, ImU32 col) const { vtx->pos[0] = ImDrawVert::PackPos(pos.x - VtxPosOrigin.x); vtx->pos[1] = ImDrawVert::PackPos(pos.y - VtxPosOrigin.y); vtx->uv[0] = ImDrawVert::PackUV(uv.x); vtx->uv[1] = ImDrawVert::PackUV(uv.y); vtx->col = col; }
+    inline    ImVec2 GetVtxPos(const ImDrawVert& vtx) const                         { return ImVec2(VtxPosOrigin.x + vtx.pos[0] * (1.0f / IM_DRAWVERT_PACKED_POS_SCALE), VtxPosOrigin.y + vtx.pos[1] * (1.0f / IM_DRAWVERT_PACKED_POS_SCALE)); }
+    inline    ImVec2 GetVtxUV(const ImDrawVert& vtx) const                          { return ImVec2(vtx.uv[0] * (1.0f / IM_DRAWVERT_PACKED_UV_SCALE), vtx.uv[1] * (1.0f / IM_DRAWVERT_PACKED_UV_SCALE)); }
+#else
+    inline    void  SetVtx(ImDrawVert* vtx, const ImVec2& pos, const ImVec2& uv, ImU32 col) const { vtx->pos = pos; vtx->uv = uv; vtx->col = col; }
+    inline    ImVec2 GetVtxPos(const ImDrawVert& vtx) const                         { return vtx.pos; }
+    inline    ImVec2 GetVtxUV(const ImDrawVert& vtx) const                          { return vtx.uv; }
+#endif
+
     // Obsolete names
 #ifndef IMGUI_DISABLE_OBSOLETE_FUNCTIONS
     inline    void  PushTextureID(ImTextureRef tex_ref) { PushTexture(tex_ref); }   // RENAMED in 1.92.x
@@ -3361,6 +3485,7 @@ struct ImDrawList
     IMGUI_API void  _OnChangedTexture();
     IMGUI_API void  _OnChangedVtxOffset();
     IMGUI_API void  _SetTexture(ImTextureRef tex_ref);
+    IMGUI_API void  _SetSdfRenderState(bool sdf);
     IMGUI_API int   _CalcCircleAutoSegmentCount(float radius) const;
     IMGUI_API void  _PathArcToFastEx(const ImVec2& center, float radius, int a_min_sample, int a_max_sample, int a_step);
     IMGUI_API void  _PathArcToN(const ImVec2& center, float radius, float a_min, float a_max, int num_segments);
@@ -3375,6 +3500,7 @@ struct ImDrawData
     int                 CmdListsCount;      // == CmdLists.Size. (OBSOLETE: exists for legacy reasons). Number of ImDrawList* to render.
     int                 TotalIdxCount;      // For convenience, sum of all ImDrawList's IdxBuffer.Size
     int                 TotalVtxCount;      // For convenience, sum of all ImDrawList's VtxBuffer.Size
+    int                 TotalIdx32Count;    // For convenience, sum of IdxBuffer.Size of ImDrawList requiring 32-bit indices (CalcIdxSize() == 4). Always 0 with 16-bit ImDrawIdx. Other indices fit in 16-bit.
     ImVector<ImDrawList*> CmdLists;         // Array of ImDrawList* to render. The ImDrawLists are owned by ImGuiContext and only pointed to from here.
     ImVec2              DisplayPos;         // Top-left position of the viewport to render (== top-left of the orthogonal projection matrix to use) (== GetMainViewport()->Pos for the main viewport, == (0.0) in most single-viewport applications)
     ImVec2              DisplaySize;        // Size of the viewport to render (== GetMainViewport()->Size for the main viewport, == io.DisplaySize in most single-viewport applications)
@@ -3388,6 +3514,38 @@ struct ImDrawData
     IMGUI_API void  AddDrawList(ImDrawList* draw_list);     // Helper to add an external draw list into an existing ImDrawData.
     IMGUI_API void  DeIndexAllBuffers();                    // Helper to convert all buffers from indexed to non-indexed, in case you cannot render indexed. Note: this is slow and most likely a waste of resources. Always prefer indexed rendering!
     IMGUI_API void  ScaleClipRects(const ImVec2& fb_scale); // Helper to scale the ClipRect field of each ImDrawCmd. Use if your final output buffer is at a different scale than Dear ImGui expects, or if there is a difference between your window resolution and framebuffer resolution.
+    IMGUI_API bool  MergeDrawLists(ImDrawList* out_list, ImGuiContext* ctx, int* out_cmds_before = NULL, int* out_cmds_after = NULL); // Helper to merge all draw lists into 'out_list' (which must stay alive until rendered) and join consecutive draw commands when it doesn't change the output, to reduce the number of draw calls. Call after Render(), before your backend RenderDrawData() function. 'ctx' is the context which rendered this ImDrawData (e.g. ImGui::GetCurrentContext()), its io.BackendFlags are used.
+};
+
+// Helper to compute which rectangles of the screen may have changed between two consecutive ImDrawData.
+// - Triangles are grouped into small chunks (boundaries are derived from contents, so an insertion doesn't shift every following chunk), chunks are hashed and matched against previous frame.
+// - Unmatched or reordered chunks, from both frames, are reported as damaged. Call Update() after Render(), then e.g. only clear and redraw DamageRects[].
+// - User callbacks are assumed to only draw within their clipping rectangle, and to draw the same thing when their callback and data pointers are unchanged.
+// - Render state callbacks (ImDrawCallback_ResetRenderState, ImDrawCallback_SetSdfRenderState) don't damage anything by themselves: the state is part of following triangles hashes.
+// - Contents of user textures are assumed to be constant. Call Invalidate() after modifying one, to redraw everything on next Update().
+struct ImDrawDataDamageChunk
+{
+    ImU32               Hash;               // Hash of triangles, texture and scissor rectangle
+    int                 Order;              // Position in draw order. Set to -1 once matched.
+    ImVec4              Rect;               // Bounding rectangle in framebuffer pixels (x1,y1,x2,y2)
+};
+
+struct ImDrawDataDamageTracker
+{
+    ImVector<ImVec4>    DamageRects;        // Output: non-overlapping rectangles (x1,y1,x2,y2) in framebuffer pixels which may have changed since last Update(). Empty when nothing changed.
+    bool                FullDamage;         // Output: true when whole framebuffer needs to be redrawn (first frame, display size/position/scale changed, Invalidate() called).
+    int                 DamageRectsMax;     // Maximum number of rectangles. Above that, all rectangles are merged into one. Default to 16.
+
+    // [Internal]
+    ImVector<ImDrawDataDamageChunk> _PrevChunks;
+    ImVector<ImDrawDataDamageChunk> _CurrChunks;
+    ImU32               _PrevDisplayKey;    // Hash of DisplayPos, DisplaySize, FramebufferScale
+    bool                _PrevValid;
+
+    ImDrawDataDamageTracker()   { FullDamage = false; DamageRectsMax = 16; _PrevDisplayKey = 0; _PrevValid = false; }
+    void                Invalidate() { _PrevValid = false; }
+    IMGUI_API void      Update(const ImDrawData* draw_data);
+    IMGUI_API void      AddDamageRect(const ImVec4& rect);
 };
 
 //-----------------------------------------------------------------------------
@@ -3421,6 +3579,7 @@ enum ImTextureStatus
 // Coordinates of a rectangle within a texture.
 // When a texture is in ImTextureStatus_WantUpdates state, we provide a list of individual rectangles to copy to the graphics system.
 // You may use ImTextureData::Updates[] for the list, or ImTextureData::UpdateBox for a single bounding box.
+// For font atlas textures, adjacent rectangles of Updates[] are merged during Render() (see ImFontAtlas::TexUpdatesMergeWaste).
 struct ImTextureRect
 {
     unsigned short      x, y;       // Upper-left coordinates of rectangle to update
@@ -3510,6 +3669,7 @@ struct ImFontConfig
     ImFont*         DstFont;                // Target font (as we merging fonts, multiple ImFontConfig may target the same font)
     const ImFontLoader* FontLoader;         // Custom font backend for this source (default source is the one stored in ImFontAtlas)
     void*           FontLoaderData;         // Font loader opaque storage (per font config)
+    ImGuiID         FontDataHash;           // Hash of FontData[], computed on demand (used by glyph cache)
 
     IMGUI_API ImFontConfig();
 };
@@ -3521,10 +3681,11 @@ struct ImFontGlyph
     unsigned int    Colored : 1;        // Flag to indicate glyph is colored and should generally ignore tinting (make it usable with no shift on little-endian as this is used in loops)
     unsigned int    Visible : 1;        // Flag to indicate glyph has no visible pixels (e.g. space). Allow early out when rendering.
     unsigned int    SourceIdx : 4;      // Index of source in parent font
-    unsigned int    Codepoint : 26;     // 0x0000..0x10FFFF
+    unsigned int    TexPage : 5;        // Index of atlas texture page holding the glyph pixels. Always 0 unless using ImFontAtlasFlags_MultiPage.
+    unsigned int    Codepoint : 21;     // 0x0000..0x10FFFF
     float           AdvanceX;           // Horizontal distance to advance cursor/layout position.
     float           X0, Y0, X1, Y1;     // Glyph corners. Offsets from current cursor/layout position.
-    float           U0, V0, U1, V1;     // Texture coordinates for the current value of ImFontAtlas->TexRef. Cached equivalent of calling GetCustomRect() with PackId.
+    float           U0, V0, U1, V1;     // Texture coordinates for the current texture of page TexPage (== ImFontAtlas->TexRef for page 0). Cached equivalent of calling GetCustomRect() with PackId.
     int             PackId;             // [Internal] ImFontAtlasRectId value (FIXME: Cold data, could be moved elsewhere?)
 
     ImFontGlyph()   { memset(this, 0, sizeof(*this)); PackId = -1; }
@@ -3570,6 +3731,7 @@ enum ImFontAtlasFlags_
     ImFontAtlasFlags_NoPowerOfTwoHeight = 1 << 0,   // Don't round the height to next power of two
     ImFontAtlasFlags_NoMouseCursors     = 1 << 1,   // Don't build software mouse cursors into the atlas (save a little texture memory)
     ImFontAtlasFlags_NoBakedLines       = 1 << 2,   // Don't build thick line textures into the atlas (save a little texture memory, allow support for point/nearest filtering). The AntiAliasedLinesUseTex features uses them, otherwise they will be rendered using polygons (more expensive for CPU/GPU).
+    ImFontAtlasFlags_MultiPage          = 1 << 3,   // Once the texture reached TexMaxWidth x TexMaxHeight, add new glyphs to additional textures ("pages") of that size instead of repacking everything. Requires ImGuiBackendFlags_RendererHasTextures. Text draw commands switch texture per page: set TexMinWidth/TexMinHeight to the same values to never grow the first page either.
 };
 
 // Load and rasterize multiple TTF/OTF fonts into a same texture. The font atlas will build a single texture holding:
@@ -3607,6 +3769,15 @@ struct ImFontAtlas
     IMGUI_API void              CompactCache();             // Compact cached glyphs and texture.
     IMGUI_API void              SetFontLoader(const ImFontLoader* font_loader); // Change font loader at runtime.
 
+    // Persistent cache of baked glyphs
+    // - Rasterized glyphs (metrics + pixels) of all currently baked fonts may be saved to a file, and reused on next run instead of rasterizing them again.
+    // - Entries are identified by a hash of font data, size, rasterizer density, oversampling, loader and other settings affecting output: stale entries are simply not used.
+    // - LoadGlyphCacheFromMemory() uses data in place without copying it, e.g. from a memory-mapped file. Data needs to stay valid until the atlas is destroyed or another cache is loaded.
+    // - Glyphs missing from the cache are loaded normally. Saving merges currently baked glyphs with entries from the loaded cache.
+    IMGUI_API bool              LoadGlyphCacheFromFile(const char* filename);
+    IMGUI_API bool              LoadGlyphCacheFromMemory(const void* data, size_t data_size);
+    IMGUI_API bool              SaveGlyphCacheToFile(const char* filename);
+
     // As we are transitioning toward a new font system, we expect to obsolete those soon:
     IMGUI_API void              ClearInputData();           // [OBSOLETE] Clear input data (all ImFontConfig structures including sizes, TTF data, glyph ranges, etc.) = all the data used to build the texture and fonts.
     IMGUI_API void              ClearFonts();               // [OBSOLETE] Clear input+output font data (same as ClearInputData() + glyphs storage, UV coordinates).
@@ -3687,7 +3858,10 @@ struct ImFontAtlas
     int                         TexMinHeight;       // Minimum desired texture height. Must be a power of two. Default to 128.
     int                         TexMaxWidth;        // Maximum desired texture width. Must be a power of two. Default to 8192.
     int                         TexMaxHeight;       // Maximum desired texture height. Must be a power of two. Default to 8192.
+    float                       TexUpdatesMergeWaste; // Before rendering, merge texture update rectangles (ImTextureData::Updates[]) when no more than this fraction of the merged rectangle wasn't requested. Default to 0.50f (fewer and larger uploads, at worst twice the pixels). 0.0f only merges when the union has no unrequested pixels (e.g. touching rectangles sharing a full edge, or exact tilings): touching rectangles of different heights/offsets are not merged. -1.0f disables merging.
     void*                       UserData;           // Store your own atlas related user-data (if e.g. you have multiple font atlas).
+    ImFontAtlasParallelForFunc  ParallelFor;        // = NULL   // Optional: run 'jobs_count' independent jobs, possibly in parallel, and return once they are all done. Used to rasterize glyphs on multiple threads when many glyphs are baked at once (new font size, new text). Default to running them on the calling thread.
+    void*                       ParallelForUserData;// = NULL   // User data passed to ParallelFor.
 
     // Output
     // - Because textures are dynamically created/resized, the current texture identifier may changed at *ANY TIME* during the frame.
@@ -3700,7 +3874,7 @@ struct ImFontAtlas
     ImTextureData*              TexData;            // Latest texture.
 
     // [Internal]
-    ImVector<ImTextureData*>    TexList;            // Texture list (most often TexList.Size == 1). TexData is always == TexList.back(). DO NOT USE DIRECTLY, USE GetDrawData().Textures[]/GetPlatformIO().Textures[] instead!
+    ImVector<ImTextureData*>    TexList;            // Texture list (most often TexList.Size == 1). Also holds the additional pages of a ImFontAtlasFlags_MultiPage atlas. DO NOT USE DIRECTLY, USE GetDrawData().Textures[]/GetPlatformIO().Textures[] instead!
     bool                        Locked;             // Marked as locked during ImGui::NewFrame()..EndFrame() scope if TexUpdates are not supported. Any attempt to modify the atlas will assert.
     bool                        RendererHasTextures;// Copy of (BackendFlags & ImGuiBackendFlags_RendererHasTextures) from supporting context.
     bool                        TexIsBuilt;         // Set when texture was built matching current font input. Mostly useful for legacy IsBuilt() call.
@@ -3712,8 +3886,10 @@ struct ImFontAtlas
     ImVec4                      TexUvLines[IM_DRAWLIST_TEX_LINES_WIDTH_MAX + 1];  // UVs for baked anti-aliased lines
     int                         TexNextUniqueID;    // Next value to be stored in TexData->UniqueID
     int                         FontNextUniqueID;   // Next value to be stored in ImFont->FontID
+    int                         BakedGeneration;    // Incremented when advances of existing baked fonts may change (baked font or glyph discarded). Used to invalidate cached text layouts.
     ImVector<ImDrawListSharedData*> DrawListSharedDatas; // List of users for this atlas. Typically one per Dear ImGui context.
     ImFontAtlasBuilder*         Builder;            // Opaque interface to our data that doesn't need to be public and may be discarded when rebuilding.
+    ImFontAtlasGlyphCache*      GlyphCache;         // Opaque storage for persistent glyph cache, if any was loaded.
     const ImFontLoader*         FontLoader;         // Font loader opaque interface (default to use FreeType when IMGUI_ENABLE_FREETYPE is defined, otherwise default to use stb_truetype). Use SetFontLoader() to change this at runtime.
     const char*                 FontLoaderName;     // Font loader name (for display e.g. in About box) == FontLoader->Name
     void*                       FontLoaderData;     // Font backend opaque storage
@@ -3781,8 +3957,28 @@ enum ImFontFlags_
     ImFontFlags_NoLoadError             = 1 << 1,   // Disable throwing an error/assert when calling AddFontXXX() with missing file/data. Calling code is expected to check AddFontXXX() return value.
     ImFontFlags_NoLoadGlyphs            = 1 << 2,   // [Internal] Disable loading new glyphs.
     ImFontFlags_LockBakedSizes          = 1 << 3,   // [Internal] Disable loading new baked sizes, disable garbage collecting current ones. e.g. if you want to lock a font to a single size. Important: if you use this to preload given sizes, consider the possibility of multiple font density used on Retina display.
+    ImFontFlags_SDF                     = 1 << 4,   // Bake glyphs once as signed distance fields and scale them to any size. Set in ImFontConfig::Flags. Requires ImGuiBackendFlags_RendererHasSdfFonts.
 };
 
+// Signed distance field fonts (ImFontFlags_SDF)
+// - Glyphs are baked once at IMGUI_FONT_SDF_BAKE_SIZE (see imgui_internal.h) and every font size uses this bake, scaled.
+// - Texel alpha stores the distance to the glyph outline: 'dist_in_texels = (alpha - IM_FONT_SDF_ONEDGE_VALUE) / IM_FONT_SDF_PIXEL_DIST_SCALE', positive inside.
+// - Renderer backends need to turn this distance into coverage, accounting for the number of texels covered by one output pixel:
+//     texels_per_pixel = length of the screen-space derivative of (uv * texture_size) (e.g. fwidth(), or max of per-axis lengths)
+//     coverage = saturate(dist_in_texels / texels_per_pixel + 0.5)
+//     output = vertex_color * float4(1, 1, 1, coverage)
+//   This only applies between ImDrawCallback_SetSdfRenderState and ImDrawCallback_ResetRenderState. Untextured (constant UV) triangles are unaffected.
+// - Reference pixel shader for GPU backends (HLSL):
+//     float4 main(PS_INPUT input) : SV_Target
+//     {
+//         float d = (texture0.Sample(sampler0, input.uv).a * 255.0 - IM_FONT_SDF_ONEDGE_VALUE) / IM_FONT_SDF_PIXEL_DIST_SCALE;
+//         float2 tpp2 = fwidth(input.uv * texture_size);
+//         float tpp = max(max(tpp2.x, tpp2.y), 1.0 / 65536.0);
+//         return float4(input.col.rgb, input.col.a * saturate(d / tpp + 0.5));
+//     }
+#define IM_FONT_SDF_ONEDGE_VALUE            128     // Alpha value on the outline
+#define IM_FONT_SDF_PIXEL_DIST_SCALE        32.0f   // Alpha increment per texel of distance (128 / 32 = 4 texels of distance each side of the outline)
+
 // Font runtime data and rendering
 // - ImFontAtlas automatically loads a default embedded font for you if you didn't load one manually.
 // - Since 1.92.X a font may be rendered as any size! Therefore a font doesn't have one specific size.
@@ -577,6 +577,7 @@ void ImGui::ShowDemoWindow(bool* p_open)
             ImGui::CheckboxFlags("io.BackendFlags: HasSetMousePos",       &io.BackendFlags, ImGuiBackendFlags_HasSetMousePos);
             ImGui::CheckboxFlags("io.BackendFlags: RendererHasVtxOffset", &io.BackendFlags, ImGuiBackendFlags_RendererHasVtxOffset);
             ImGui::CheckboxFlags("io.BackendFlags: RendererHasTextures",  &io.BackendFlags, ImGuiBackendFlags_RendererHasTextures);
+            ImGui::CheckboxFlags("io.BackendFlags: RendererHasSdfFonts",  &io.BackendFlags, ImGuiBackendFlags_RendererHasSdfFonts);
             ImGui::EndDisabled();
 
             ImGui::TreePop();
@@ -5491,6 +5492,7 @@ struct MyItem
     // In your own use case you would probably pass the sort specs to your sorting/comparing functions directly and not use a global.
     // We could technically call ImGui::TableGetSortSpecs() in CompareWithSortSpecs(), but considering that this function is called
     // very often by the sorting algorithm it would be a little wasteful.
+    // For large data sets, ImGuiTableSorter (see imgui.h) sorts rows from their key fields without needing a compare function.
     static const ImGuiTableSortSpecs* s_current_sort_specs;
 
     static void SortWithSortSpecs(ImGuiTableSortSpecs* sort_specs, MyItem* items, int items_count)
@@ -6242,6 +6244,49 @@ static void DemoWindowTables()
         ImGui::TreePop();
     }
 
+    if (open_action != -1)
+        ImGui::SetNextItemOpen(open_action != 0);
+    IMGUI_DEMO_MARKER("Tables/Vertical scrolling, with clipping, variable height");
+    if (ImGui::TreeNode("Vertical scrolling, with clipping, variable height"))
+    {
+        HelpMarker(
+            "Using ImGuiListClipper::BeginVariableHeight() to virtualize the submission of items of different heights.\n\n"
+            "Heights are measured as items are displayed, and stored in a persistent ImGuiListClipperHeights instance. "
+            "Items which haven't been displayed yet use an estimated height.");
+        static ImGuiTableFlags flags = ImGuiTableFlags_ScrollY | ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersOuter | ImGuiTableFlags_BordersV | ImGuiTableFlags_Resizable;
+        static ImGuiListClipperHeights heights;
+        static int items_count = 100000;
+        ImGui::SliderInt("Items count", &items_count, 0, 1000000, "%d", ImGuiSliderFlags_Logarithmic); // Heights of existing items are preserved
+        ImGui::Text("Total height: %.0f (estimated item height: %.1f)", heights.GetTotalHeight(), heights.EstimatedHeight);
+
+        ImVec2 outer_size = ImVec2(0.0f, TEXT_BASE_HEIGHT * 12);
+        if (ImGui::BeginTable("table_scrolly_variable", 2, flags, outer_size))
+        {
+            ImGui::TableSetupScrollFreeze(0, 1); // Make top row always visible
+            ImGui::TableSetupColumn("ID", ImGuiTableColumnFlags_WidthFixed);
+            ImGui::TableSetupColumn("Contents", ImGuiTableColumnFlags_WidthStretch);
+            ImGui::TableHeadersRow();
+
+            ImGuiListClipper clipper;
+            clipper.BeginVariableHeight(items_count, &heights);
+            while (clipper.Step())
+            {
+                for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; row++)
+                {
+                    ImGui::TableNextRow();
+                    ImGui::TableSetColumnIndex(0);
+                    ImGui::Text("%06d", row);
+                    ImGui::TableSetColumnIndex(1);
+                    const int lines_count = 1 + (row * 7) % 5;
+                    for (int line = 0; line < lines_count; line++)
+                        ImGui::Text("Line %d of %d", line + 1, lines_count);
+                }
+            }
+            ImGui::EndTable();
+        }
+        ImGui::TreePop();
+    }
+
     if (open_action != -1)
         ImGui::SetNextItemOpen(open_action != 0);
     IMGUI_DEMO_MARKER("Tables/Horizontal scrolling");
@@ -6330,6 +6375,40 @@ static void DemoWindowTables()
             }
             ImGui::EndTable();
         }
+
+        ImGui::Spacing();
+        ImGui::TextUnformatted("Many columns + clipper");
+        ImGui::SameLine();
+        HelpMarker(
+            "Showcase a very wide table: only visible columns are allocated a draw channel, "
+            "and using TableNextVisibleColumn() only the visible cells of each row are submitted.\n"
+            "Combined with ImGuiListClipper for rows, the cost of a frame is proportional to the number of visible cells.");
+        static int wide_columns_count = 2000;
+        PushStyleCompact();
+        ImGui::SetNextItemWidth(TEXT_BASE_WIDTH * 30);
+        ImGui::SliderInt("columns", &wide_columns_count, 1, 10000, "%d", ImGuiSliderFlags_Logarithmic);
+        PopStyleCompact();
+        if (ImGui::BeginTable("table_wide", wide_columns_count, flags, outer_size))
+        {
+            ImGui::TableSetupScrollFreeze(freeze_cols, freeze_rows);
+            for (int column = 0; column < wide_columns_count; column++)
+            {
+                char label[32];
+                sprintf(label, "Column %d", column);
+                ImGui::TableSetupColumn(label, (column == 0 ? ImGuiTableColumnFlags_NoHide : 0) | ImGuiTableColumnFlags_WidthFixed, TEXT_BASE_WIDTH * 12);
+            }
+            ImGui::TableHeadersRow();
+            ImGuiListClipper clipper;
+            clipper.Begin(10000);
+            while (clipper.Step())
+                for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; row++)
+                {
+                    ImGui::TableNextRow();
+                    while (ImGui::TableNextVisibleColumn())
+                        ImGui::Text("Cell %d,%d", ImGui::TableGetColumnIndex(), row);
+                }
+            ImGui::EndTable();
+        }
         ImGui::TreePop();
     }
 
@@ -8189,6 +8268,7 @@ void ImGui::ShowAboutWindow(bool* p_open)
         if (io.BackendFlags & ImGuiBackendFlags_HasSetMousePos)         ImGui::Text(" HasSetMousePos");
         if (io.BackendFlags & ImGuiBackendFlags_RendererHasVtxOffset)   ImGui::Text(" RendererHasVtxOffset");
         if (io.BackendFlags & ImGuiBackendFlags_RendererHasTextures)    ImGui::Text(" RendererHasTextures");
+        if (io.BackendFlags & ImGuiBackendFlags_RendererHasSdfFonts)    ImGui::Text(" RendererHasSdfFonts");
         ImGui::Separator();
         ImGui::Text("io.Fonts: %d fonts, Flags: 0x%08X, TexSize: %d,%d", io.Fonts->Fonts.Size, io.Fonts->Flags, io.Fonts->TexData->Width, io.Fonts->TexData->Height);
         ImGui::Text("io.Fonts->FontLoaderName: %s", io.Fonts->FontLoaderName ? io.Fonts->FontLoaderName : "NULL");
@@ -9803,6 +9883,21 @@ static void PathConcaveShape(ImDrawList* draw_list, float x, float y, float sz)
         draw_list->PathLineTo(ImVec2(x + 0.5f + (int)(sz * p.x), y + 0.5f + (int)(sz * p.y)));
 }
 
+// Shapes with many points and pixel-snapped coordinates: this creates duplicate consecutive points and collinear edges,
+// which concave filling needs to handle (star: y is snapped to a 3 pixels grid, ring: x and y are snapped to the pixel grid).
+static void PathSnappedConcaveShape(ImDrawList* draw_list, float x, float y, float sz, bool star)
+{
+    const int points_count = 96;
+    for (int n = 0; n < points_count; n++)
+    {
+        const float a = 6.2831853f * n / points_count;
+        const float r = (star && (n & 1)) ? sz * 0.2f : sz * 0.5f;
+        const float px = x + sz * 0.5f + cosf(a) * r;
+        const float py = y + sz * 0.5f + sinf(a) * r;
+        draw_list->PathLineTo(star ? ImVec2(px, floorf(py / 3.0f) * 3.0f) : ImVec2(floorf(px), floorf(py)));
+    }
+}
+
 // Demonstrate using the low-level ImDrawList to draw custom shapes.
 static void ShowExampleAppCustomRendering(bool* p_open)
 {
@@ -9940,9 +10035,14 @@ static void ShowExampleAppCustomRendering(bool* p_open)
             x += sz + spacing;
 
             draw_list->AddRectFilledMultiColor(ImVec2(x, y), ImVec2(x + sz, y + sz), IM_COL32(0, 0, 0, 255), IM_COL32(255, 0, 0, 255), IM_COL32(255, 255, 0, 255), IM_COL32(0, 255, 0, 255));
-            x += sz + spacing;
+            x = p.x + 4;
+            y += sz + spacing;
+
+            // Concave shapes with many points and degenerate edges (duplicate points from pixel snapping)
+            PathSnappedConcaveShape(draw_list, x, y, sz, true); draw_list->PathFillConcave(col);                    x += sz + spacing;  // Snapped star
+            PathSnappedConcaveShape(draw_list, x, y, IM_MAX(sz * 0.25f, 4.0f), false); draw_list->PathFillConcave(col); x += sz + spacing;  // Small snapped circle
 
-            ImGui::Dummy(ImVec2((sz + spacing) * 13.2f, (sz + spacing) * 3.0f));
+            ImGui::Dummy(ImVec2((sz + spacing) * 13.2f, (sz + spacing) * 4.0f));
             ImGui::PopItemWidth();
             ImGui::EndTabItem();
         }
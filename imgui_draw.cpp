@@ -11,9 +11,12 @@ Index of this file:
 // [SECTION] ImTriangulator, ImDrawList concave polygon fill
 // [SECTION] ImDrawListSplitter
 // [SECTION] ImDrawData
+// [SECTION] ImDrawDataDamageTracker
+// [SECTION] ImDrawList worker threads helpers
 // [SECTION] Helpers ShadeVertsXXX functions
 // [SECTION] ImFontConfig
 // [SECTION] ImFontAtlas, ImFontAtlasBuilder
+// [SECTION] ImFontAtlas: glyph cache
 // [SECTION] ImFontAtlas: backend for stb_truetype
 // [SECTION] ImFontAtlas: glyph ranges helpers
 // [SECTION] ImFontGlyphRangesBuilder
@@ -137,8 +140,8 @@ namespace IMGUI_STB_NAMESPACE
 #ifdef  IMGUI_ENABLE_STB_TRUETYPE
 #ifndef STB_TRUETYPE_IMPLEMENTATION                         // in case the user already have an implementation in the _same_ compilation unit (e.g. unity builds)
 #ifndef IMGUI_DISABLE_STB_TRUETYPE_IMPLEMENTATION           // in case the user already have an implementation in another compilation unit
-#define STBTT_malloc(x,u)   ((void)(u), IM_ALLOC(x))
-#define STBTT_free(x,u)     ((void)(u), IM_FREE(x))
+#define STBTT_malloc(x,u)   ((u) ? ((ImFontAtlasGlyphJobScratch*)(u))->Alloc(x) : IM_ALLOC(x))   // Glyph jobs set stbtt_fontinfo::userdata to their scratch memory, see ImFontAtlasGlyphJob.
+#define STBTT_free(x,u)     ((u) ? (void)0 : IM_FREE(x))
 #define STBTT_assert(x)     do { IM_ASSERT(x); } while(0)
 #define STBTT_fmod(x,y)     ImFmod(x,y)
 #define STBTT_sqrt(x)       ImSqrt(x)
@@ -148,6 +151,9 @@ namespace IMGUI_STB_NAMESPACE
 #define STBTT_iceil(x)      ((int)ImCeil(x))
 #define STBTT_strlen(x)     ImStrlen(x)
 #define STBTT_STATIC
+#ifdef IMGUI_ENABLE_SSE2
+#define STBTT_SSE2                                          // Vectorized scanline accumulation (output is identical to the scalar path). <emmintrin.h> is already included via imgui_internal.h.
+#endif
 #define STB_TRUETYPE_IMPLEMENTATION
 #else
 #define STBTT_DEF extern
@@ -391,11 +397,14 @@ ImDrawListSharedData::ImDrawListSharedData()
         ArcFastVtx[i] = ImVec2(ImCos(a), ImSin(a));
     }
     ArcFastRadiusCutoff = IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_CALC_R(IM_DRAWLIST_ARCFAST_SAMPLE_MAX, CircleSegmentMaxError);
+    BuildShapeTemplates();
 }
 
 ImDrawListSharedData::~ImDrawListSharedData()
 {
     IM_ASSERT(DrawLists.Size == 0);
+    for (ImFontBaked* baked : WorkerFontBakeds)
+        IM_DELETE(baked);
 }
 
 void ImDrawListSharedData::SetCircleTessellationMaxError(float max_error)
@@ -460,6 +469,10 @@ void ImDrawList::_ResetForNewFrame()
     _Splitter.Clear();
     CmdBuffer.push_back(ImDrawCmd());
     _FringeScale = _Data->InitialFringeScale;
+    _SdfActive = false;
+#ifdef IMGUI_USE_PACKED_DRAWVERT
+    VtxPosOrigin = ImVec2(0.0f, 0.0f);
+#endif
 }
 
 void ImDrawList::_ClearFreeMemory()
@@ -485,6 +498,9 @@ ImDrawList* ImDrawList::CloneOutput() const
     dst->IdxBuffer = IdxBuffer;
     dst->VtxBuffer = VtxBuffer;
     dst->Flags = Flags;
+#ifdef IMGUI_USE_PACKED_DRAWVERT
+    dst->VtxPosOrigin = VtxPosOrigin;
+#endif
     return dst;
 }
 
@@ -543,6 +559,8 @@ void ImDrawList::AddCallback(ImDrawCallback callback, void* userdata, size_t use
         _CallbacksDataBuf.resize(_CallbacksDataBuf.Size + (int)userdata_size);
         memcpy(_CallbacksDataBuf.Data + (size_t)curr_cmd->UserCallbackDataOffset, userdata, userdata_size);
     }
+    if (callback == ImDrawCallback_ResetRenderState)
+        _SdfActive = false;
 
     AddDrawCmd(); // Force a new command after us (see comment below)
 }
@@ -656,6 +674,11 @@ void ImDrawList::PushClipRect(const ImVec2& cr_min, const ImVec2& cr_max, bool i
     cr.z = ImMax(cr.x, cr.z);
     cr.w = ImMax(cr.y, cr.w);
 
+#ifdef IMGUI_USE_PACKED_DRAWVERT
+    // Packed vertex positions are relative to the center of first clipping rectangle, so they can cover it when it is up to 4096x4096.
+    if (_ClipRectStack.Size == 0 && VtxBuffer.Size == 0)
+        VtxPosOrigin = ImTrunc(ImVec2((cr.x + cr.z) * 0.5f, (cr.y + cr.w) * 0.5f));
+#endif
     _ClipRectStack.push_back(cr);
     _CmdHeader.ClipRect = cr;
     _OnChangedClipRect();
@@ -675,6 +698,8 @@ void ImDrawList::PopClipRect()
 
 void ImDrawList::PushTexture(ImTextureRef tex_ref)
 {
+    if (_SdfActive)
+        _SetSdfRenderState(false);
     _TextureStack.push_back(tex_ref);
     _CmdHeader.TexRef = tex_ref;
     if (tex_ref._TexData != NULL)
@@ -684,6 +709,8 @@ void ImDrawList::PushTexture(ImTextureRef tex_ref)
 
 void ImDrawList::PopTexture()
 {
+    if (_SdfActive)
+        _SetSdfRenderState(false);
     _TextureStack.pop_back();
     _CmdHeader.TexRef = (_TextureStack.Size == 0) ? ImTextureRef() : _TextureStack.Data[_TextureStack.Size - 1];
     _OnChangedTexture();
@@ -699,6 +726,16 @@ void ImDrawList::_SetTexture(ImTextureRef tex_ref)
     _OnChangedTexture();
 }
 
+// Switch renderer backend in and out of signed distance field sampling (see ImFontFlags_SDF). Used by ImFont::RenderText()/RenderChar().
+// Switched back off before other textured primitives (images, textured lines), when leaving a channel, and implicitly at the end of the list.
+void ImDrawList::_SetSdfRenderState(bool sdf)
+{
+    if (_SdfActive == sdf)
+        return;
+    AddCallback(sdf ? ImDrawCallback_SetSdfRenderState : ImDrawCallback_ResetRenderState, NULL);
+    _SdfActive = sdf;
+}
+
 // Reserve space for a number of vertices and indices.
 // You must finish filling your reserved data before calling PrimReserve() again, as it may reallocate or
 // submit the intermediate results. PrimUnreserve() can be used to release unused allocations.
@@ -721,6 +758,10 @@ void ImDrawList::PrimReserve(int idx_count, int vtx_count)
     int vtx_buffer_old_size = VtxBuffer.Size;
     VtxBuffer.resize(vtx_buffer_old_size + vtx_count);
     _VtxWritePtr = VtxBuffer.Data + vtx_buffer_old_size;
+#ifdef IMGUI_OVERRIDE_DRAWVERT_STRUCT_INIT
+    for (ImDrawVert* vtx = _VtxWritePtr; vtx < _VtxWritePtr + vtx_count; vtx++)
+        IMGUI_OVERRIDE_DRAWVERT_STRUCT_INIT(vtx);
+#endif
 
     int idx_buffer_old_size = IdxBuffer.Size;
     IdxBuffer.resize(idx_buffer_old_size + idx_count);
@@ -745,10 +786,10 @@ void ImDrawList::PrimRect(const ImVec2& a, const ImVec2& c, ImU32 col)
     ImDrawIdx idx = (ImDrawIdx)_VtxCurrentIdx;
     _IdxWritePtr[0] = idx; _IdxWritePtr[1] = (ImDrawIdx)(idx+1); _IdxWritePtr[2] = (ImDrawIdx)(idx+2);
     _IdxWritePtr[3] = idx; _IdxWritePtr[4] = (ImDrawIdx)(idx+2); _IdxWritePtr[5] = (ImDrawIdx)(idx+3);
-    _VtxWritePtr[0].pos = a; _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;
-    _VtxWritePtr[1].pos = b; _VtxWritePtr[1].uv = uv; _VtxWritePtr[1].col = col;
-    _VtxWritePtr[2].pos = c; _VtxWritePtr[2].uv = uv; _VtxWritePtr[2].col = col;
-    _VtxWritePtr[3].pos = d; _VtxWritePtr[3].uv = uv; _VtxWritePtr[3].col = col;
+    SetVtx(&_VtxWritePtr[0], a, uv, col);
+    SetVtx(&_VtxWritePtr[1], b, uv, col);
+    SetVtx(&_VtxWritePtr[2], c, uv, col);
+    SetVtx(&_VtxWritePtr[3], d, uv, col);
     _VtxWritePtr += 4;
     _VtxCurrentIdx += 4;
     _IdxWritePtr += 6;
@@ -760,10 +801,10 @@ void ImDrawList::PrimRectUV(const ImVec2& a, const ImVec2& c, const ImVec2& uv_a
     ImDrawIdx idx = (ImDrawIdx)_VtxCurrentIdx;
     _IdxWritePtr[0] = idx; _IdxWritePtr[1] = (ImDrawIdx)(idx+1); _IdxWritePtr[2] = (ImDrawIdx)(idx+2);
     _IdxWritePtr[3] = idx; _IdxWritePtr[4] = (ImDrawIdx)(idx+2); _IdxWritePtr[5] = (ImDrawIdx)(idx+3);
-    _VtxWritePtr[0].pos = a; _VtxWritePtr[0].uv = uv_a; _VtxWritePtr[0].col = col;
-    _VtxWritePtr[1].pos = b; _VtxWritePtr[1].uv = uv_b; _VtxWritePtr[1].col = col;
-    _VtxWritePtr[2].pos = c; _VtxWritePtr[2].uv = uv_c; _VtxWritePtr[2].col = col;
-    _VtxWritePtr[3].pos = d; _VtxWritePtr[3].uv = uv_d; _VtxWritePtr[3].col = col;
+    SetVtx(&_VtxWritePtr[0], a, uv_a, col);
+    SetVtx(&_VtxWritePtr[1], b, uv_b, col);
+    SetVtx(&_VtxWritePtr[2], c, uv_c, col);
+    SetVtx(&_VtxWritePtr[3], d, uv_d, col);
     _VtxWritePtr += 4;
     _VtxCurrentIdx += 4;
     _IdxWritePtr += 6;
@@ -774,10 +815,10 @@ void ImDrawList::PrimQuadUV(const ImVec2& a, const ImVec2& b, const ImVec2& c, c
     ImDrawIdx idx = (ImDrawIdx)_VtxCurrentIdx;
     _IdxWritePtr[0] = idx; _IdxWritePtr[1] = (ImDrawIdx)(idx+1); _IdxWritePtr[2] = (ImDrawIdx)(idx+2);
     _IdxWritePtr[3] = idx; _IdxWritePtr[4] = (ImDrawIdx)(idx+2); _IdxWritePtr[5] = (ImDrawIdx)(idx+3);
-    _VtxWritePtr[0].pos = a; _VtxWritePtr[0].uv = uv_a; _VtxWritePtr[0].col = col;
-    _VtxWritePtr[1].pos = b; _VtxWritePtr[1].uv = uv_b; _VtxWritePtr[1].col = col;
-    _VtxWritePtr[2].pos = c; _VtxWritePtr[2].uv = uv_c; _VtxWritePtr[2].col = col;
-    _VtxWritePtr[3].pos = d; _VtxWritePtr[3].uv = uv_d; _VtxWritePtr[3].col = col;
+    SetVtx(&_VtxWritePtr[0], a, uv_a, col);
+    SetVtx(&_VtxWritePtr[1], b, uv_b, col);
+    SetVtx(&_VtxWritePtr[2], c, uv_c, col);
+    SetVtx(&_VtxWritePtr[3], d, uv_d, col);
     _VtxWritePtr += 4;
     _VtxCurrentIdx += 4;
     _IdxWritePtr += 6;
@@ -790,6 +831,106 @@ void ImDrawList::PrimQuadUV(const ImVec2& a, const ImVec2& b, const ImVec2& c, c
 #define IM_FIXNORMAL2F_MAX_INVLEN2          100.0f // 500.0f (see #4053, #3366)
 #define IM_FIXNORMAL2F(VX,VY)               { float d2 = VX*VX + VY*VY; if (d2 > 0.000001f) { float inv_len2 = 1.0f / d2; if (inv_len2 > IM_FIXNORMAL2F_MAX_INVLEN2) inv_len2 = IM_FIXNORMAL2F_MAX_INVLEN2; VX *= inv_len2; VY *= inv_len2; } } (void)0
 
+// Compute normals of segments points[i]->points[i+1] for i in [i_begin, i_end), writing (dy, -dx) into out_normals[i].
+// Compute miter offsets at points[i] for i in [i_begin, i_end) from out_normals[i-1] and out_normals[i], writing points[i] + offset * scales[n] into out_points[i * scales_count + n].
+// - The SSE path processes 4 points per iteration and performs the exact same operations in the same order as IM_NORMALIZE2F_OVER_ZERO()/IM_FIXNORMAL2F(),
+//   so output is bit-identical to the scalar path (_mm_rsqrt_ps and _mm_rsqrt_ss are using the same approximation, as used by ImRsqrt()).
+// - Callers handle wrapping segments/points (closed shapes) with the scalar macros.
+static void ImDrawList_PolylineComputeNormals(const ImVec2* points, int i_begin, int i_end, ImVec2* out_normals)
+{
+    int i = i_begin;
+#ifdef IMGUI_ENABLE_SSE
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 sign_mask = _mm_set1_ps(-0.0f);
+    for (; i + 4 <= i_end; i += 4)
+    {
+        const __m128 p01 = _mm_loadu_ps(&points[i].x);          // x0 y0 x1 y1
+        const __m128 p23 = _mm_loadu_ps(&points[i + 2].x);      // x2 y2 x3 y3
+        const __m128 q01 = _mm_loadu_ps(&points[i + 1].x);
+        const __m128 q23 = _mm_loadu_ps(&points[i + 3].x);
+        __m128 dx = _mm_sub_ps(_mm_shuffle_ps(q01, q23, _MM_SHUFFLE(2, 0, 2, 0)), _mm_shuffle_ps(p01, p23, _MM_SHUFFLE(2, 0, 2, 0)));
+        __m128 dy = _mm_sub_ps(_mm_shuffle_ps(q01, q23, _MM_SHUFFLE(3, 1, 3, 1)), _mm_shuffle_ps(p01, p23, _MM_SHUFFLE(3, 1, 3, 1)));
+        const __m128 d2 = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+        const __m128 mask = _mm_cmpgt_ps(d2, zero);
+        const __m128 inv_len = _mm_or_ps(_mm_and_ps(mask, _mm_rsqrt_ps(d2)), _mm_andnot_ps(mask, one));
+        dx = _mm_mul_ps(dx, inv_len);
+        dy = _mm_mul_ps(dy, inv_len);
+        const __m128 nx = dy;
+        const __m128 ny = _mm_xor_ps(dx, sign_mask);
+        _mm_storeu_ps(&out_normals[i].x, _mm_unpacklo_ps(nx, ny));
+        _mm_storeu_ps(&out_normals[i + 2].x, _mm_unpackhi_ps(nx, ny));
+    }
+#endif
+    for (; i < i_end; i++)
+    {
+        float dx = points[i + 1].x - points[i].x;
+        float dy = points[i + 1].y - points[i].y;
+        IM_NORMALIZE2F_OVER_ZERO(dx, dy);
+        out_normals[i].x = dy;
+        out_normals[i].y = -dx;
+    }
+}
+
+static inline void ImDrawList_PolylineComputeMiterPoint(const ImVec2& point, const ImVec2& n0, const ImVec2& n1, const float* scales, int scales_count, ImVec2* out_points)
+{
+    float dm_x = (n0.x + n1.x) * 0.5f;
+    float dm_y = (n0.y + n1.y) * 0.5f;
+    IM_FIXNORMAL2F(dm_x, dm_y);
+    for (int n = 0; n < scales_count; n++)
+    {
+        out_points[n].x = point.x + dm_x * scales[n];
+        out_points[n].y = point.y + dm_y * scales[n];
+    }
+}
+
+static void ImDrawList_PolylineComputeMiterPoints(const ImVec2* points, const ImVec2* normals, int i_begin, int i_end, const float* scales, int scales_count, ImVec2* out_points)
+{
+    IM_ASSERT(i_begin >= 1);
+    int i = i_begin;
+#ifdef IMGUI_ENABLE_SSE
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 min_len2 = _mm_set1_ps(0.000001f);
+    const __m128 max_invlen2 = _mm_set1_ps(IM_FIXNORMAL2F_MAX_INVLEN2);
+    for (; i + 4 <= i_end; i += 4)
+    {
+        const __m128 n0_01 = _mm_loadu_ps(&normals[i - 1].x);
+        const __m128 n0_23 = _mm_loadu_ps(&normals[i + 1].x);
+        const __m128 n1_01 = _mm_loadu_ps(&normals[i].x);
+        const __m128 n1_23 = _mm_loadu_ps(&normals[i + 2].x);
+        __m128 dm_x = _mm_mul_ps(_mm_add_ps(_mm_shuffle_ps(n0_01, n0_23, _MM_SHUFFLE(2, 0, 2, 0)), _mm_shuffle_ps(n1_01, n1_23, _MM_SHUFFLE(2, 0, 2, 0))), half);
+        __m128 dm_y = _mm_mul_ps(_mm_add_ps(_mm_shuffle_ps(n0_01, n0_23, _MM_SHUFFLE(3, 1, 3, 1)), _mm_shuffle_ps(n1_01, n1_23, _MM_SHUFFLE(3, 1, 3, 1))), half);
+        const __m128 d2 = _mm_add_ps(_mm_mul_ps(dm_x, dm_x), _mm_mul_ps(dm_y, dm_y));
+        const __m128 mask = _mm_cmpgt_ps(d2, min_len2);
+        const __m128 inv_len2 = _mm_min_ps(_mm_div_ps(one, d2), max_invlen2);
+        const __m128 scale = _mm_or_ps(_mm_and_ps(mask, inv_len2), _mm_andnot_ps(mask, one));
+        dm_x = _mm_mul_ps(dm_x, scale);
+        dm_y = _mm_mul_ps(dm_y, scale);
+
+        const __m128 p01 = _mm_loadu_ps(&points[i].x);
+        const __m128 p23 = _mm_loadu_ps(&points[i + 2].x);
+        const __m128 p_x = _mm_shuffle_ps(p01, p23, _MM_SHUFFLE(2, 0, 2, 0));
+        const __m128 p_y = _mm_shuffle_ps(p01, p23, _MM_SHUFFLE(3, 1, 3, 1));
+        for (int n = 0; n < scales_count; n++)
+        {
+            // p + dm * s, with negative scales: p + (-(dm * |s|)) == p - dm * |s|, matching the scalar code.
+            const __m128 s = _mm_set1_ps(scales[n]);
+            const __m128 o_x = _mm_add_ps(p_x, _mm_mul_ps(dm_x, s));
+            const __m128 o_y = _mm_add_ps(p_y, _mm_mul_ps(dm_y, s));
+            const __m128 o01 = _mm_unpacklo_ps(o_x, o_y);
+            const __m128 o23 = _mm_unpackhi_ps(o_x, o_y);
+            _mm_storel_pi((__m64*)(void*)&out_points[(i + 0) * scales_count + n], o01);
+            _mm_storeh_pi((__m64*)(void*)&out_points[(i + 1) * scales_count + n], o01);
+            _mm_storel_pi((__m64*)(void*)&out_points[(i + 2) * scales_count + n], o23);
+            _mm_storeh_pi((__m64*)(void*)&out_points[(i + 3) * scales_count + n], o23);
+        }
+    }
+#endif
+    for (; i < i_end; i++)
+        ImDrawList_PolylineComputeMiterPoint(points[i], normals[i - 1], normals[i], scales, scales_count, &out_points[i * scales_count]);
+}
+
 // TODO: Thickness anti-aliased lines cap are missing their AA fringe.
 // We avoid using the ImVec2 math operators here to reduce cost to a minimum for debug/non-inlined builds.
 void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32 col, ImDrawFlags flags, float thickness)
@@ -816,7 +957,8 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
         // Do we want to draw this line using a texture?
         // - For now, only draw integer-width lines using textures to avoid issues with the way scaling occurs, could be improved.
         // - If AA_SIZE is not 1.0f we cannot use the texture path.
-        const bool use_texture = (Flags & ImDrawListFlags_AntiAliasedLinesUseTex) && (integer_thickness < IM_DRAWLIST_TEX_LINES_WIDTH_MAX) && (fractional_thickness <= 0.00001f) && (AA_SIZE == 1.0f);
+        // - While the backend samples signed distance fields (after text using a ImFontFlags_SDF font), geometry is cheaper than switching render state.
+        const bool use_texture = (Flags & ImDrawListFlags_AntiAliasedLinesUseTex) && (integer_thickness < IM_DRAWLIST_TEX_LINES_WIDTH_MAX) && (fractional_thickness <= 0.00001f) && (AA_SIZE == 1.0f) && !_SdfActive;
 
         // We should never hit this, because NewFrame() doesn't set ImDrawListFlags_AntiAliasedLinesUseTex unless ImFontAtlasFlags_NoBakedLines is off
         IM_ASSERT_PARANOID(!use_texture || !(_Data->Font->ContainerAtlas->Flags & ImFontAtlasFlags_NoBakedLines));
@@ -832,16 +974,16 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
         ImVec2* temp_points = temp_normals + points_count;
 
         // Calculate normals (tangents) for each line segment
-        for (int i1 = 0; i1 < count; i1++)
+        ImDrawList_PolylineComputeNormals(points, 0, points_count - 1, temp_normals);
+        if (closed)
         {
-            const int i2 = (i1 + 1) == points_count ? 0 : i1 + 1;
-            float dx = points[i2].x - points[i1].x;
-            float dy = points[i2].y - points[i1].y;
+            float dx = points[0].x - points[points_count - 1].x;
+            float dy = points[0].y - points[points_count - 1].y;
             IM_NORMALIZE2F_OVER_ZERO(dx, dy);
-            temp_normals[i1].x = dy;
-            temp_normals[i1].y = -dx;
+            temp_normals[points_count - 1].x = dy;
+            temp_normals[points_count - 1].y = -dx;
         }
-        if (!closed)
+        else
             temp_normals[points_count - 1] = temp_normals[points_count - 2];
 
         // If we are drawing a one-pixel-wide line without a texture, or a textured line of any width, we only need 2 or 3 vertices per point
@@ -866,29 +1008,19 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
                 temp_points[(points_count-1)*2+1] = points[points_count-1] - temp_normals[points_count-1] * half_draw_size;
             }
 
-            // Generate the indices to form a number of triangles for each line segment, and the vertices for the line edges
-            // This takes points n and n+1 and writes into n+1, with the first point in a closed line being generated from the final one (as n+1 wraps)
+            // Add temporary vertices for the outer edges, from averaged normals (offset to the outer edge of the AA area)
+            // This takes normals n and n+1 and writes into n+1, with the first point in a closed line being generated from the final one (as n+1 wraps)
+            const float edge_scales[2] = { half_draw_size, -half_draw_size };
+            ImDrawList_PolylineComputeMiterPoints(points, temp_normals, 1, points_count, edge_scales, 2, temp_points);
+            if (closed)
+                ImDrawList_PolylineComputeMiterPoint(points[0], temp_normals[points_count - 1], temp_normals[0], edge_scales, 2, &temp_points[0]);
+
+            // Generate the indices to form a number of triangles for each line segment
             // FIXME-OPT: Merge the different loops, possibly remove the temporary buffer.
             unsigned int idx1 = _VtxCurrentIdx; // Vertex index for start of line segment
             for (int i1 = 0; i1 < count; i1++) // i1 is the first point of the line segment
             {
-                const int i2 = (i1 + 1) == points_count ? 0 : i1 + 1; // i2 is the second point of the line segment
                 const unsigned int idx2 = ((i1 + 1) == points_count) ? _VtxCurrentIdx : (idx1 + (use_texture ? 2 : 3)); // Vertex index for end of segment
-
-                // Average normals
-                float dm_x = (temp_normals[i1].x + temp_normals[i2].x) * 0.5f;
-                float dm_y = (temp_normals[i1].y + temp_normals[i2].y) * 0.5f;
-                IM_FIXNORMAL2F(dm_x, dm_y);
-                dm_x *= half_draw_size; // dm_x, dm_y are offset to the outer edge of the AA area
-                dm_y *= half_draw_size;
-
-                // Add temporary vertices for the outer edges
-                ImVec2* out_vtx = &temp_points[i2 * 2];
-                out_vtx[0].x = points[i2].x + dm_x;
-                out_vtx[0].y = points[i2].y + dm_y;
-                out_vtx[1].x = points[i2].x - dm_x;
-                out_vtx[1].y = points[i2].y - dm_y;
-
                 if (use_texture)
                 {
                     // Add indices for two triangles
@@ -926,8 +1058,8 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
                 ImVec2 tex_uv1(tex_uvs.z, tex_uvs.w);
                 for (int i = 0; i < points_count; i++)
                 {
-                    _VtxWritePtr[0].pos = temp_points[i * 2 + 0]; _VtxWritePtr[0].uv = tex_uv0; _VtxWritePtr[0].col = col; // Left-side outer edge
-                    _VtxWritePtr[1].pos = temp_points[i * 2 + 1]; _VtxWritePtr[1].uv = tex_uv1; _VtxWritePtr[1].col = col; // Right-side outer edge
+                    SetVtx(&_VtxWritePtr[0], temp_points[i * 2 + 0], tex_uv0, col); // Left-side outer edge
+                    SetVtx(&_VtxWritePtr[1], temp_points[i * 2 + 1], tex_uv1, col); // Right-side outer edge
                     _VtxWritePtr += 2;
                 }
             }
@@ -936,9 +1068,9 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
                 // If we're not using a texture, we need the center vertex as well
                 for (int i = 0; i < points_count; i++)
                 {
-                    _VtxWritePtr[0].pos = points[i];              _VtxWritePtr[0].uv = opaque_uv; _VtxWritePtr[0].col = col;       // Center of line
-                    _VtxWritePtr[1].pos = temp_points[i * 2 + 0]; _VtxWritePtr[1].uv = opaque_uv; _VtxWritePtr[1].col = col_trans; // Left-side outer edge
-                    _VtxWritePtr[2].pos = temp_points[i * 2 + 1]; _VtxWritePtr[2].uv = opaque_uv; _VtxWritePtr[2].col = col_trans; // Right-side outer edge
+                    SetVtx(&_VtxWritePtr[0], points[i],              opaque_uv, col);       // Center of line
+                    SetVtx(&_VtxWritePtr[1], temp_points[i * 2 + 0], opaque_uv, col_trans); // Left-side outer edge
+                    SetVtx(&_VtxWritePtr[2], temp_points[i * 2 + 1], opaque_uv, col_trans); // Right-side outer edge
                     _VtxWritePtr += 3;
                 }
             }
@@ -962,35 +1094,20 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
                 temp_points[points_last * 4 + 3] = points[points_last] - temp_normals[points_last] * (half_inner_thickness + AA_SIZE);
             }
 
-            // Generate the indices to form a number of triangles for each line segment, and the vertices for the line edges
-            // This takes points n and n+1 and writes into n+1, with the first point in a closed line being generated from the final one (as n+1 wraps)
+            // Add temporary vertices, from averaged normals
+            // This takes normals n and n+1 and writes into n+1, with the first point in a closed line being generated from the final one (as n+1 wraps)
+            const float edge_scales[4] = { half_inner_thickness + AA_SIZE, half_inner_thickness, -half_inner_thickness, -(half_inner_thickness + AA_SIZE) };
+            ImDrawList_PolylineComputeMiterPoints(points, temp_normals, 1, points_count, edge_scales, 4, temp_points);
+            if (closed)
+                ImDrawList_PolylineComputeMiterPoint(points[0], temp_normals[points_count - 1], temp_normals[0], edge_scales, 4, &temp_points[0]);
+
+            // Generate the indices to form a number of triangles for each line segment
             // FIXME-OPT: Merge the different loops, possibly remove the temporary buffer.
             unsigned int idx1 = _VtxCurrentIdx; // Vertex index for start of line segment
             for (int i1 = 0; i1 < count; i1++) // i1 is the first point of the line segment
             {
-                const int i2 = (i1 + 1) == points_count ? 0 : (i1 + 1); // i2 is the second point of the line segment
                 const unsigned int idx2 = (i1 + 1) == points_count ? _VtxCurrentIdx : (idx1 + 4); // Vertex index for end of segment
 
-                // Average normals
-                float dm_x = (temp_normals[i1].x + temp_normals[i2].x) * 0.5f;
-                float dm_y = (temp_normals[i1].y + temp_normals[i2].y) * 0.5f;
-                IM_FIXNORMAL2F(dm_x, dm_y);
-                float dm_out_x = dm_x * (half_inner_thickness + AA_SIZE);
-                float dm_out_y = dm_y * (half_inner_thickness + AA_SIZE);
-                float dm_in_x = dm_x * half_inner_thickness;
-                float dm_in_y = dm_y * half_inner_thickness;
-
-                // Add temporary vertices
-                ImVec2* out_vtx = &temp_points[i2 * 4];
-                out_vtx[0].x = points[i2].x + dm_out_x;
-                out_vtx[0].y = points[i2].y + dm_out_y;
-                out_vtx[1].x = points[i2].x + dm_in_x;
-                out_vtx[1].y = points[i2].y + dm_in_y;
-                out_vtx[2].x = points[i2].x - dm_in_x;
-                out_vtx[2].y = points[i2].y - dm_in_y;
-                out_vtx[3].x = points[i2].x - dm_out_x;
-                out_vtx[3].y = points[i2].y - dm_out_y;
-
                 // Add indexes
                 _IdxWritePtr[0]  = (ImDrawIdx)(idx2 + 1); _IdxWritePtr[1]  = (ImDrawIdx)(idx1 + 1); _IdxWritePtr[2]  = (ImDrawIdx)(idx1 + 2);
                 _IdxWritePtr[3]  = (ImDrawIdx)(idx1 + 2); _IdxWritePtr[4]  = (ImDrawIdx)(idx2 + 2); _IdxWritePtr[5]  = (ImDrawIdx)(idx2 + 1);
@@ -1006,10 +1123,10 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
             // Add vertices
             for (int i = 0; i < points_count; i++)
             {
-                _VtxWritePtr[0].pos = temp_points[i * 4 + 0]; _VtxWritePtr[0].uv = opaque_uv; _VtxWritePtr[0].col = col_trans;
-                _VtxWritePtr[1].pos = temp_points[i * 4 + 1]; _VtxWritePtr[1].uv = opaque_uv; _VtxWritePtr[1].col = col;
-                _VtxWritePtr[2].pos = temp_points[i * 4 + 2]; _VtxWritePtr[2].uv = opaque_uv; _VtxWritePtr[2].col = col;
-                _VtxWritePtr[3].pos = temp_points[i * 4 + 3]; _VtxWritePtr[3].uv = opaque_uv; _VtxWritePtr[3].col = col_trans;
+                SetVtx(&_VtxWritePtr[0], temp_points[i * 4 + 0], opaque_uv, col_trans);
+                SetVtx(&_VtxWritePtr[1], temp_points[i * 4 + 1], opaque_uv, col);
+                SetVtx(&_VtxWritePtr[2], temp_points[i * 4 + 2], opaque_uv, col);
+                SetVtx(&_VtxWritePtr[3], temp_points[i * 4 + 3], opaque_uv, col_trans);
                 _VtxWritePtr += 4;
             }
         }
@@ -1034,10 +1151,10 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
             dx *= (thickness * 0.5f);
             dy *= (thickness * 0.5f);
 
-            _VtxWritePtr[0].pos.x = p1.x + dy; _VtxWritePtr[0].pos.y = p1.y - dx; _VtxWritePtr[0].uv = opaque_uv; _VtxWritePtr[0].col = col;
-            _VtxWritePtr[1].pos.x = p2.x + dy; _VtxWritePtr[1].pos.y = p2.y - dx; _VtxWritePtr[1].uv = opaque_uv; _VtxWritePtr[1].col = col;
-            _VtxWritePtr[2].pos.x = p2.x - dy; _VtxWritePtr[2].pos.y = p2.y + dx; _VtxWritePtr[2].uv = opaque_uv; _VtxWritePtr[2].col = col;
-            _VtxWritePtr[3].pos.x = p1.x - dy; _VtxWritePtr[3].pos.y = p1.y + dx; _VtxWritePtr[3].uv = opaque_uv; _VtxWritePtr[3].col = col;
+            SetVtx(&_VtxWritePtr[0], ImVec2(p1.x + dy, p1.y - dx), opaque_uv, col);
+            SetVtx(&_VtxWritePtr[1], ImVec2(p2.x + dy, p2.y - dx), opaque_uv, col);
+            SetVtx(&_VtxWritePtr[2], ImVec2(p2.x - dy, p2.y + dx), opaque_uv, col);
+            SetVtx(&_VtxWritePtr[3], ImVec2(p1.x - dy, p1.y + dx), opaque_uv, col);
             _VtxWritePtr += 4;
 
             _IdxWritePtr[0] = (ImDrawIdx)(_VtxCurrentIdx); _IdxWritePtr[1] = (ImDrawIdx)(_VtxCurrentIdx + 1); _IdxWritePtr[2] = (ImDrawIdx)(_VtxCurrentIdx + 2);
@@ -1075,34 +1192,28 @@ void ImDrawList::AddConvexPolyFilled(const ImVec2* points, const int points_coun
             _IdxWritePtr += 3;
         }
 
-        // Compute normals
-        _Data->TempBuffer.reserve_discard(points_count);
+        // Compute normals, then inner and outer points from averaged normals
+        // The first <points_count> items are normals at each point, then there are 2 temp points for each point
+        _Data->TempBuffer.reserve_discard(points_count * 3);
         ImVec2* temp_normals = _Data->TempBuffer.Data;
-        for (int i0 = points_count - 1, i1 = 0; i1 < points_count; i0 = i1++)
+        ImVec2* temp_points = temp_normals + points_count;
+        ImDrawList_PolylineComputeNormals(points, 0, points_count - 1, temp_normals);
         {
-            const ImVec2& p0 = points[i0];
-            const ImVec2& p1 = points[i1];
-            float dx = p1.x - p0.x;
-            float dy = p1.y - p0.y;
+            float dx = points[0].x - points[points_count - 1].x;
+            float dy = points[0].y - points[points_count - 1].y;
             IM_NORMALIZE2F_OVER_ZERO(dx, dy);
-            temp_normals[i0].x = dy;
-            temp_normals[i0].y = -dx;
+            temp_normals[points_count - 1].x = dy;
+            temp_normals[points_count - 1].y = -dx;
         }
+        const float edge_scales[2] = { -AA_SIZE * 0.5f, AA_SIZE * 0.5f };
+        ImDrawList_PolylineComputeMiterPoint(points[0], temp_normals[points_count - 1], temp_normals[0], edge_scales, 2, &temp_points[0]);
+        ImDrawList_PolylineComputeMiterPoints(points, temp_normals, 1, points_count, edge_scales, 2, temp_points);
 
         for (int i0 = points_count - 1, i1 = 0; i1 < points_count; i0 = i1++)
         {
-            // Average normals
-            const ImVec2& n0 = temp_normals[i0];
-            const ImVec2& n1 = temp_normals[i1];
-            float dm_x = (n0.x + n1.x) * 0.5f;
-            float dm_y = (n0.y + n1.y) * 0.5f;
-            IM_FIXNORMAL2F(dm_x, dm_y);
-            dm_x *= AA_SIZE * 0.5f;
-            dm_y *= AA_SIZE * 0.5f;
-
             // Add vertices
-            _VtxWritePtr[0].pos.x = (points[i1].x - dm_x); _VtxWritePtr[0].pos.y = (points[i1].y - dm_y); _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;        // Inner
-            _VtxWritePtr[1].pos.x = (points[i1].x + dm_x); _VtxWritePtr[1].pos.y = (points[i1].y + dm_y); _VtxWritePtr[1].uv = uv; _VtxWritePtr[1].col = col_trans;  // Outer
+            SetVtx(&_VtxWritePtr[0], temp_points[i1 * 2 + 0], uv, col);        // Inner
+            SetVtx(&_VtxWritePtr[1], temp_points[i1 * 2 + 1], uv, col_trans);  // Outer
             _VtxWritePtr += 2;
 
             // Add indexes for fringes
@@ -1120,7 +1231,7 @@ void ImDrawList::AddConvexPolyFilled(const ImVec2* points, const int points_coun
         PrimReserve(idx_count, vtx_count);
         for (int i = 0; i < vtx_count; i++)
         {
-            _VtxWritePtr[0].pos = points[i]; _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;
+            SetVtx(&_VtxWritePtr[0], points[i], uv, col);
             _VtxWritePtr++;
         }
         for (int i = 2; i < points_count; i++)
@@ -1132,6 +1243,180 @@ void ImDrawList::AddConvexPolyFilled(const ImVec2* points, const int points_coun
     }
 }
 
+// Sample indices emitted by _PathArcToFastEx() for a forward arc (a_min_sample >= 0, a_step already clamped)
+static int ImDrawListArcFastSamples(int a_min_sample, int a_max_sample, int a_step, int* out_samples)
+{
+    const int sample_range = a_max_sample - a_min_sample;
+    const int a_next_step = a_step;
+    const bool extra_max_sample = (a_step > 1 && (sample_range % a_step) > 0);
+    if (extra_max_sample && sample_range > 0)
+        a_step -= (a_step - sample_range % a_step) / 2;
+    int samples_count = 0;
+    for (int a = a_min_sample; a <= a_max_sample; a += a_step, a_step = a_next_step)
+        out_samples[samples_count++] = a % IM_DRAWLIST_ARCFAST_SAMPLE_MAX;
+    if (extra_max_sample)
+        out_samples[samples_count++] = a_max_sample % IM_DRAWLIST_ARCFAST_SAMPLE_MAX;
+    return samples_count;
+}
+
+// Append a template for points[], with 'n_first' the normal of the edge leading to the first point and 'n_last' the normal of the edge leaving the last point.
+static void ImDrawListShapeTemplateAdd(ImDrawListSharedData* data, ImDrawListShapeTemplate* shape, const ImVec2* points, int points_count, ImVec2 n_first, ImVec2 n_last)
+{
+    shape->VtxOffset = data->ShapeTemplateVtx.Size;
+    shape->VtxCount = points_count;
+    ImVec2 n0 = n_first;
+    for (int i = 0; i < points_count; i++)
+    {
+        ImVec2 n1 = n_last;
+        if (i + 1 < points_count)
+        {
+            float dx = points[i + 1].x - points[i].x;
+            float dy = points[i + 1].y - points[i].y;
+            IM_NORMALIZE2F_OVER_ZERO(dx, dy);
+            n1 = ImVec2(dy, -dx);
+        }
+        float dm_x = (n0.x + n1.x) * 0.5f;
+        float dm_y = (n0.y + n1.y) * 0.5f;
+        IM_FIXNORMAL2F(dm_x, dm_y);
+        ImDrawListShapeTemplateVtx vtx;
+        vtx.Pos = points[i];
+        vtx.Normal = ImVec2(dm_x, dm_y);
+        data->ShapeTemplateVtx.push_back(vtx);
+        n0 = n1;
+    }
+}
+
+// Precompute unit-radius shapes for every possible _PathArcToFastEx() step, so AddCircleFilled()/AddRectFilled() only need to scale and translate them.
+void ImDrawListSharedData::BuildShapeTemplates()
+{
+    ShapeTemplateVtx.resize(0);
+    int samples[IM_DRAWLIST_ARCFAST_SAMPLE_MAX + 2];
+    ImVec2 points[IM_DRAWLIST_ARCFAST_SAMPLE_MAX + 2];
+    const ImVec2 axis_normals[5] = { ImVec2(1.0f, 0.0f), ImVec2(0.0f, 1.0f), ImVec2(-1.0f, 0.0f), ImVec2(0.0f, -1.0f), ImVec2(1.0f, 0.0f) }; // Normal of rectangle side preceding each corner
+    for (int step = 0; step <= IM_DRAWLIST_ARCFAST_STEP_MAX; step++)
+    {
+        // Closed circle (last sample is dropped as it overlaps the first one)
+        if (step > 0)
+        {
+            const int points_count = ImDrawListArcFastSamples(0, IM_DRAWLIST_ARCFAST_SAMPLE_MAX, step, samples) - 1;
+            for (int i = 0; i < points_count; i++)
+                points[i] = ArcFastVtx[samples[i]];
+            float dx = points[0].x - points[points_count - 1].x;
+            float dy = points[0].y - points[points_count - 1].y;
+            IM_NORMALIZE2F_OVER_ZERO(dx, dy);
+            ImDrawListShapeTemplateAdd(this, &CircleTemplates[step], points, points_count, ImVec2(dy, -dx), ImVec2(dy, -dx));
+        }
+        else
+        {
+            CircleTemplates[step].VtxOffset = CircleTemplates[step].VtxCount = 0;
+        }
+
+        // Rectangle corners, joined by straight sides
+        for (int corner = 0; corner < 4; corner++)
+        {
+            int points_count = 1;
+            points[0] = ImVec2(0.0f, 0.0f);
+            if (step > 0)
+            {
+                points_count = ImDrawListArcFastSamples(corner * IM_DRAWLIST_ARCFAST_SAMPLE_MAX / 4, (corner + 1) * IM_DRAWLIST_ARCFAST_SAMPLE_MAX / 4, step, samples);
+                for (int i = 0; i < points_count; i++)
+                    points[i] = ArcFastVtx[samples[i]];
+            }
+            ImDrawListShapeTemplateAdd(this, &CornerTemplates[step][corner], points, points_count, axis_normals[corner], axis_normals[corner + 1]);
+        }
+    }
+}
+
+// Fill a convex shape made of templates (scaled by 'radii[]' and translated to 'centers[]'), joined by straight edges.
+// Output is the same as PathFillConvex() on the points generated by _PathArcToFastEx() but skips calculating normals.
+static void ImDrawList_AddShapeTemplatesFilled(ImDrawList* draw_list, const ImDrawListShapeTemplate* const* shapes, const ImVec2* centers, const float* radii, int shapes_count, ImU32 col)
+{
+    const ImDrawListShapeTemplateVtx* template_vtx = draw_list->_Data->ShapeTemplateVtx.Data;
+    const ImVec2 uv = draw_list->_Data->TexUvWhitePixel;
+    int points_count = 0;
+    for (int n = 0; n < shapes_count; n++)
+        points_count += shapes[n]->VtxCount;
+    IM_ASSERT(points_count >= 3);
+
+    if (draw_list->Flags & ImDrawListFlags_AntiAliasedFill)
+    {
+        // Anti-aliased Fill
+        const float AA_SIZE = draw_list->_FringeScale;
+        const float aa_inner = -AA_SIZE * 0.5f;
+        const float aa_outer = AA_SIZE * 0.5f;
+        const ImU32 col_trans = col & ~IM_COL32_A_MASK;
+        const int idx_count = (points_count - 2) * 3 + points_count * 6;
+        const int vtx_count = (points_count * 2);
+        draw_list->PrimReserve(idx_count, vtx_count);
+
+        // Add indexes for fill
+        const unsigned int vtx_inner_idx = draw_list->_VtxCurrentIdx;
+        const unsigned int vtx_outer_idx = draw_list->_VtxCurrentIdx + 1;
+        ImDrawIdx* idx_write = draw_list->_IdxWritePtr;
+        for (int i = 2; i < points_count; i++)
+        {
+            idx_write[0] = (ImDrawIdx)(vtx_inner_idx); idx_write[1] = (ImDrawIdx)(vtx_inner_idx + ((i - 1) << 1)); idx_write[2] = (ImDrawIdx)(vtx_inner_idx + (i << 1));
+            idx_write += 3;
+        }
+
+        // Add vertices
+        ImDrawVert* vtx_write = draw_list->_VtxWritePtr;
+        for (int n = 0; n < shapes_count; n++)
+        {
+            const ImVec2 center = centers[n];
+            const float radius = radii[n];
+            const ImDrawListShapeTemplateVtx* src = template_vtx + shapes[n]->VtxOffset;
+            for (const ImDrawListShapeTemplateVtx* src_end = src + shapes[n]->VtxCount; src < src_end; src++)
+            {
+                const float x = center.x + src->Pos.x * radius;
+                const float y = center.y + src->Pos.y * radius;
+                draw_list->SetVtx(&vtx_write[0], ImVec2(x + src->Normal.x * aa_inner, y + src->Normal.y * aa_inner), uv, col);       // Inner
+                draw_list->SetVtx(&vtx_write[1], ImVec2(x + src->Normal.x * aa_outer, y + src->Normal.y * aa_outer), uv, col_trans); // Outer
+                vtx_write += 2;
+            }
+        }
+
+        // Add indexes for fringes
+        for (int i0 = points_count - 1, i1 = 0; i1 < points_count; i0 = i1++)
+        {
+            idx_write[0] = (ImDrawIdx)(vtx_inner_idx + (i1 << 1)); idx_write[1] = (ImDrawIdx)(vtx_inner_idx + (i0 << 1)); idx_write[2] = (ImDrawIdx)(vtx_outer_idx + (i0 << 1));
+            idx_write[3] = (ImDrawIdx)(vtx_outer_idx + (i0 << 1)); idx_write[4] = (ImDrawIdx)(vtx_outer_idx + (i1 << 1)); idx_write[5] = (ImDrawIdx)(vtx_inner_idx + (i1 << 1));
+            idx_write += 6;
+        }
+        draw_list->_VtxWritePtr = vtx_write;
+        draw_list->_IdxWritePtr = idx_write;
+        draw_list->_VtxCurrentIdx += (ImDrawIdx)vtx_count;
+    }
+    else
+    {
+        // Non Anti-aliased Fill
+        const int idx_count = (points_count - 2) * 3;
+        const int vtx_count = points_count;
+        draw_list->PrimReserve(idx_count, vtx_count);
+        ImDrawVert* vtx_write = draw_list->_VtxWritePtr;
+        for (int n = 0; n < shapes_count; n++)
+        {
+            const ImVec2 center = centers[n];
+            const float radius = radii[n];
+            const ImDrawListShapeTemplateVtx* src = template_vtx + shapes[n]->VtxOffset;
+            for (const ImDrawListShapeTemplateVtx* src_end = src + shapes[n]->VtxCount; src < src_end; src++)
+            {
+                draw_list->SetVtx(&vtx_write[0], ImVec2(center.x + src->Pos.x * radius, center.y + src->Pos.y * radius), uv, col);
+                vtx_write++;
+            }
+        }
+        ImDrawIdx* idx_write = draw_list->_IdxWritePtr;
+        for (int i = 2; i < points_count; i++)
+        {
+            idx_write[0] = (ImDrawIdx)(draw_list->_VtxCurrentIdx); idx_write[1] = (ImDrawIdx)(draw_list->_VtxCurrentIdx + i - 1); idx_write[2] = (ImDrawIdx)(draw_list->_VtxCurrentIdx + i);
+            idx_write += 3;
+        }
+        draw_list->_VtxWritePtr = vtx_write;
+        draw_list->_IdxWritePtr = idx_write;
+        draw_list->_VtxCurrentIdx += (ImDrawIdx)vtx_count;
+    }
+}
+
 void ImDrawList::_PathArcToFastEx(const ImVec2& center, float radius, int a_min_sample, int a_max_sample, int a_step)
 {
     if (radius < 0.5f)
@@ -1442,13 +1727,19 @@ static inline ImDrawFlags FixRectCornerFlags(ImDrawFlags flags)
     return flags;
 }
 
+static inline float ClampRectRounding(const ImVec2& a, const ImVec2& b, float rounding, ImDrawFlags flags)
+{
+    rounding = ImMin(rounding, ImFabs(b.x - a.x) * (((flags & ImDrawFlags_RoundCornersTop) == ImDrawFlags_RoundCornersTop) || ((flags & ImDrawFlags_RoundCornersBottom) == ImDrawFlags_RoundCornersBottom) ? 0.5f : 1.0f) - 1.0f);
+    rounding = ImMin(rounding, ImFabs(b.y - a.y) * (((flags & ImDrawFlags_RoundCornersLeft) == ImDrawFlags_RoundCornersLeft) || ((flags & ImDrawFlags_RoundCornersRight) == ImDrawFlags_RoundCornersRight) ? 0.5f : 1.0f) - 1.0f);
+    return rounding;
+}
+
 void ImDrawList::PathRect(const ImVec2& a, const ImVec2& b, float rounding, ImDrawFlags flags)
 {
     if (rounding >= 0.5f)
     {
         flags = FixRectCornerFlags(flags);
-        rounding = ImMin(rounding, ImFabs(b.x - a.x) * (((flags & ImDrawFlags_RoundCornersTop) == ImDrawFlags_RoundCornersTop) || ((flags & ImDrawFlags_RoundCornersBottom) == ImDrawFlags_RoundCornersBottom) ? 0.5f : 1.0f) - 1.0f);
-        rounding = ImMin(rounding, ImFabs(b.y - a.y) * (((flags & ImDrawFlags_RoundCornersLeft) == ImDrawFlags_RoundCornersLeft) || ((flags & ImDrawFlags_RoundCornersRight) == ImDrawFlags_RoundCornersRight) ? 0.5f : 1.0f) - 1.0f);
+        rounding = ClampRectRounding(a, b, rounding, flags);
     }
     if (rounding < 0.5f || (flags & ImDrawFlags_RoundCornersMask_) == ImDrawFlags_RoundCornersNone)
     {
@@ -1503,8 +1794,30 @@ void ImDrawList::AddRectFilled(const ImVec2& p_min, const ImVec2& p_max, ImU32 c
     }
     else
     {
-        PathRect(p_min, p_max, rounding, flags);
-        PathFillConvex(col);
+        // Same output as PathRect() + PathFillConvex(), using precomputed corners
+        flags = FixRectCornerFlags(flags);
+        rounding = ClampRectRounding(p_min, p_max, rounding, flags);
+        if (rounding < 0.5f || p_min.x >= p_max.x || p_min.y >= p_max.y)
+        {
+            PathRect(p_min, p_max, rounding, flags);
+            PathFillConvex(col);
+            return;
+        }
+        const int step = ImClamp(IM_DRAWLIST_ARCFAST_SAMPLE_MAX / _CalcCircleAutoSegmentCount(rounding), 1, IM_DRAWLIST_ARCFAST_STEP_MAX);
+        const float rounding_tl = (flags & ImDrawFlags_RoundCornersTopLeft)     ? rounding : 0.0f;
+        const float rounding_tr = (flags & ImDrawFlags_RoundCornersTopRight)    ? rounding : 0.0f;
+        const float rounding_br = (flags & ImDrawFlags_RoundCornersBottomRight) ? rounding : 0.0f;
+        const float rounding_bl = (flags & ImDrawFlags_RoundCornersBottomLeft)  ? rounding : 0.0f;
+        const ImDrawListShapeTemplate* shapes[4] =
+        {
+            &_Data->CornerTemplates[rounding_tl > 0.0f ? step : 0][2],
+            &_Data->CornerTemplates[rounding_tr > 0.0f ? step : 0][3],
+            &_Data->CornerTemplates[rounding_br > 0.0f ? step : 0][0],
+            &_Data->CornerTemplates[rounding_bl > 0.0f ? step : 0][1],
+        };
+        const ImVec2 centers[4] = { ImVec2(p_min.x + rounding_tl, p_min.y + rounding_tl), ImVec2(p_max.x - rounding_tr, p_min.y + rounding_tr), ImVec2(p_max.x - rounding_br, p_max.y - rounding_br), ImVec2(p_min.x + rounding_bl, p_max.y - rounding_bl) };
+        const float radii[4] = { rounding_tl, rounding_tr, rounding_br, rounding_bl };
+        ImDrawList_AddShapeTemplatesFilled(this, shapes, centers, radii, 4, col);
     }
 }
 
@@ -1601,20 +1914,19 @@ void ImDrawList::AddCircleFilled(const ImVec2& center, float radius, ImU32 col,
 
     if (num_segments <= 0)
     {
-        // Use arc with automatic segment count
-        _PathArcToFastEx(center, radius, 0, IM_DRAWLIST_ARCFAST_SAMPLE_MAX, 0);
-        _Path.Size--;
+        // Use precomputed circle with automatic segment count (same points as _PathArcToFastEx())
+        const int step = ImClamp(IM_DRAWLIST_ARCFAST_SAMPLE_MAX / _CalcCircleAutoSegmentCount(radius), 1, IM_DRAWLIST_ARCFAST_STEP_MAX);
+        const ImDrawListShapeTemplate* shape = &_Data->CircleTemplates[step];
+        ImDrawList_AddShapeTemplatesFilled(this, &shape, &center, &radius, 1, col);
+        return;
     }
-    else
-    {
-        // Explicit segment count (still clamp to avoid drawing insanely tessellated shapes)
-        num_segments = ImClamp(num_segments, 3, IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_MAX);
 
-        // Because we are filling a closed shape we remove 1 from the count of segments/points
-        const float a_max = (IM_PI * 2.0f) * ((float)num_segments - 1.0f) / (float)num_segments;
-        PathArcTo(center, radius, 0.0f, a_max, num_segments - 1);
-    }
+    // Explicit segment count (still clamp to avoid drawing insanely tessellated shapes)
+    num_segments = ImClamp(num_segments, 3, IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_MAX);
 
+    // Because we are filling a closed shape we remove 1 from the count of segments/points
+    const float a_max = (IM_PI * 2.0f) * ((float)num_segments - 1.0f) / (float)num_segments;
+    PathArcTo(center, radius, 0.0f, a_max, num_segments - 1);
     PathFillConvex(col);
 }
 
@@ -1729,6 +2041,8 @@ void ImDrawList::AddImage(ImTextureRef tex_ref, const ImVec2& p_min, const ImVec
 {
     if ((col & IM_COL32_A_MASK) == 0)
         return;
+    if (_SdfActive)
+        _SetSdfRenderState(false);
 
     const bool push_texture_id = tex_ref != _CmdHeader.TexRef;
     if (push_texture_id)
@@ -1745,6 +2059,8 @@ void ImDrawList::AddImageQuad(ImTextureRef tex_ref, const ImVec2& p1, const ImVe
 {
     if ((col & IM_COL32_A_MASK) == 0)
         return;
+    if (_SdfActive)
+        _SetSdfRenderState(false);
 
     const bool push_texture_id = tex_ref != _CmdHeader.TexRef;
     if (push_texture_id)
@@ -1768,6 +2084,8 @@ void ImDrawList::AddImageRounded(ImTextureRef tex_ref, const ImVec2& p_min, cons
         AddImage(tex_ref, p_min, p_max, uv_min, uv_max, col);
         return;
     }
+    if (_SdfActive)
+        _SetSdfRenderState(false);
 
     const bool push_texture_id = tex_ref != _CmdHeader.TexRef;
     if (push_texture_id)
@@ -1788,12 +2106,19 @@ void ImDrawList::AddImageRounded(ImTextureRef tex_ref, const ImVec2& p_min, cons
 //-----------------------------------------------------------------------------
 // Triangulate concave polygons. Based on "Triangulation by Ear Clipping" paper, O(N^2) complexity.
 // Reference: https://www.geometrictools.com/Documentation/TriangulationByEarClipping.pdf
+// Polygons with IM_DRAWLIST_CONCAVE_MONOTONE_MIN_POINTS points or more use a sweep-line decomposition into monotone pieces, O(N log N) complexity.
 // Provided as a convenience for user but not used by main library.
 //-----------------------------------------------------------------------------
 // - ImTriangulator [Internal]
+// - ImTriangulatorMonotone [Internal]
 // - AddConcavePolyFilled()
 //-----------------------------------------------------------------------------
 
+// Below this amount of points, ear-clipping is faster (less setup). Can be overridden in imconfig.h.
+#ifndef IM_DRAWLIST_CONCAVE_MONOTONE_MIN_POINTS
+#define IM_DRAWLIST_CONCAVE_MONOTONE_MIN_POINTS     64
+#endif
+
 enum ImTriangulatorNodeType
 {
     ImTriangulatorNodeType_Convex,
@@ -1999,206 +2324,644 @@ void ImTriangulator::ReclassifyNode(ImTriangulatorNode* n1)
     n1->Type = type;
 }
 
-// Use ear-clipping algorithm to triangulate a simple polygon (no self-interaction, no holes).
-// (Reminder: we don't perform any coarse clipping/culling in ImDrawList layer!
-// It is up to caller to ensure not making costly calls that will be outside of visible area.
-// As concave fill is noticeably more expensive than other primitives, be mindful of this...
-// Caller can build AABB of points, and avoid filling if 'draw_list->_CmdHeader.ClipRect.Overlays(points_bb) == false')
-void ImDrawList::AddConcavePolyFilled(const ImVec2* points, const int points_count, ImU32 col)
+// Sweep-line triangulator for large polygons:
+// - Vertices are sorted top to bottom, and a sweep line adds diagonals at split/merge vertices to decompose the polygon into y-monotone pieces.
+// - Each piece is triangulated in linear time with the classic stack algorithm.
+// - Reference: "Computational Geometry: Algorithms and Applications", de Berg et al, chapter 3.
+// - Sorting is O(N log N). The sweep status is a sorted array (binary search + insertion), which is fast as long as few edges cross a given
+//   horizontal line, which is the case for typical outlines.
+// - All storage is carved from a caller provided scratch buffer, so calls don't allocate once the buffer has grown.
+// - Return false on geometry we cannot decompose (e.g. self-intersecting polygons). Caller may fallback to ear-clipping.
+struct ImTriangulatorMonotoneAdj
 {
-    if (points_count < 3 || (col & IM_COL32_A_MASK) == 0)
-        return;
+    float   Angle;
+    int     Vertex;
+};
 
-    const ImVec2 uv = _Data->TexUvWhitePixel;
-    ImTriangulator triangulator;
-    unsigned int triangle[3];
-    if (Flags & ImDrawListFlags_AntiAliasedFill)
-    {
-        // Anti-aliased Fill
-        const float AA_SIZE = _FringeScale;
-        const ImU32 col_trans = col & ~IM_COL32_A_MASK;
-        const int idx_count = (points_count - 2) * 3 + points_count * 6;
-        const int vtx_count = (points_count * 2);
-        PrimReserve(idx_count, vtx_count);
+enum ImTriangulatorMonotoneVertexType
+{
+    ImTriangulatorMonotoneVertexType_Start,
+    ImTriangulatorMonotoneVertexType_Split,
+    ImTriangulatorMonotoneVertexType_End,
+    ImTriangulatorMonotoneVertexType_Merge,
+    ImTriangulatorMonotoneVertexType_Regular,
+};
 
-        // Add indexes for fill
-        unsigned int vtx_inner_idx = _VtxCurrentIdx;
-        unsigned int vtx_outer_idx = _VtxCurrentIdx + 1;
+struct ImTriangulatorMonotone
+{
+    static int EstimateScratchBufferSize(int points_count)  { return (int)(sizeof(ImVec2) + sizeof(ImU64) * 2 + sizeof(int) * 20 + sizeof(ImTriangulatorMonotoneAdj) * 4) * points_count + (int)sizeof(int) * (8 * 256 + 2); }
 
-        _Data->TempBuffer.reserve_discard((ImTriangulator::EstimateScratchBufferSize(points_count) + sizeof(ImVec2)) / sizeof(ImVec2));
-        triangulator.Init(points, points_count, _Data->TempBuffer.Data);
-        while (triangulator._TrianglesLeft > 0)
-        {
-            triangulator.GetNextTriangle(triangle);
-            _IdxWritePtr[0] = (ImDrawIdx)(vtx_inner_idx + (triangle[0] << 1)); _IdxWritePtr[1] = (ImDrawIdx)(vtx_inner_idx + (triangle[1] << 1)); _IdxWritePtr[2] = (ImDrawIdx)(vtx_inner_idx + (triangle[2] << 1));
-            _IdxWritePtr += 3;
-        }
+    bool    Triangulate(const ImVec2* points, int points_count, void* scratch_buffer, unsigned int* out_triangles); // Write (points_count - 2) triangles with indexes into points[]. Return false on failure (output is then incomplete).
 
-        // Compute normals
-        _Data->TempBuffer.reserve_discard(points_count);
-        ImVec2* temp_normals = _Data->TempBuffer.Data;
-        for (int i0 = points_count - 1, i1 = 0; i1 < points_count; i0 = i1++)
-        {
-            const ImVec2& p0 = points[i0];
-            const ImVec2& p1 = points[i1];
-            float dx = p1.x - p0.x;
-            float dy = p1.y - p0.y;
-            IM_NORMALIZE2F_OVER_ZERO(dx, dy);
-            temp_normals[i0].x = dy;
-            temp_normals[i0].y = -dx;
-        }
+    // Internal functions
+    const int* SortVertices(ImU64* keys, int* order, unsigned int* counts);
+    double  Cross(int a, int b, int c) const                { return ((double)_Pos[b].x - _Pos[a].x) * ((double)_Pos[c].y - _Pos[a].y) - ((double)_Pos[b].y - _Pos[a].y) * ((double)_Pos[c].x - _Pos[a].x); }
+    bool    IsEdgeLeftOf(int edge, int v) const;
+    int     FindStatusPrefix(int v) const;
+    bool    RemoveStatusEdge(int edge, int v);
+    void    AddDiagonal(int a, int b)                       { _Diagonals[_DiagonalsCount * 2 + 0] = a; _Diagonals[_DiagonalsCount * 2 + 1] = b; _DiagonalsCount++; }
+    bool    TriangulateMonotoneFace(const int* face, int face_size, unsigned int** p_out_triangles);
+    bool    EmitTriangle(unsigned int** p_out, int a, int b, int c) { unsigned int* out = *p_out; if (_OutTrianglesEnd - out < 3) return false; out[0] = (unsigned int)a; out[1] = (unsigned int)b; out[2] = (unsigned int)c; *p_out = out + 3; return true; }
 
-        for (int i0 = points_count - 1, i1 = 0; i1 < points_count; i0 = i1++)
-        {
-            // Average normals
-            const ImVec2& n0 = temp_normals[i0];
-            const ImVec2& n1 = temp_normals[i1];
-            float dm_x = (n0.x + n1.x) * 0.5f;
-            float dm_y = (n0.y + n1.y) * 0.5f;
-            IM_FIXNORMAL2F(dm_x, dm_y);
-            dm_x *= AA_SIZE * 0.5f;
-            dm_y *= AA_SIZE * 0.5f;
+    // Internal members
+    int                             _PointsCount = 0;
+    ImVec2*                         _Pos = NULL;            // Points in y-up coordinates and counter-clockwise order
+    int*                            _Map = NULL;            // Index in _Pos[] -> index in caller points[]
+    int*                            _Rank = NULL;           // Position of each vertex in sweep order
+    int*                            _Helper = NULL;         // Helper vertex for each edge (edge N goes from vertex N to vertex N+1)
+    int*                            _Types = NULL;
+    int*                            _Status = NULL;         // Edges crossing the sweep line with polygon interior to their right, sorted left to right
+    int                             _StatusSize = 0;
+    int*                            _Diagonals = NULL;
+    int                             _DiagonalsCount = 0;
+    int*                            _Work = NULL;           // Scratch for face extraction and monotone triangulation
+    unsigned int*                   _OutTrianglesEnd = NULL;// End of caller output: degenerate input may produce more triangles than expected, never write past it
+};
 
-            // Add vertices
-            _VtxWritePtr[0].pos.x = (points[i1].x - dm_x); _VtxWritePtr[0].pos.y = (points[i1].y - dm_y); _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;        // Inner
-            _VtxWritePtr[1].pos.x = (points[i1].x + dm_x); _VtxWritePtr[1].pos.y = (points[i1].y + dm_y); _VtxWritePtr[1].uv = uv; _VtxWritePtr[1].col = col_trans;  // Outer
-            _VtxWritePtr += 2;
+bool ImTriangulatorMonotone::IsEdgeLeftOf(int edge, int v) const
+{
+    int a = edge;
+    int b = (edge + 1 == _PointsCount) ? 0 : edge + 1;
+    if (_Rank[a] > _Rank[b])
+        ImSwap(a, b);
+    return Cross(a, b, v) > 0.0; // 'v' is on the right of the edge going down
+}
 
-            // Add indexes for fringes
-            _IdxWritePtr[0] = (ImDrawIdx)(vtx_inner_idx + (i1 << 1)); _IdxWritePtr[1] = (ImDrawIdx)(vtx_inner_idx + (i0 << 1)); _IdxWritePtr[2] = (ImDrawIdx)(vtx_outer_idx + (i0 << 1));
-            _IdxWritePtr[3] = (ImDrawIdx)(vtx_outer_idx + (i0 << 1)); _IdxWritePtr[4] = (ImDrawIdx)(vtx_outer_idx + (i1 << 1)); _IdxWritePtr[5] = (ImDrawIdx)(vtx_inner_idx + (i1 << 1));
-            _IdxWritePtr += 6;
-        }
-        _VtxCurrentIdx += (ImDrawIdx)vtx_count;
-    }
-    else
+int ImTriangulatorMonotone::FindStatusPrefix(int v) const
+{
+    int lo = 0, hi = _StatusSize;
+    while (lo < hi)
     {
-        // Non Anti-aliased Fill
-        const int idx_count = (points_count - 2) * 3;
-        const int vtx_count = points_count;
-        PrimReserve(idx_count, vtx_count);
-        for (int i = 0; i < vtx_count; i++)
+        const int mid = (lo + hi) >> 1;
+        if (IsEdgeLeftOf(_Status[mid], v))
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+bool ImTriangulatorMonotone::RemoveStatusEdge(int edge, int v)
+{
+    // Edge ends at 'v' so it is not strictly on its left: look from there first.
+    int pos = FindStatusPrefix(v);
+    while (pos < _StatusSize && _Status[pos] != edge)
+        pos++;
+    if (pos == _StatusSize)
+        for (pos = 0; pos < _StatusSize && _Status[pos] != edge; pos++) {}
+    if (pos == _StatusSize)
+        return false;
+    memmove(_Status + pos, _Status + pos + 1, (size_t)(_StatusSize - pos - 1) * sizeof(int));
+    _StatusSize--;
+    return true;
+}
+
+// Sort vertices top to bottom (y-up coordinates), then left to right, then by index. Return sorted vertices and fill _Rank[].
+// Radix sort on a 64-bit key, much faster than a comparison sort here. Passes where all keys share the same digit are skipped.
+// - keys[]: 2N, order[]: 2N, counts[]: 8x256
+const int* ImTriangulatorMonotone::SortVertices(ImU64* keys, int* order, unsigned int* counts)
+{
+    const int n = _PointsCount;
+    memset(counts, 0, sizeof(unsigned int) * 8 * 256);
+    for (int i = 0; i < n; i++)
+    {
+        ImU32 ky, kx;
+        memcpy(&ky, &_Pos[i].y, sizeof(ImU32));
+        memcpy(&kx, &_Pos[i].x, sizeof(ImU32));
+        ky = (ky & 0x80000000) ? ~ky : (ky | 0x80000000); // Map float to ordered unsigned integer
+        kx = (kx & 0x80000000) ? ~kx : (kx | 0x80000000);
+        const ImU64 key = ((ImU64)~ky << 32) | kx;
+        keys[i] = key;
+        order[i] = i;
+        for (int pass = 0; pass < 8; pass++)
+            counts[pass * 256 + (unsigned int)((key >> (pass * 8)) & 0xFF)]++;
+    }
+    ImU64* keys_out = keys + n;
+    int* order_out = order + n;
+    for (int pass = 0; pass < 8; pass++)
+    {
+        unsigned int* pass_counts = counts + pass * 256;
+        if (pass_counts[(unsigned int)((keys[0] >> (pass * 8)) & 0xFF)] == (unsigned int)n)
+            continue;
+        for (unsigned int digit = 0, sum = 0; digit < 256; digit++)
         {
-            _VtxWritePtr[0].pos = points[i]; _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;
-            _VtxWritePtr++;
+            const unsigned int count = pass_counts[digit];
+            pass_counts[digit] = sum;
+            sum += count;
         }
-        _Data->TempBuffer.reserve_discard((ImTriangulator::EstimateScratchBufferSize(points_count) + sizeof(ImVec2)) / sizeof(ImVec2));
-        triangulator.Init(points, points_count, _Data->TempBuffer.Data);
-        while (triangulator._TrianglesLeft > 0)
+        for (int i = 0; i < n; i++)
         {
-            triangulator.GetNextTriangle(triangle);
-            _IdxWritePtr[0] = (ImDrawIdx)(_VtxCurrentIdx + triangle[0]); _IdxWritePtr[1] = (ImDrawIdx)(_VtxCurrentIdx + triangle[1]); _IdxWritePtr[2] = (ImDrawIdx)(_VtxCurrentIdx + triangle[2]);
-            _IdxWritePtr += 3;
+            const unsigned int dst = pass_counts[(unsigned int)((keys[i] >> (pass * 8)) & 0xFF)]++;
+            keys_out[dst] = keys[i];
+            order_out[dst] = order[i];
         }
-        _VtxCurrentIdx += (ImDrawIdx)vtx_count;
+        ImSwap(keys, keys_out);
+        ImSwap(order, order_out);
     }
+    for (int r = 0; r < n; r++)
+        _Rank[order[r]] = r;
+    return order;
 }
 
-//-----------------------------------------------------------------------------
-// [SECTION] ImDrawListSplitter
-//-----------------------------------------------------------------------------
-// FIXME: This may be a little confusing, trying to be a little too low-level/optimal instead of just doing vector swap..
-//-----------------------------------------------------------------------------
-
-void ImDrawListSplitter::ClearFreeMemory()
+static int IMGUI_CDECL ImTriangulatorMonotoneAdjComparer(const void* lhs, const void* rhs)
 {
-    for (int i = 0; i < _Channels.Size; i++)
-    {
-        if (i == _Current)
-            memset(&_Channels[i], 0, sizeof(_Channels[i]));  // Current channel is a copy of CmdBuffer/IdxBuffer, don't destruct again
-        _Channels[i]._CmdBuffer.clear();
-        _Channels[i]._IdxBuffer.clear();
-    }
-    _Current = 0;
-    _Count = 1;
-    _Channels.clear();
+    const float a = ((const ImTriangulatorMonotoneAdj*)lhs)->Angle;
+    const float b = ((const ImTriangulatorMonotoneAdj*)rhs)->Angle;
+    return (a < b) ? -1 : (a > b) ? +1 : 0;
 }
 
-void ImDrawListSplitter::Split(ImDrawList* draw_list, int channels_count)
+bool ImTriangulatorMonotone::Triangulate(const ImVec2* points, int points_count, void* scratch_buffer, unsigned int* out_triangles)
 {
-    IM_UNUSED(draw_list);
-    IM_ASSERT(_Current == 0 && _Count <= 1 && "Nested channel splitting is not supported. Please use separate instances of ImDrawListSplitter.");
-    int old_channels_count = _Channels.Size;
-    if (old_channels_count < channels_count)
+    IM_ASSERT(scratch_buffer != NULL && points_count >= 3);
+    const int cap = points_count;
+    _Pos = (ImVec2*)scratch_buffer;                                             // n x ImVec2
+    ImU64* sort_keys = (ImU64*)(void*)(_Pos + cap);                             // 2n x ImU64
+    _Map = (int*)(void*)(sort_keys + cap * 2);                                  // n x int
+    _Rank = _Map + cap;                                                         // n x int
+    _Helper = _Rank + cap;                                                      // n x int
+    _Types = _Helper + cap;                                                     // n x int
+    _Status = _Types + cap;                                                     // n x int
+    _Diagonals = _Status + cap;                                                 // 2n x int
+    int* adj_offsets = _Diagonals + cap * 2;                                    // (n+1) x int
+    int* visited = adj_offsets + cap + 1;                                       // 4n x int
+    _Work = visited + cap * 4;                                                  // 5n x int
+    int* sort_order = _Work + cap * 5;                                          // 2n x int
+    unsigned int* sort_counts = (unsigned int*)(sort_order + cap * 2);          // 8 x 256 x int
+    ImTriangulatorMonotoneAdj* adj = (ImTriangulatorMonotoneAdj*)(void*)(sort_counts + 8 * 256 + 1); // 4n x Adj
+    _StatusSize = _DiagonalsCount = 0;
+    _OutTrianglesEnd = out_triangles + (points_count - 2) * 3;
+
+    // Convert to y-up coordinates, in counter-clockwise order (polygon interior on the left of each edge)
+    // Drop duplicate consecutive points (e.g. from rounded coordinates): each one is output as a zero-area triangle, so the total stays (points_count - 2).
+    double area = 0.0;
+    for (int i0 = points_count - 1, i1 = 0; i1 < points_count; i0 = i1++)
+        area += (double)points[i0].x * -points[i1].y - (double)points[i1].x * -points[i0].y;
+    int n = 0;
+    for (int i = 0; i < points_count; i++)
     {
-        _Channels.reserve(channels_count); // Avoid over reserving since this is likely to stay stable
-        _Channels.resize(channels_count);
+        const int src = (area >= 0.0) ? i : points_count - 1 - i;
+        const ImVec2 pos(points[src].x + 0.0f, 0.0f - points[src].y); // Also turn -0.0f into +0.0f for sorting
+        if (n > 0 && pos.x == _Pos[n - 1].x && pos.y == _Pos[n - 1].y)
+        {
+            if (!EmitTriangle(&out_triangles, src, src, src))
+                return false;
+            continue;
+        }
+        _Map[n] = src;
+        _Pos[n] = pos;
+        n++;
+    }
+    while (n > 1 && _Pos[n - 1].x == _Pos[0].x && _Pos[n - 1].y == _Pos[0].y)
+    {
+        n--;
+        if (!EmitTriangle(&out_triangles, _Map[n], _Map[n], _Map[n]))
+            return false;
+    }
+    if (n < 3)
+        return false;
+    _PointsCount = n;
+    const int* events = SortVertices(sort_keys, sort_order, sort_counts);
+
+    // Classify vertices
+    for (int i = 0; i < n; i++)
+    {
+        const int prev = (i == 0) ? n - 1 : i - 1;
+        const int next = (i + 1 == n) ? 0 : i + 1;
+        const bool prev_below = _Rank[prev] > _Rank[i];
+        const bool next_below = _Rank[next] > _Rank[i];
+        const bool convex = Cross(prev, i, next) >= 0.0;
+        if (prev_below && next_below)
+            _Types[i] = convex ? ImTriangulatorMonotoneVertexType_Start : ImTriangulatorMonotoneVertexType_Split;
+        else if (!prev_below && !next_below)
+            _Types[i] = convex ? ImTriangulatorMonotoneVertexType_End : ImTriangulatorMonotoneVertexType_Merge;
+        else
+            _Types[i] = ImTriangulatorMonotoneVertexType_Regular;
     }
-    _Count = channels_count;
 
-    // Channels[] (24/32 bytes each) hold storage that we'll swap with draw_list->_CmdBuffer/_IdxBuffer
-    // The content of Channels[0] at this point doesn't matter. We clear it to make state tidy in a debugger but we don't strictly need to.
-    // When we switch to the next channel, we'll copy draw_list->_CmdBuffer/_IdxBuffer into Channels[0] and then Channels[1] into draw_list->CmdBuffer/_IdxBuffer
-    memset(&_Channels[0], 0, sizeof(ImDrawChannel));
-    for (int i = 1; i < channels_count; i++)
+    // Sweep: add diagonals to split polygon into monotone pieces
+    for (int r = 0; r < n; r++)
     {
-        if (i >= old_channels_count)
+        const int v = events[r];
+        const int prev_edge = (v == 0) ? n - 1 : v - 1;
+        const int type = _Types[v];
+        if (type == ImTriangulatorMonotoneVertexType_End || type == ImTriangulatorMonotoneVertexType_Merge || (type == ImTriangulatorMonotoneVertexType_Regular && _Rank[prev_edge] < _Rank[v]))
         {
-            IM_PLACEMENT_NEW(&_Channels[i]) ImDrawChannel();
+            // Edge above 'v' with interior on its right ends here
+            if (_Types[_Helper[prev_edge]] == ImTriangulatorMonotoneVertexType_Merge)
+                AddDiagonal(v, _Helper[prev_edge]);
+            if (!RemoveStatusEdge(prev_edge, v))
+                return false;
         }
-        else
+        if (type == ImTriangulatorMonotoneVertexType_Split || type == ImTriangulatorMonotoneVertexType_Merge || (type == ImTriangulatorMonotoneVertexType_Regular && _Rank[prev_edge] > _Rank[v]))
         {
-            _Channels[i]._CmdBuffer.resize(0);
+            // Update edge directly left of 'v'
+            const int pos = FindStatusPrefix(v) - 1;
+            if (pos < 0)
+                return false;
+            const int left_edge = _Status[pos];
+            if (type == ImTriangulatorMonotoneVertexType_Split || _Types[_Helper[left_edge]] == ImTriangulatorMonotoneVertexType_Merge)
+                AddDiagonal(v, _Helper[left_edge]);
+            _Helper[left_edge] = v;
+        }
+        if (type == ImTriangulatorMonotoneVertexType_Start || type == ImTriangulatorMonotoneVertexType_Split || (type == ImTriangulatorMonotoneVertexType_Regular && _Rank[prev_edge] < _Rank[v]))
+        {
+            // Edge below 'v' with interior on its right starts here
+            const int pos = FindStatusPrefix(v);
+            memmove(_Status + pos + 1, _Status + pos, (size_t)(_StatusSize - pos) * sizeof(int));
+            _Status[pos] = v;
+            _StatusSize++;
+            _Helper[v] = v;
+        }
+    }
+    if (_DiagonalsCount > n)
+        return false;
+
+    // Build adjacency lists (polygon edges + diagonals), sorted counter-clockwise around each vertex
+    for (int i = 0; i <= n; i++)
+        adj_offsets[i] = (i < n) ? 2 : 0;
+    for (int d = 0; d < _DiagonalsCount * 2; d++)
+        adj_offsets[_Diagonals[d]]++;
+    for (int i = 0, sum = 0; i <= n; i++)
+    {
+        const int count = adj_offsets[i];
+        adj_offsets[i] = sum;
+        sum += count;
+        _Work[i] = adj_offsets[i]; // Write cursor
+    }
+    for (int i = 0; i < n; i++)
+    {
+        adj[_Work[i]++].Vertex = (i == 0) ? n - 1 : i - 1;
+        adj[_Work[i]++].Vertex = (i + 1 == n) ? 0 : i + 1;
+    }
+    for (int d = 0; d < _DiagonalsCount; d++)
+    {
+        const int a = _Diagonals[d * 2 + 0];
+        const int b = _Diagonals[d * 2 + 1];
+        adj[_Work[a]++].Vertex = b;
+        adj[_Work[b]++].Vertex = a;
+    }
+    for (int i = 0; i < n; i++)
+    {
+        const int count = adj_offsets[i + 1] - adj_offsets[i];
+        if (count <= 2)
+            continue;
+        for (int j = adj_offsets[i]; j < adj_offsets[i + 1]; j++)
+            adj[j].Angle = ImAtan2(_Pos[adj[j].Vertex].y - _Pos[i].y, _Pos[adj[j].Vertex].x - _Pos[i].x);
+        ImQsort(adj + adj_offsets[i], (size_t)count, sizeof(ImTriangulatorMonotoneAdj), ImTriangulatorMonotoneAdjComparer);
+    }
+
+    // Walk faces keeping interior on the left. Half-edges going clockwise along the polygon outline belong to the outer face.
+    for (int i = 0; i < n; i++)
+    {
+        const int prev = (i == 0) ? n - 1 : i - 1;
+        bool outer_found = false;
+        for (int j = adj_offsets[i]; j < adj_offsets[i + 1]; j++)
+        {
+            visited[j] = (!outer_found && adj[j].Vertex == prev) ? 1 : 0;
+            outer_found |= (visited[j] != 0);
+        }
+    }
+    unsigned int* out_triangles_start = out_triangles;
+    int* face = _Work;
+    for (int v_start = 0; v_start < n; v_start++)
+        for (int h_start = adj_offsets[v_start]; h_start < adj_offsets[v_start + 1]; h_start++)
+        {
+            if (visited[h_start])
+                continue;
+            int face_size = 0;
+            int u = v_start;
+            int h = h_start;
+            while (!visited[h])
+            {
+                if (face_size == n)
+                    return false;
+                visited[h] = 1;
+                face[face_size++] = u;
+
+                // Next half-edge: from 'v', first neighbor clockwise from 'u'
+                const int v = adj[h].Vertex;
+                int back = adj_offsets[v];
+                while (back < adj_offsets[v + 1] && adj[back].Vertex != u)
+                    back++;
+                if (back == adj_offsets[v + 1])
+                    return false;
+                h = (back == adj_offsets[v]) ? adj_offsets[v + 1] - 1 : back - 1;
+                u = v;
+            }
+            if (u != v_start || h != h_start)
+                return false;
+            if (!TriangulateMonotoneFace(face, face_size, &out_triangles))
+                return false;
+        }
+    return (int)(out_triangles - out_triangles_start) == (n - 2) * 3;
+}
+
+// Triangulate a y-monotone polygon given in counter-clockwise order.
+// Degenerate faces (collinear or touching edges) may produce extra triangles: every write is checked against _OutTrianglesEnd.
+bool ImTriangulatorMonotone::TriangulateMonotoneFace(const int* face, int face_size, unsigned int** p_out_triangles)
+{
+    if (face_size < 3)
+        return false;
+    unsigned int* out = *p_out_triangles;
+    if (face_size == 3)
+    {
+        if (!EmitTriangle(&out, _Map[face[0]], _Map[face[1]], _Map[face[2]]))
+            return false;
+        *p_out_triangles = out;
+        return true;
+    }
+
+    // Find top and bottom, then merge left chain (going forward from top) and right chain (going backward from top) in sweep order
+    int top = 0, bottom = 0;
+    for (int k = 1; k < face_size; k++)
+    {
+        if (_Rank[face[k]] < _Rank[face[top]])
+            top = k;
+        if (_Rank[face[k]] > _Rank[face[bottom]])
+            bottom = k;
+    }
+    int* sorted = (int*)(_Work + _PointsCount);                 // face_size x vertex
+    int* is_left = sorted + _PointsCount;                       // face_size x bool
+    int* stack = is_left + _PointsCount;                        // face_size x index into sorted[]
+    int left = (top + 1) % face_size;
+    int right = (top + face_size - 1) % face_size;
+    sorted[0] = face[top];
+    is_left[0] = 1;
+    for (int k = 1; k < face_size; k++)
+    {
+        const bool take_left = (right == left) ? true : (left == bottom) ? false : (right == bottom) ? true : (_Rank[face[left]] < _Rank[face[right]]);
+        if (take_left)
+        {
+            sorted[k] = face[left];
+            is_left[k] = 1;
+            left = (left + 1) % face_size;
+        }
+        else
+        {
+            sorted[k] = face[right];
+            is_left[k] = 0;
+            right = (right + face_size - 1) % face_size;
+        }
+    }
+
+    int stack_size = 0;
+    stack[stack_size++] = 0;
+    stack[stack_size++] = 1;
+    for (int j = 2; j < face_size - 1; j++)
+    {
+        if (is_left[j] != is_left[stack[stack_size - 1]])
+        {
+            // Opposite chain: fan to all stack vertices
+            for (int k = 0; k < stack_size - 1; k++)
+            {
+                if (!EmitTriangle(&out, _Map[sorted[j]], _Map[sorted[stack[k]]], _Map[sorted[stack[k + 1]]]))
+                    return false;
+            }
+            stack_size = 0;
+            stack[stack_size++] = j - 1;
+            stack[stack_size++] = j;
+        }
+        else
+        {
+            // Same chain: add triangles while the diagonal is inside the polygon
+            int last = stack[--stack_size];
+            while (stack_size > 0)
+            {
+                const double cross = Cross(sorted[stack[stack_size - 1]], sorted[j], sorted[last]);
+                if (is_left[j] ? (cross >= 0.0) : (cross <= 0.0))
+                    break;
+                if (!EmitTriangle(&out, _Map[sorted[j]], _Map[sorted[last]], _Map[sorted[stack[stack_size - 1]]]))
+                    return false;
+                last = stack[--stack_size];
+            }
+            stack[stack_size++] = last;
+            stack[stack_size++] = j;
+        }
+    }
+    for (int k = 0; k < stack_size - 1; k++)
+    {
+        if (!EmitTriangle(&out, _Map[sorted[face_size - 1]], _Map[sorted[stack[k]]], _Map[sorted[stack[k + 1]]]))
+            return false;
+    }
+    const bool ok = (out - *p_out_triangles) == (face_size - 2) * 3;
+    *p_out_triangles = out;
+    return ok;
+}
+
+// Use ear-clipping algorithm to triangulate a simple polygon (no self-interaction, no holes).
+// (Reminder: we don't perform any coarse clipping/culling in ImDrawList layer!
+// It is up to caller to ensure not making costly calls that will be outside of visible area.
+// As concave fill is noticeably more expensive than other primitives, be mindful of this...
+// Caller can build AABB of points, and avoid filling if 'draw_list->_CmdHeader.ClipRect.Overlays(points_bb) == false')
+// Write (points_count - 2) triangles, using 'vtx_base + (point_index << vtx_shift)' as vertex index.
+// Large polygons use the sweep-line triangulator, and fallback to ear-clipping if it fails on degenerate input.
+static void ImDrawList_AddConcavePolyFilledIndices(ImDrawList* draw_list, const ImVec2* points, const int points_count, unsigned int vtx_base, int vtx_shift)
+{
+    ImDrawIdx* idx_write = draw_list->_IdxWritePtr;
+    if (points_count >= IM_DRAWLIST_CONCAVE_MONOTONE_MIN_POINTS)
+    {
+        const int scratch_size = ImTriangulatorMonotone::EstimateScratchBufferSize(points_count) + (points_count - 2) * 3 * (int)sizeof(unsigned int);
+        draw_list->_Data->TempBuffer.reserve_discard((scratch_size + (int)sizeof(ImVec2)) / (int)sizeof(ImVec2));
+        unsigned int* triangles = (unsigned int*)(void*)((char*)draw_list->_Data->TempBuffer.Data + ImTriangulatorMonotone::EstimateScratchBufferSize(points_count));
+        ImTriangulatorMonotone triangulator;
+        if (triangulator.Triangulate(points, points_count, draw_list->_Data->TempBuffer.Data, triangles))
+        {
+            for (int n = 0; n < (points_count - 2) * 3; n++)
+                idx_write[n] = (ImDrawIdx)(vtx_base + (triangles[n] << vtx_shift));
+            draw_list->_IdxWritePtr = idx_write + (points_count - 2) * 3;
+            return;
+        }
+    }
+
+    ImTriangulator triangulator;
+    unsigned int triangle[3];
+    draw_list->_Data->TempBuffer.reserve_discard((ImTriangulator::EstimateScratchBufferSize(points_count) + sizeof(ImVec2)) / sizeof(ImVec2));
+    triangulator.Init(points, points_count, draw_list->_Data->TempBuffer.Data);
+    while (triangulator._TrianglesLeft > 0)
+    {
+        triangulator.GetNextTriangle(triangle);
+        idx_write[0] = (ImDrawIdx)(vtx_base + (triangle[0] << vtx_shift)); idx_write[1] = (ImDrawIdx)(vtx_base + (triangle[1] << vtx_shift)); idx_write[2] = (ImDrawIdx)(vtx_base + (triangle[2] << vtx_shift));
+        idx_write += 3;
+    }
+    draw_list->_IdxWritePtr = idx_write;
+}
+
+void ImDrawList::AddConcavePolyFilled(const ImVec2* points, const int points_count, ImU32 col)
+{
+    if (points_count < 3 || (col & IM_COL32_A_MASK) == 0)
+        return;
+
+    const ImVec2 uv = _Data->TexUvWhitePixel;
+    if (Flags & ImDrawListFlags_AntiAliasedFill)
+    {
+        // Anti-aliased Fill
+        const float AA_SIZE = _FringeScale;
+        const ImU32 col_trans = col & ~IM_COL32_A_MASK;
+        const int idx_count = (points_count - 2) * 3 + points_count * 6;
+        const int vtx_count = (points_count * 2);
+        PrimReserve(idx_count, vtx_count);
+
+        // Add indexes for fill
+        unsigned int vtx_inner_idx = _VtxCurrentIdx;
+        unsigned int vtx_outer_idx = _VtxCurrentIdx + 1;
+
+        ImDrawList_AddConcavePolyFilledIndices(this, points, points_count, vtx_inner_idx, 1);
+
+        // Compute normals, then inner and outer points from averaged normals
+        // The first <points_count> items are normals at each point, then there are 2 temp points for each point
+        _Data->TempBuffer.reserve_discard(points_count * 3);
+        ImVec2* temp_normals = _Data->TempBuffer.Data;
+        ImVec2* temp_points = temp_normals + points_count;
+        ImDrawList_PolylineComputeNormals(points, 0, points_count - 1, temp_normals);
+        {
+            float dx = points[0].x - points[points_count - 1].x;
+            float dy = points[0].y - points[points_count - 1].y;
+            IM_NORMALIZE2F_OVER_ZERO(dx, dy);
+            temp_normals[points_count - 1].x = dy;
+            temp_normals[points_count - 1].y = -dx;
+        }
+        const float edge_scales[2] = { -AA_SIZE * 0.5f, AA_SIZE * 0.5f };
+        ImDrawList_PolylineComputeMiterPoint(points[0], temp_normals[points_count - 1], temp_normals[0], edge_scales, 2, &temp_points[0]);
+        ImDrawList_PolylineComputeMiterPoints(points, temp_normals, 1, points_count, edge_scales, 2, temp_points);
+
+        for (int i0 = points_count - 1, i1 = 0; i1 < points_count; i0 = i1++)
+        {
+            // Add vertices
+            SetVtx(&_VtxWritePtr[0], temp_points[i1 * 2 + 0], uv, col);        // Inner
+            SetVtx(&_VtxWritePtr[1], temp_points[i1 * 2 + 1], uv, col_trans);  // Outer
+            _VtxWritePtr += 2;
+
+            // Add indexes for fringes
+            _IdxWritePtr[0] = (ImDrawIdx)(vtx_inner_idx + (i1 << 1)); _IdxWritePtr[1] = (ImDrawIdx)(vtx_inner_idx + (i0 << 1)); _IdxWritePtr[2] = (ImDrawIdx)(vtx_outer_idx + (i0 << 1));
+            _IdxWritePtr[3] = (ImDrawIdx)(vtx_outer_idx + (i0 << 1)); _IdxWritePtr[4] = (ImDrawIdx)(vtx_outer_idx + (i1 << 1)); _IdxWritePtr[5] = (ImDrawIdx)(vtx_inner_idx + (i1 << 1));
+            _IdxWritePtr += 6;
+        }
+        _VtxCurrentIdx += (ImDrawIdx)vtx_count;
+    }
+    else
+    {
+        // Non Anti-aliased Fill
+        const int idx_count = (points_count - 2) * 3;
+        const int vtx_count = points_count;
+        PrimReserve(idx_count, vtx_count);
+        for (int i = 0; i < vtx_count; i++)
+        {
+            SetVtx(&_VtxWritePtr[0], points[i], uv, col);
+            _VtxWritePtr++;
+        }
+        ImDrawList_AddConcavePolyFilledIndices(this, points, points_count, _VtxCurrentIdx, 0);
+        _VtxCurrentIdx += (ImDrawIdx)vtx_count;
+    }
+}
+
+//-----------------------------------------------------------------------------
+// [SECTION] ImDrawListSplitter
+//-----------------------------------------------------------------------------
+// FIXME: This may be a little confusing, trying to be a little too low-level/optimal instead of just doing vector swap..
+//-----------------------------------------------------------------------------
+
+void ImDrawListSplitter::ClearFreeMemory()
+{
+    for (int i = 0; i < _Channels.Size; i++)
+    {
+        if (i == _Current)
+            memset(&_Channels[i], 0, sizeof(_Channels[i]));  // Current channel is a copy of CmdBuffer/IdxBuffer, don't destruct again
+        _Channels[i]._CmdBuffer.clear();
+        _Channels[i]._IdxBuffer.clear();
+    }
+    _Current = 0;
+    _Count = 1;
+    _Channels.clear();
+}
+
+void ImDrawListSplitter::Split(ImDrawList* draw_list, int channels_count)
+{
+    IM_UNUSED(draw_list);
+    IM_ASSERT(_Current == 0 && _Count <= 1 && "Nested channel splitting is not supported. Please use separate instances of ImDrawListSplitter.");
+    int old_channels_count = _Channels.Size;
+    if (old_channels_count < channels_count)
+    {
+        _Channels.reserve(channels_count); // Avoid over reserving since this is likely to stay stable
+        _Channels.resize(channels_count);
+    }
+    _Count = channels_count;
+
+    // Channels[] (24/32 bytes each) hold storage that we'll swap with draw_list->_CmdBuffer/_IdxBuffer
+    // The content of Channels[0] at this point doesn't matter. We clear it to make state tidy in a debugger but we don't strictly need to.
+    // When we switch to the next channel, we'll copy draw_list->_CmdBuffer/_IdxBuffer into Channels[0] and then Channels[1] into draw_list->CmdBuffer/_IdxBuffer
+    memset(&_Channels[0], 0, sizeof(ImDrawChannel));
+    for (int i = 1; i < channels_count; i++)
+    {
+        if (i >= old_channels_count)
+        {
+            IM_PLACEMENT_NEW(&_Channels[i]) ImDrawChannel();
+        }
+        else
+        {
+            _Channels[i]._CmdBuffer.resize(0);
             _Channels[i]._IdxBuffer.resize(0);
         }
     }
 }
 
-void ImDrawListSplitter::Merge(ImDrawList* draw_list)
+void ImDrawListSplitter::Merge(ImDrawList* draw_list, const int* channels_order)
 {
     // Note that we never use or rely on _Channels.Size because it is merely a buffer that we never shrink back to 0 to keep all sub-buffers ready for use.
     if (_Count <= 1)
         return;
+    IM_ASSERT(channels_order == NULL || channels_order[0] == 0);
 
+    if (draw_list->_SdfActive)
+        draw_list->_SetSdfRenderState(false); // Channels are always left with default render state, so they can be appended to each other
     SetCurrentChannel(draw_list, 0);
     draw_list->_PopUnusedDrawCmd();
 
-    // Calculate our final buffer sizes. Also fix the incorrect IdxOffset values in each command.
+    // Calculate our final buffer sizes (upper bound for commands, as some may be merged below).
     int new_cmd_buffer_count = 0;
     int new_idx_buffer_count = 0;
-    ImDrawCmd* last_cmd = (_Count > 0 && draw_list->CmdBuffer.Size > 0) ? &draw_list->CmdBuffer.back() : NULL;
-    int idx_offset = last_cmd ? last_cmd->IdxOffset + last_cmd->ElemCount : 0;
     for (int i = 1; i < _Count; i++)
     {
         ImDrawChannel& ch = _Channels[i];
         if (ch._CmdBuffer.Size > 0 && ch._CmdBuffer.back().ElemCount == 0 && ch._CmdBuffer.back().UserCallback == NULL) // Equivalent of PopUnusedDrawCmd()
             ch._CmdBuffer.pop_back();
-
-        if (ch._CmdBuffer.Size > 0 && last_cmd != NULL)
-        {
-            // Do not include ImDrawCmd_AreSequentialIdxOffset() in the compare as we rebuild IdxOffset values ourselves.
-            // Manipulating IdxOffset (e.g. by reordering draw commands like done by RenderDimmedBackgroundBehindWindow()) is not supported within a splitter.
-            ImDrawCmd* next_cmd = &ch._CmdBuffer[0];
-            if (ImDrawCmd_HeaderCompare(last_cmd, next_cmd) == 0 && last_cmd->UserCallback == NULL && next_cmd->UserCallback == NULL)
-            {
-                // Merge previous channel last draw command with current channel first draw command if matching.
-                last_cmd->ElemCount += next_cmd->ElemCount;
-                idx_offset += next_cmd->ElemCount;
-                ch._CmdBuffer.erase(ch._CmdBuffer.Data); // FIXME-OPT: Improve for multiple merges.
-            }
-        }
-        if (ch._CmdBuffer.Size > 0)
-            last_cmd = &ch._CmdBuffer.back();
         new_cmd_buffer_count += ch._CmdBuffer.Size;
         new_idx_buffer_count += ch._IdxBuffer.Size;
-        for (int cmd_n = 0; cmd_n < ch._CmdBuffer.Size; cmd_n++)
-        {
-            ch._CmdBuffer.Data[cmd_n].IdxOffset = idx_offset;
-            idx_offset += ch._CmdBuffer.Data[cmd_n].ElemCount;
-        }
     }
-    draw_list->CmdBuffer.resize(draw_list->CmdBuffer.Size + new_cmd_buffer_count);
+    const int cmd_buffer_base = draw_list->CmdBuffer.Size;
+    draw_list->CmdBuffer.resize(cmd_buffer_base + new_cmd_buffer_count);
     draw_list->IdxBuffer.resize(draw_list->IdxBuffer.Size + new_idx_buffer_count);
 
-    // Write commands and indices in order (they are fairly small structures, we don't copy vertices only indices)
-    ImDrawCmd* cmd_write = draw_list->CmdBuffer.Data + draw_list->CmdBuffer.Size - new_cmd_buffer_count;
+    // Write commands and indices in order, in a single pass (they are fairly small structures, we don't copy vertices only indices).
+    // Fix the incorrect IdxOffset values of each command, and merge the first command of a channel with the previous one if matching.
+    ImDrawCmd* cmd_write = draw_list->CmdBuffer.Data + cmd_buffer_base;
     ImDrawIdx* idx_write = draw_list->IdxBuffer.Data + draw_list->IdxBuffer.Size - new_idx_buffer_count;
+    ImDrawCmd* last_cmd = (cmd_buffer_base > 0) ? cmd_write - 1 : NULL;
+    int idx_offset = last_cmd ? last_cmd->IdxOffset + last_cmd->ElemCount : 0;
     for (int i = 1; i < _Count; i++)
     {
-        ImDrawChannel& ch = _Channels[i];
-        if (int sz = ch._CmdBuffer.Size) { memcpy(cmd_write, ch._CmdBuffer.Data, sz * sizeof(ImDrawCmd)); cmd_write += sz; }
+        IM_ASSERT(channels_order == NULL || (channels_order[i] > 0 && channels_order[i] < _Count));
+        ImDrawChannel& ch = _Channels[channels_order ? channels_order[i] : i];
+        const ImDrawCmd* cmd_read = ch._CmdBuffer.Data;
+        const ImDrawCmd* cmd_read_end = ch._CmdBuffer.Data + ch._CmdBuffer.Size;
+
+        // Do not include ImDrawCmd_AreSequentialIdxOffset() in the compare as we rebuild IdxOffset values ourselves.
+        // Manipulating IdxOffset (e.g. by reordering draw commands like done by RenderDimmedBackgroundBehindWindow()) is not supported within a splitter.
+        if (cmd_read < cmd_read_end && last_cmd != NULL && ImDrawCmd_HeaderCompare(last_cmd, cmd_read) == 0 && last_cmd->UserCallback == NULL && cmd_read->UserCallback == NULL)
+        {
+            last_cmd->ElemCount += cmd_read->ElemCount;
+            idx_offset += cmd_read->ElemCount;
+            cmd_read++;
+        }
+        for (; cmd_read < cmd_read_end; cmd_read++, cmd_write++)
+        {
+            *cmd_write = *cmd_read;
+            cmd_write->IdxOffset = idx_offset;
+            idx_offset += cmd_write->ElemCount;
+            last_cmd = cmd_write;
+        }
         if (int sz = ch._IdxBuffer.Size) { memcpy(idx_write, ch._IdxBuffer.Data, sz * sizeof(ImDrawIdx)); idx_write += sz; }
     }
+    draw_list->CmdBuffer.resize((int)(cmd_write - draw_list->CmdBuffer.Data));
     draw_list->_IdxWritePtr = idx_write;
 
     // Ensure there's always a non-callback draw command trailing the command-buffer
@@ -2220,6 +2983,8 @@ void ImDrawListSplitter::SetCurrentChannel(ImDrawList* draw_list, int idx)
     IM_ASSERT(idx >= 0 && idx < _Count);
     if (_Current == idx)
         return;
+    if (draw_list->_SdfActive)
+        draw_list->_SetSdfRenderState(false);
 
     // Overwrite ImVector (12/16 bytes), four times. This is merely a silly optimization instead of doing .swap()
     memcpy(&_Channels.Data[_Current]._CmdBuffer, &draw_list->CmdBuffer, sizeof(draw_list->CmdBuffer));
@@ -2246,7 +3011,7 @@ void ImDrawListSplitter::SetCurrentChannel(ImDrawList* draw_list, int idx)
 void ImDrawData::Clear()
 {
     Valid = false;
-    CmdListsCount = TotalIdxCount = TotalVtxCount = 0;
+    CmdListsCount = TotalIdxCount = TotalVtxCount = TotalIdx32Count = 0;
     CmdLists.resize(0); // The ImDrawList are NOT owned by ImDrawData but e.g. by ImGuiContext, so we don't clear them.
     DisplayPos = DisplaySize = FramebufferScale = ImVec2(0.0f, 0.0f);
     OwnerViewport = NULL;
@@ -2269,70 +3034,571 @@ void ImGui::AddDrawListToDrawDataEx(ImDrawData* draw_data, ImVector<ImDrawList*>
     if (!(draw_list->Flags & ImDrawListFlags_AllowVtxOffset))
         IM_ASSERT((int)draw_list->_VtxCurrentIdx == draw_list->VtxBuffer.Size);
 
-    // Check that draw_list doesn't use more vertices than indexable (default ImDrawIdx = unsigned short = 2 bytes = 64K vertices per ImDrawList = per window)
-    // If this assert triggers because you are drawing lots of stuff manually:
-    // - First, make sure you are coarse clipping yourself and not trying to draw many things outside visible bounds.
-    //   Be mindful that the lower-level ImDrawList API doesn't filter vertices. Use the Metrics/Debugger window to inspect draw list contents.
-    // - If you want large meshes with more than 64K vertices, you can either:
-    //   (A) Handle the ImDrawCmd::VtxOffset value in your renderer backend, and set 'io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset'.
-    //       Most example backends already support this from 1.71. Pre-1.71 backends won't.
-    //       Some graphics API such as GL ES 1/2 don't have a way to offset the starting vertex so it is not supported for them.
-    //   (B) Or handle 32-bit indices in your renderer backend, and uncomment '#define ImDrawIdx unsigned int' line in imconfig.h.
-    //       Most example backends already support this. For example, the OpenGL example code detect index size at compile-time:
-    //         glDrawElements(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, idx_buffer_offset);
-    //       Your own engine or render API may use different parameters or function calls to specify index sizes.
-    //       2 and 4 bytes indices are generally supported by most graphics API.
-    // - If for some reason neither of those solutions works for you, a workaround is to call BeginChild()/EndChild() before reaching
-    //   the 64K limit to split your draw commands in multiple draw lists.
-    if (sizeof(ImDrawIdx) == 2)
-        IM_ASSERT(draw_list->_VtxCurrentIdx < (1 << 16) && "Too many vertices in ImDrawList using 16-bit indices. Read comment above");
+    // Check that draw_list doesn't use more vertices than indexable (default ImDrawIdx = unsigned short = 2 bytes = 64K vertices per ImDrawList = per window)
+    // If this assert triggers because you are drawing lots of stuff manually:
+    // - First, make sure you are coarse clipping yourself and not trying to draw many things outside visible bounds.
+    //   Be mindful that the lower-level ImDrawList API doesn't filter vertices. Use the Metrics/Debugger window to inspect draw list contents.
+    // - If you want large meshes with more than 64K vertices, you can either:
+    //   (A) Handle the ImDrawCmd::VtxOffset value in your renderer backend, and set 'io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset'.
+    //       Most example backends already support this from 1.71. Pre-1.71 backends won't.
+    //       Some graphics API such as GL ES 1/2 don't have a way to offset the starting vertex so it is not supported for them.
+    //   (B) Or handle 32-bit indices in your renderer backend, and uncomment '#define ImDrawIdx unsigned int' line in imconfig.h.
+    //       Most example backends already support this. For example, the OpenGL example code detect index size at compile-time:
+    //         glDrawElements(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, idx_buffer_offset);
+    //       Your own engine or render API may use different parameters or function calls to specify index sizes.
+    //       2 and 4 bytes indices are generally supported by most graphics API.
+    // - If for some reason neither of those solutions works for you, a workaround is to call BeginChild()/EndChild() before reaching
+    //   the 64K limit to split your draw commands in multiple draw lists.
+    if (sizeof(ImDrawIdx) == 2)
+        IM_ASSERT(draw_list->_VtxCurrentIdx < (1 << 16) && "Too many vertices in ImDrawList using 16-bit indices. Read comment above");
+
+    // Resolve callback data pointers
+    if (draw_list->_CallbacksDataBuf.Size > 0)
+        for (ImDrawCmd& cmd : draw_list->CmdBuffer)
+            if (cmd.UserCallback != NULL && cmd.UserCallbackDataOffset != -1 && cmd.UserCallbackDataSize > 0)
+                cmd.UserCallbackData = draw_list->_CallbacksDataBuf.Data + cmd.UserCallbackDataOffset;
+
+    // Add to output list + records state in ImDrawData
+    out_list->push_back(draw_list);
+    draw_data->CmdListsCount++;
+    draw_data->TotalVtxCount += draw_list->VtxBuffer.Size;
+    draw_data->TotalIdxCount += draw_list->IdxBuffer.Size;
+    if (draw_list->CalcIdxSize() == 4)
+        draw_data->TotalIdx32Count += draw_list->IdxBuffer.Size;
+}
+
+void ImDrawData::AddDrawList(ImDrawList* draw_list)
+{
+    IM_ASSERT(CmdLists.Size == CmdListsCount);
+    draw_list->_PopUnusedDrawCmd();
+    ImGui::AddDrawListToDrawDataEx(this, &CmdLists, draw_list);
+}
+
+// For backward compatibility: convert all buffers from indexed to de-indexed, in case you cannot render indexed. Note: this is slow and most likely a waste of resources. Always prefer indexed rendering!
+void ImDrawData::DeIndexAllBuffers()
+{
+    ImVector<ImDrawVert> new_vtx_buffer;
+    TotalVtxCount = TotalIdxCount = TotalIdx32Count = 0;
+    for (ImDrawList* draw_list : CmdLists)
+    {
+        if (draw_list->IdxBuffer.empty())
+            continue;
+        new_vtx_buffer.resize(draw_list->IdxBuffer.Size);
+        for (int j = 0; j < draw_list->IdxBuffer.Size; j++)
+            new_vtx_buffer[j] = draw_list->VtxBuffer[draw_list->IdxBuffer[j]];
+        draw_list->VtxBuffer.swap(new_vtx_buffer);
+        draw_list->IdxBuffer.resize(0);
+        TotalVtxCount += draw_list->VtxBuffer.Size;
+    }
+}
+
+// Helper to scale the ClipRect field of each ImDrawCmd.
+// Use if your final output buffer is at a different scale than draw_data->DisplaySize,
+// or if there is a difference between your window resolution and framebuffer resolution.
+void ImDrawData::ScaleClipRects(const ImVec2& fb_scale)
+{
+    for (ImDrawList* draw_list : CmdLists)
+        for (ImDrawCmd& cmd : draw_list->CmdBuffer)
+            cmd.ClipRect = ImVec4(cmd.ClipRect.x * fb_scale.x, cmd.ClipRect.y * fb_scale.y, cmd.ClipRect.z * fb_scale.x, cmd.ClipRect.w * fb_scale.y);
+}
+
+// Convert a clipping rectangle to the scissor rectangle our backends would use: (int)((ClipRect - DisplayPos) * FramebufferScale)
+static ImVec4 ImDrawDataClipRectToScissorRect(const ImDrawData* draw_data, const ImVec4& clip_rect)
+{
+    const ImVec2 off = draw_data->DisplayPos;
+    const ImVec2 scale = draw_data->FramebufferScale;
+    return ImVec4((float)(int)((clip_rect.x - off.x) * scale.x), (float)(int)((clip_rect.y - off.y) * scale.y), (float)(int)((clip_rect.z - off.x) * scale.x), (float)(int)((clip_rect.w - off.y) * scale.y));
+}
+
+static inline bool ImDrawDataScissorRectContains(const ImVec4& scissor, const ImVec4& bb)
+{
+    return bb.x >= scissor.x && bb.y >= scissor.y && bb.z <= scissor.z && bb.w <= scissor.w;
+}
+
+// Helper to merge all draw lists into a single one, joining consecutive draw commands when it doesn't change the rendered output:
+// - Commands must use the same texture and must not be separated by a user callback.
+// - Commands must use the same clipping rectangle, unless their vertices are fully contained within their scissor rectangle, in which case
+//   clipping is a no-op for them and their clipping rectangle can be enlarged. Scissor rectangles are computed the same way as our backends do.
+// - Draw order is preserved, we never reorder commands.
+// 'out_list' becomes the only list of the ImDrawData and needs to stay alive until rendering is done. User callbacks will receive it as their parent list.
+// 'ctx' is the context which rendered this ImDrawData: ImDrawData may be processed on another thread or while another context is current, so we don't use GImGui.
+// Return false and leave ImDrawData untouched if merging is not possible (16-bit indices with more than 64K vertices, without ImGuiBackendFlags_RendererHasVtxOffset).
+bool ImDrawData::MergeDrawLists(ImDrawList* out_list, ImGuiContext* ctx, int* out_cmds_before, int* out_cmds_after)
+{
+    IM_ASSERT(ctx != NULL);
+    IM_ASSERT(!CmdLists.contains(out_list));
+    const bool has_vtx_offset = (ctx->IO.BackendFlags & ImGuiBackendFlags_RendererHasVtxOffset) != 0;
+    const unsigned int max_vtx_index = (sizeof(ImDrawIdx) == 2) ? 0xFFFF : 0xFFFFFFFF;
+    int cmds_before = 0;
+    for (ImDrawList* draw_list : CmdLists)
+        for (ImDrawCmd& cmd : draw_list->CmdBuffer)
+            if (cmd.UserCallback != NULL || cmd.ElemCount > 0)
+                cmds_before++;
+    if (out_cmds_before)
+        *out_cmds_before = cmds_before;
+    if (out_cmds_after)
+        *out_cmds_after = cmds_before;
+    if (!has_vtx_offset && (unsigned int)TotalVtxCount > max_vtx_index + 1u)
+        return false;
+
+    out_list->CmdBuffer.resize(0);
+    out_list->IdxBuffer.resize(0);
+    out_list->VtxBuffer.resize(0);
+    out_list->IdxBuffer.reserve(TotalIdxCount);
+    out_list->VtxBuffer.reserve(TotalVtxCount);
+    if (CmdLists.Size > 0)
+        out_list->Flags = CmdLists[0]->Flags;
+#ifdef IMGUI_USE_PACKED_DRAWVERT
+    out_list->VtxPosOrigin = ImTrunc(DisplayPos + DisplaySize * 0.5f);
+#endif
+
+    int batch_idx = -1;             // Index of current output command in out_list->CmdBuffer[]
+    bool batch_needs_clip = false;  // Set when a command in the batch needs its exact clipping rectangle
+    ImVec4 batch_vtx_bb;            // Union of vertices bounding boxes (in scissor space) when !batch_needs_clip
+    for (ImDrawList* draw_list : CmdLists)
+    {
+        const unsigned int vtx_base = (unsigned int)out_list->VtxBuffer.Size;
+        out_list->VtxBuffer.resize(out_list->VtxBuffer.Size + draw_list->VtxBuffer.Size);
+#ifdef IMGUI_USE_PACKED_DRAWVERT
+        // Packed positions are relative to each list origin: rebase them to 'out_list' origin
+        for (int vtx_n = 0; vtx_n < draw_list->VtxBuffer.Size; vtx_n++)
+        {
+            const ImDrawVert& vtx = draw_list->VtxBuffer.Data[vtx_n];
+            out_list->SetVtx(&out_list->VtxBuffer.Data[vtx_base + vtx_n], draw_list->GetVtxPos(vtx), draw_list->GetVtxUV(vtx), vtx.col);
+        }
+#else
+        if (draw_list->VtxBuffer.Size > 0)
+            memcpy(out_list->VtxBuffer.Data + vtx_base, draw_list->VtxBuffer.Data, (size_t)draw_list->VtxBuffer.size_in_bytes());
+#endif
+        bool sdf_active = false; // ImDrawCallback_SetSdfRenderState lasts until the end of its list: reset it before appending next list
+        for (const ImDrawCmd& cmd : draw_list->CmdBuffer)
+        {
+            if (cmd.UserCallback != NULL)
+            {
+                out_list->CmdBuffer.push_back(cmd);
+                ImDrawCmd& out_cmd = out_list->CmdBuffer.back();
+                out_cmd.IdxOffset = (unsigned int)out_list->IdxBuffer.Size;
+                out_cmd.VtxOffset = 0;
+                batch_idx = -1;
+                if (cmd.UserCallback == ImDrawCallback_SetSdfRenderState || cmd.UserCallback == ImDrawCallback_ResetRenderState)
+                    sdf_active = (cmd.UserCallback == ImDrawCallback_SetSdfRenderState);
+                continue;
+            }
+            if (cmd.ElemCount == 0)
+                continue;
+
+            // Compute vertices range and bounding box
+            const ImDrawIdx* src_idx = draw_list->IdxBuffer.Data + cmd.IdxOffset;
+            unsigned int idx_min = max_vtx_index, idx_max = 0;
+            for (unsigned int n = 0; n < cmd.ElemCount; n++)
+            {
+                idx_min = ImMin(idx_min, (unsigned int)src_idx[n]);
+                idx_max = ImMax(idx_max, (unsigned int)src_idx[n]);
+            }
+            ImVec4 vtx_bb(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
+            for (unsigned int vtx_n = idx_min; vtx_n <= idx_max; vtx_n++)
+            {
+                const ImVec2 pos = draw_list->GetVtxPos(draw_list->VtxBuffer.Data[cmd.VtxOffset + vtx_n]);
+                vtx_bb.x = ImMin(vtx_bb.x, pos.x); vtx_bb.y = ImMin(vtx_bb.y, pos.y);
+                vtx_bb.z = ImMax(vtx_bb.z, pos.x); vtx_bb.w = ImMax(vtx_bb.w, pos.y);
+            }
+            vtx_bb = ImVec4((vtx_bb.x - DisplayPos.x) * FramebufferScale.x, (vtx_bb.y - DisplayPos.y) * FramebufferScale.y, (vtx_bb.z - DisplayPos.x) * FramebufferScale.x, (vtx_bb.w - DisplayPos.y) * FramebufferScale.y);
+            const bool needs_clip = !ImDrawDataScissorRectContains(ImDrawDataClipRectToScissorRect(this, cmd.ClipRect), vtx_bb);
+            const unsigned int vtx_min = vtx_base + cmd.VtxOffset + idx_min;
+            const unsigned int vtx_max = vtx_base + cmd.VtxOffset + idx_max;
+
+            // Try to append to current batch
+            bool can_merge = false;
+            if (batch_idx != -1)
+            {
+                const ImDrawCmd& batch = out_list->CmdBuffer[batch_idx];
+                can_merge = batch.TexRef == cmd.TexRef && vtx_min >= batch.VtxOffset && vtx_max - batch.VtxOffset <= max_vtx_index;
+                if (can_merge && needs_clip)
+                    can_merge = batch_needs_clip ? (batch.ClipRect == cmd.ClipRect) : ImDrawDataScissorRectContains(ImDrawDataClipRectToScissorRect(this, cmd.ClipRect), batch_vtx_bb);
+                else if (can_merge && batch_needs_clip)
+                    can_merge = ImDrawDataScissorRectContains(ImDrawDataClipRectToScissorRect(this, batch.ClipRect), vtx_bb);
+            }
+            if (!can_merge)
+            {
+                batch_idx = out_list->CmdBuffer.Size;
+                out_list->CmdBuffer.push_back(cmd);
+                ImDrawCmd& batch = out_list->CmdBuffer.back();
+                batch.VtxOffset = has_vtx_offset ? vtx_min : 0;
+                batch.IdxOffset = (unsigned int)out_list->IdxBuffer.Size;
+                batch.ElemCount = 0;
+                batch_needs_clip = needs_clip;
+                batch_vtx_bb = vtx_bb;
+            }
+            else
+            {
+                ImDrawCmd& batch = out_list->CmdBuffer[batch_idx];
+                if (needs_clip && !batch_needs_clip)
+                {
+                    batch.ClipRect = cmd.ClipRect;
+                    batch_needs_clip = true;
+                }
+                else if (!needs_clip && !batch_needs_clip)
+                {
+                    batch.ClipRect = ImVec4(ImMin(batch.ClipRect.x, cmd.ClipRect.x), ImMin(batch.ClipRect.y, cmd.ClipRect.y), ImMax(batch.ClipRect.z, cmd.ClipRect.z), ImMax(batch.ClipRect.w, cmd.ClipRect.w));
+                    batch_vtx_bb = ImVec4(ImMin(batch_vtx_bb.x, vtx_bb.x), ImMin(batch_vtx_bb.y, vtx_bb.y), ImMax(batch_vtx_bb.z, vtx_bb.z), ImMax(batch_vtx_bb.w, vtx_bb.w));
+                }
+            }
+
+            // Append rebased indices
+            ImDrawCmd& batch = out_list->CmdBuffer[batch_idx];
+            const unsigned int idx_rebase = vtx_base + cmd.VtxOffset - batch.VtxOffset;
+            out_list->IdxBuffer.resize(out_list->IdxBuffer.Size + (int)cmd.ElemCount);
+            ImDrawIdx* dst_idx = out_list->IdxBuffer.Data + out_list->IdxBuffer.Size - cmd.ElemCount;
+            for (unsigned int n = 0; n < cmd.ElemCount; n++)
+                dst_idx[n] = (ImDrawIdx)(src_idx[n] + idx_rebase);
+            batch.ElemCount += cmd.ElemCount;
+        }
+        if (sdf_active && draw_list != CmdLists.back())
+        {
+            ImDrawCmd reset_cmd;
+            reset_cmd.UserCallback = ImDrawCallback_ResetRenderState;
+            reset_cmd.UserCallbackDataOffset = -1;
+            reset_cmd.IdxOffset = (unsigned int)out_list->IdxBuffer.Size;
+            out_list->CmdBuffer.push_back(reset_cmd);
+            batch_idx = -1;
+        }
+    }
+    out_list->_VtxWritePtr = out_list->VtxBuffer.Data + out_list->VtxBuffer.Size;
+    out_list->_IdxWritePtr = out_list->IdxBuffer.Data + out_list->IdxBuffer.Size;
+    out_list->_VtxCurrentIdx = 0;
+
+    CmdLists.resize(0);
+    CmdLists.push_back(out_list);
+    CmdListsCount = 1;
+    TotalVtxCount = out_list->VtxBuffer.Size;
+    TotalIdxCount = out_list->IdxBuffer.Size;
+    TotalIdx32Count = (out_list->CalcIdxSize() == 4) ? TotalIdxCount : 0;
+    if (out_cmds_after)
+        *out_cmds_after = out_list->CmdBuffer.Size;
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// [SECTION] ImDrawDataDamageTracker
+//-----------------------------------------------------------------------------
+
+// Average chunk size is 32 triangles (a chunk ends after a triangle whose hash has its 5 low bits cleared), capped to 256 triangles.
+// Deriving chunk boundaries from contents means that inserting or removing triangles only affects surrounding chunks.
+#define IM_DRAWDATA_DAMAGE_CHUNK_BOUNDARY_MASK  31
+#define IM_DRAWDATA_DAMAGE_CHUNK_MAX_TRIANGLES  256
+
+static inline ImU32 ImDrawDataDamageHashMix(ImU32 h, ImU32 v)
+{
+    h ^= v;
+    h *= 0x9E3779B1u;
+    return h ^ (h >> 15);
+}
+
+static ImU32 ImDrawDataDamageHashVertex(ImU32 h, const ImDrawVert* vtx)
+{
+    IM_STATIC_ASSERT((sizeof(ImDrawVert) % 4) == 0);
+    const ImU32* words = (const ImU32*)(const void*)vtx;
+    for (int n = 0; n < (int)(sizeof(ImDrawVert) / 4); n++)
+        h = ImDrawDataDamageHashMix(h, words[n]);
+    return h;
+}
+
+static int IMGUI_CDECL ImDrawDataDamageChunkComparerByHash(const void* lhs, const void* rhs)
+{
+    const ImDrawDataDamageChunk* a = (const ImDrawDataDamageChunk*)lhs;
+    const ImDrawDataDamageChunk* b = (const ImDrawDataDamageChunk*)rhs;
+    if (a->Hash != b->Hash)
+        return (a->Hash < b->Hash) ? -1 : +1;
+    return a->Order - b->Order;
+}
+
+static void ImDrawDataDamageAddChunk(ImVector<ImDrawDataDamageChunk>* chunks, ImU32 hash, ImVec4 bb, const ImVec4& scissor)
+{
+    // Convert to pixels touched by the geometry: pixel (x,y) may be covered if its center is within bounding box.
+    ImDrawDataDamageChunk chunk;
+    chunk.Hash = hash;
+    chunk.Order = chunks->Size;
+    chunk.Rect = ImVec4(ImMax(ImFloor(bb.x), scissor.x), ImMax(ImFloor(bb.y), scissor.y), ImMin(ImCeil(bb.z), scissor.z), ImMin(ImCeil(bb.w), scissor.w));
+    if (chunk.Rect.z <= chunk.Rect.x || chunk.Rect.w <= chunk.Rect.y)
+        return;
+    chunks->push_back(chunk);
+}
+
+// Add a rectangle to DamageRects[], merging it with rectangles it overlaps so that output rectangles never overlap.
+void ImDrawDataDamageTracker::AddDamageRect(const ImVec4& rect)
+{
+    ImVec4 r = rect;
+    if (r.z <= r.x || r.w <= r.y)
+        return;
+    for (int n = 0; n < DamageRects.Size; n++)
+    {
+        const ImVec4& other = DamageRects[n];
+        if (r.x < other.z && r.z > other.x && r.y < other.w && r.w > other.y)
+        {
+            // Merge and restart, as the enlarged rectangle may now overlap rectangles we already tested
+            r = ImVec4(ImMin(r.x, other.x), ImMin(r.y, other.y), ImMax(r.z, other.z), ImMax(r.w, other.w));
+            DamageRects.erase(DamageRects.Data + n);
+            n = -1;
+        }
+    }
+    DamageRects.push_back(r);
+    if (DamageRects.Size > DamageRectsMax)
+    {
+        for (const ImVec4& other : DamageRects)
+            r = ImVec4(ImMin(r.x, other.x), ImMin(r.y, other.y), ImMax(r.z, other.z), ImMax(r.w, other.w));
+        DamageRects.resize(1);
+        DamageRects[0] = r;
+    }
+}
+
+void ImDrawDataDamageTracker::Update(const ImDrawData* draw_data)
+{
+    DamageRects.resize(0);
+    const ImVec2 clip_off = draw_data->DisplayPos;
+    const ImVec2 clip_scale = draw_data->FramebufferScale;
+    const ImVec4 display_rect(0.0f, 0.0f, (float)(int)(draw_data->DisplaySize.x * clip_scale.x), (float)(int)(draw_data->DisplaySize.y * clip_scale.y));
+    const float display_key_data[6] = { clip_off.x, clip_off.y, draw_data->DisplaySize.x, draw_data->DisplaySize.y, clip_scale.x, clip_scale.y };
+    const ImU32 display_key = ImHashData(display_key_data, sizeof(display_key_data));
+
+    // Build chunks for current frame
+    _CurrChunks.resize(0);
+    for (const ImDrawList* draw_list : draw_data->CmdLists)
+    {
+        bool sdf_active = false; // ImDrawCallback_SetSdfRenderState lasts until next ImDrawCallback_ResetRenderState or end of list
+        for (const ImDrawCmd& cmd : draw_list->CmdBuffer)
+        {
+            // Internal render state callbacks don't draw anything: fold the state into following geometry chunks,
+            // so that only triangles actually rendered differently are damaged.
+            if (cmd.UserCallback == ImDrawCallback_ResetRenderState || cmd.UserCallback == ImDrawCallback_SetSdfRenderState)
+            {
+                sdf_active = (cmd.UserCallback == ImDrawCallback_SetSdfRenderState);
+                continue;
+            }
+            const ImVec4 clip_scissor = ImDrawDataClipRectToScissorRect(draw_data, cmd.ClipRect);
+            const ImVec4 scissor(ImMax(clip_scissor.x, display_rect.x), ImMax(clip_scissor.y, display_rect.y), ImMin(clip_scissor.z, display_rect.z), ImMin(clip_scissor.w, display_rect.w));
+            if (scissor.z <= scissor.x || scissor.w <= scissor.y)
+                continue;
+            ImU32 seed = ImHashData(&scissor, sizeof(scissor));
+            if (cmd.UserCallback != NULL)
+            {
+                seed = ImHashData(&cmd.UserCallback, sizeof(cmd.UserCallback), seed);
+                seed = ImHashData(&cmd.UserCallbackData, sizeof(cmd.UserCallbackData), seed);
+                ImDrawDataDamageAddChunk(&_CurrChunks, seed, scissor, scissor);
+                continue;
+            }
+            seed = ImHashData(&cmd.TexRef, sizeof(cmd.TexRef), seed);
+            seed = ImHashData(&sdf_active, sizeof(sdf_active), seed);
+#ifdef IMGUI_USE_PACKED_DRAWVERT
+            seed = ImHashData(&draw_list->VtxPosOrigin, sizeof(draw_list->VtxPosOrigin), seed); // Packed positions are relative to it
+#endif
+
+            const ImDrawVert* vtx_buffer = draw_list->VtxBuffer.Data + cmd.VtxOffset;
+            const ImDrawIdx* idx_buffer = draw_list->IdxBuffer.Data + cmd.IdxOffset;
+            ImU32 chunk_hash = seed;
+            ImVec4 chunk_bb(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
+            int chunk_triangles = 0;
+            for (unsigned int idx_n = 0; idx_n + 2 < cmd.ElemCount; idx_n += 3)
+            {
+                ImU32 tri_hash = 0;
+                for (int n = 0; n < 3; n++)
+                {
+                    const ImDrawVert* vtx = &vtx_buffer[idx_buffer[idx_n + n]];
+                    tri_hash = ImDrawDataDamageHashVertex(tri_hash, vtx);
+                    const ImVec2 pos = draw_list->GetVtxPos(*vtx);
+                    chunk_bb.x = ImMin(chunk_bb.x, pos.x); chunk_bb.y = ImMin(chunk_bb.y, pos.y);
+                    chunk_bb.z = ImMax(chunk_bb.z, pos.x); chunk_bb.w = ImMax(chunk_bb.w, pos.y);
+                }
+                chunk_hash = ImDrawDataDamageHashMix(chunk_hash, tri_hash);
+                chunk_triangles++;
+                if ((tri_hash & IM_DRAWDATA_DAMAGE_CHUNK_BOUNDARY_MASK) == 0 || chunk_triangles == IM_DRAWDATA_DAMAGE_CHUNK_MAX_TRIANGLES || idx_n + 5 >= cmd.ElemCount)
+                {
+                    const ImVec4 bb((chunk_bb.x - clip_off.x) * clip_scale.x, (chunk_bb.y - clip_off.y) * clip_scale.y, (chunk_bb.z - clip_off.x) * clip_scale.x, (chunk_bb.w - clip_off.y) * clip_scale.y);
+                    ImDrawDataDamageAddChunk(&_CurrChunks, chunk_hash, bb, scissor);
+                    chunk_hash = seed;
+                    chunk_bb = ImVec4(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
+                    chunk_triangles = 0;
+                }
+            }
+        }
+    }
+
+    FullDamage = !_PrevValid || _PrevDisplayKey != display_key;
+    if (FullDamage)
+    {
+        DamageRects.push_back(display_rect);
+    }
+    else
+    {
+        // Match current chunks with previous ones, in draw order.
+        // A chunk matched with a previous chunk which was drawn before the last matched one has moved in draw order, and may now be above/below different contents.
+        ImQsort(_PrevChunks.Data, (size_t)_PrevChunks.Size, sizeof(ImDrawDataDamageChunk), ImDrawDataDamageChunkComparerByHash);
+        int last_matched_order = -1;
+        for (const ImDrawDataDamageChunk& chunk : _CurrChunks)
+        {
+            // Binary search first previous chunk with same hash, then pick first one not already matched
+            int lo = 0, hi = _PrevChunks.Size;
+            while (lo < hi)
+            {
+                const int mid = (lo + hi) >> 1;
+                if (_PrevChunks[mid].Hash < chunk.Hash)
+                    lo = mid + 1;
+                else
+                    hi = mid;
+            }
+            while (lo < _PrevChunks.Size && _PrevChunks[lo].Hash == chunk.Hash && _PrevChunks[lo].Order == -1)
+                lo++;
+            if (lo == _PrevChunks.Size || _PrevChunks[lo].Hash != chunk.Hash)
+            {
+                AddDamageRect(chunk.Rect);
+                continue;
+            }
+            if (_PrevChunks[lo].Order < last_matched_order)
+                AddDamageRect(chunk.Rect);
+            else
+                last_matched_order = _PrevChunks[lo].Order;
+            _PrevChunks[lo].Order = -1;
+        }
+
+        // Previous chunks which are not drawn anymore
+        for (const ImDrawDataDamageChunk& chunk : _PrevChunks)
+            if (chunk.Order != -1)
+                AddDamageRect(chunk.Rect);
+    }
+
+    _PrevChunks.swap(_CurrChunks);
+    _PrevDisplayKey = display_key;
+    _PrevValid = true;
+}
+
+//-----------------------------------------------------------------------------
+// [SECTION] ImDrawList worker threads helpers
+//-----------------------------------------------------------------------------
+// ImDrawList itself has no global state, but the ImDrawListSharedData owned by the context is not thread-safe:
+// - TempBuffer[] is shared by all draw lists.
+// - TexUvLines and font lookups point into ImFontAtlas data which the main thread may modify at any time (e.g. loading a new glyph).
+// Worker copies hold their own TempBuffer and read-only snapshots of the atlas data they need, and are never registered into the atlas.
+// Note that ImGui::MemAlloc() still updates the context allocation counters (displayed in Metrics), those may be slightly off while workers are running.
+//-----------------------------------------------------------------------------
 
-    // Resolve callback data pointers
-    if (draw_list->_CallbacksDataBuf.Size > 0)
-        for (ImDrawCmd& cmd : draw_list->CmdBuffer)
-            if (cmd.UserCallback != NULL && cmd.UserCallbackDataOffset != -1 && cmd.UserCallbackDataSize > 0)
-                cmd.UserCallbackData = draw_list->_CallbacksDataBuf.Data + cmd.UserCallbackDataOffset;
+static void ImFontAtlasBuildSetupFontBakedFallback(ImFontBaked* baked);
 
-    // Add to output list + records state in ImDrawData
-    out_list->push_back(draw_list);
-    draw_data->CmdListsCount++;
-    draw_data->TotalVtxCount += draw_list->VtxBuffer.Size;
-    draw_data->TotalIdxCount += draw_list->IdxBuffer.Size;
+// Copy drawing settings from the current context. Call from main thread, after NewFrame() and before dispatching work to workers.
+void ImGui::SetupWorkerDrawListSharedData(ImDrawListSharedData* worker_data)
+{
+    ImGuiContext& g = *GImGui;
+    const ImDrawListSharedData* src = &g.DrawListSharedData;
+    IM_ASSERT(worker_data != src && "Cannot use the context's own ImDrawListSharedData as a worker copy!");
+    ImFontAtlas* atlas = src->FontAtlas;
+
+    worker_data->IsWorkerCopy = true;
+    worker_data->FontAtlas = atlas;
+    worker_data->Font = src->Font;
+    worker_data->FontSize = src->FontSize;
+    worker_data->FontScale = src->FontScale;
+    worker_data->CurveTessellationTol = src->CurveTessellationTol;
+    worker_data->InitialFringeScale = src->InitialFringeScale;
+    worker_data->InitialFlags = src->InitialFlags;
+    worker_data->ClipRectFullscreen = src->ClipRectFullscreen;
+    worker_data->Context = NULL;
+    worker_data->SetCircleTessellationMaxError(src->CircleSegmentMaxError);
+
+    worker_data->WorkerFontRasterizerDensity = g.FontRasterizerDensity;
+    worker_data->TexUvWhitePixel = atlas->TexUvWhitePixel;
+    memcpy(worker_data->WorkerTexUvLines, atlas->TexUvLines, sizeof(worker_data->WorkerTexUvLines));
+    worker_data->TexUvLines = worker_data->WorkerTexUvLines;
+    worker_data->WorkerTexRef = atlas->TexRef;
+    worker_data->WorkerTexData = atlas->TexData;
+    worker_data->WorkerTexPages.resize(0);
+    if (atlas->Builder != NULL)
+        for (ImFontAtlasPage* page : atlas->Builder->Pages)
+            worker_data->WorkerTexPages.push_back(page->Tex);
+
+    for (ImFontBaked* baked : worker_data->WorkerFontBakeds)
+        IM_DELETE(baked);
+    worker_data->WorkerFontBakeds.resize(0);
+    if (worker_data->Font != NULL)
+        AddWorkerDrawListFont(worker_data, worker_data->Font, worker_data->FontSize);
+}
+
+// Snapshot glyph tables for a given font size. Call from main thread, after SetupWorkerDrawListSharedData().
+// Pass text you expect workers to render in 'preload_text' so its glyphs get loaded in the atlas first.
+void ImGui::AddWorkerDrawListFont(ImDrawListSharedData* worker_data, ImFont* font, float font_size, const char* preload_text, const char* preload_text_end)
+{
+    IM_ASSERT(worker_data->IsWorkerCopy && "Call SetupWorkerDrawListSharedData() first!");
+    ImFontBaked* baked = font->GetFontBaked(font_size, worker_data->WorkerFontRasterizerDensity);
+    if (baked == NULL)
+        return;
+    if (preload_text != NULL)
+    {
+        if (preload_text_end == NULL)
+            preload_text_end = preload_text + ImStrlen(preload_text);
+        ImFontAtlasBakedLoadGlyphsForText(font->ContainerAtlas, baked, preload_text, preload_text_end);
+    }
+    if (baked->FallbackGlyphIndex == -1)
+        ImFontAtlasBuildSetupFontBakedFallback(baked);
+
+    // Loading glyphs may have grown the atlas texture, or added a page (ImFontAtlasFlags_MultiPage)
+    IM_ASSERT(worker_data->WorkerTexData == font->ContainerAtlas->TexData && "Atlas texture changed since SetupWorkerDrawListSharedData(): call it again.");
+    ImVector<ImFontAtlasPage*>& pages = font->ContainerAtlas->Builder->Pages;
+    for (int page_n = 0; page_n < pages.Size; page_n++)
+        if (page_n < worker_data->WorkerTexPages.Size)
+            IM_ASSERT(worker_data->WorkerTexPages[page_n] == pages[page_n]->Tex && "Atlas texture changed since SetupWorkerDrawListSharedData(): call it again.");
+        else
+            worker_data->WorkerTexPages.push_back(pages[page_n]->Tex);
+
+    for (ImFontBaked*& existing : worker_data->WorkerFontBakeds)
+        if (existing->BakedId == baked->BakedId)
+        {
+            IM_DELETE(existing);
+            worker_data->WorkerFontBakeds.erase(&existing);
+            break;
+        }
+    ImFontBaked* baked_copy = IM_NEW(ImFontBaked)(*baked);
+    baked_copy->FontLoaderDatas = NULL;
+    worker_data->WorkerFontBakeds.push_back(baked_copy);
 }
 
-void ImDrawData::AddDrawList(ImDrawList* draw_list)
+// Call from worker thread before drawing: equivalent of what NewFrame() does for window draw lists.
+void ImGui::ResetWorkerDrawList(ImDrawList* draw_list)
 {
-    IM_ASSERT(CmdLists.Size == CmdListsCount);
-    draw_list->_PopUnusedDrawCmd();
-    ImGui::AddDrawListToDrawDataEx(this, &CmdLists, draw_list);
+    ImDrawListSharedData* data = draw_list->_Data;
+    IM_ASSERT(data != NULL && data->IsWorkerCopy);
+    draw_list->_ResetForNewFrame();
+    draw_list->PushTexture(data->WorkerTexRef);
+    draw_list->PushClipRectFullScreen();
 }
 
-// For backward compatibility: convert all buffers from indexed to de-indexed, in case you cannot render indexed. Note: this is slow and most likely a waste of resources. Always prefer indexed rendering!
-void ImDrawData::DeIndexAllBuffers()
+static bool ImDrawListSharedDataAreWorkerTexPagesValid(ImDrawListSharedData* worker_data)
 {
-    ImVector<ImDrawVert> new_vtx_buffer;
-    TotalVtxCount = TotalIdxCount = 0;
-    for (ImDrawList* draw_list : CmdLists)
-    {
-        if (draw_list->IdxBuffer.empty())
-            continue;
-        new_vtx_buffer.resize(draw_list->IdxBuffer.Size);
-        for (int j = 0; j < draw_list->IdxBuffer.Size; j++)
-            new_vtx_buffer[j] = draw_list->VtxBuffer[draw_list->IdxBuffer[j]];
-        draw_list->VtxBuffer.swap(new_vtx_buffer);
-        draw_list->IdxBuffer.resize(0);
-        TotalVtxCount += draw_list->VtxBuffer.Size;
-    }
+    ImFontAtlas* atlas = worker_data->FontAtlas;
+    if (atlas->Builder == NULL)
+        return worker_data->WorkerTexPages.Size <= 1;
+    if (worker_data->WorkerTexPages.Size > atlas->Builder->Pages.Size)
+        return false;
+    for (int page_n = 1; page_n < worker_data->WorkerTexPages.Size; page_n++)
+        if (worker_data->WorkerTexPages[page_n] != atlas->Builder->Pages[page_n]->Tex)
+            return false;
+    return true;
 }
 
-// Helper to scale the ClipRect field of each ImDrawCmd.
-// Use if your final output buffer is at a different scale than draw_data->DisplaySize,
-// or if there is a difference between your window resolution and framebuffer resolution.
-void ImDrawData::ScaleClipRects(const ImVec2& fb_scale)
+// Call from main thread once all workers are done, typically with draw_data == GetDrawData() after Render().
+int ImGui::AddWorkerDrawListsToDrawData(ImDrawData* draw_data, ImDrawList* const* draw_lists, int draw_lists_count)
 {
-    for (ImDrawList* draw_list : CmdLists)
-        for (ImDrawCmd& cmd : draw_list->CmdBuffer)
-            cmd.ClipRect = ImVec4(cmd.ClipRect.x * fb_scale.x, cmd.ClipRect.y * fb_scale.y, cmd.ClipRect.z * fb_scale.x, cmd.ClipRect.w * fb_scale.y);
+    int added_count = 0;
+    for (int n = 0; n < draw_lists_count; n++)
+    {
+        ImDrawList* draw_list = draw_lists[n];
+        IM_ASSERT(draw_list->_Data != NULL && draw_list->_Data->IsWorkerCopy);
+        IM_ASSERT(draw_list->_Splitter._Count <= 1 && "Forgot to call ImDrawListSplitter::Merge() on worker draw list?");
+        ImFontAtlas* atlas = draw_list->_Data->FontAtlas;
+        if (atlas != NULL && atlas->TexData != draw_list->_Data->WorkerTexData)
+            continue; // Atlas texture was replaced (e.g. grown) while workers were running: UV are stale.
+        if (atlas != NULL && !ImDrawListSharedDataAreWorkerTexPagesValid(draw_list->_Data))
+            continue; // Same for a texture page (ImFontAtlasFlags_MultiPage) being repacked or released.
+        draw_data->AddDrawList(draw_list);
+        added_count++;
+    }
+    return added_count;
 }
 
 //-----------------------------------------------------------------------------
@@ -2354,7 +3620,7 @@ void ImGui::ShadeVertsLinearColorGradientKeepAlpha(ImDrawList* draw_list, int ve
     const int col_delta_b = ((int)(col1 >> IM_COL32_B_SHIFT) & 0xFF) - col0_b;
     for (ImDrawVert* vert = vert_start; vert < vert_end; vert++)
     {
-        float d = ImDot(vert->pos - gradient_p0, gradient_extent);
+        float d = ImDot(draw_list->GetVtxPos(*vert) - gradient_p0, gradient_extent);
         float t = ImClamp(d * gradient_inv_length2, 0.0f, 1.0f);
         int r = (int)(col0_r + col_delta_r * t);
         int g = (int)(col0_g + col_delta_g * t);
@@ -2379,12 +3645,18 @@ void ImGui::ShadeVertsLinearUV(ImDrawList* draw_list, int vert_start_idx, int ve
         const ImVec2 min = ImMin(uv_a, uv_b);
         const ImVec2 max = ImMax(uv_a, uv_b);
         for (ImDrawVert* vertex = vert_start; vertex < vert_end; ++vertex)
-            vertex->uv = ImClamp(uv_a + ImMul(ImVec2(vertex->pos.x, vertex->pos.y) - a, scale), min, max);
+        {
+            const ImVec2 pos = draw_list->GetVtxPos(*vertex);
+            draw_list->SetVtx(vertex, pos, ImClamp(uv_a + ImMul(pos - a, scale), min, max), vertex->col);
+        }
     }
     else
     {
         for (ImDrawVert* vertex = vert_start; vertex < vert_end; ++vertex)
-            vertex->uv = uv_a + ImMul(ImVec2(vertex->pos.x, vertex->pos.y) - a, scale);
+        {
+            const ImVec2 pos = draw_list->GetVtxPos(*vertex);
+            draw_list->SetVtx(vertex, pos, uv_a + ImMul(pos - a, scale), vertex->col);
+        }
     }
 }
 
@@ -2393,7 +3665,7 @@ void ImGui::ShadeVertsTransformPos(ImDrawList* draw_list, int vert_start_idx, in
     ImDrawVert* vert_start = draw_list->VtxBuffer.Data + vert_start_idx;
     ImDrawVert* vert_end = draw_list->VtxBuffer.Data + vert_end_idx;
     for (ImDrawVert* vertex = vert_start; vertex < vert_end; ++vertex)
-        vertex->pos = ImRotate(vertex->pos- pivot_in, cos_a, sin_a) + pivot_out;
+        draw_list->SetVtx(vertex, ImRotate(draw_list->GetVtxPos(*vertex) - pivot_in, cos_a, sin_a) + pivot_out, draw_list->GetVtxUV(*vertex), vertex->col);
 }
 
 //-----------------------------------------------------------------------------
@@ -2418,6 +3690,7 @@ ImFontConfig::ImFontConfig()
 //-----------------------------------------------------------------------------
 // - ImTextureData::Create()
 // - ImTextureData::DestroyPixels()
+// - ImTextureDataMergeUpdates()
 //-----------------------------------------------------------------------------
 
 int ImTextureDataGetFormatBytesPerPixel(ImTextureFormat format)
@@ -2480,6 +3753,69 @@ void ImTextureData::DestroyPixels()
     UseColors = false;
 }
 
+static int IMGUI_CDECL ImTextureRectComparerByYX(const void* lhs, const void* rhs)
+{
+    const ImTextureRect* a = (const ImTextureRect*)lhs;
+    const ImTextureRect* b = (const ImTextureRect*)rhs;
+    if (a->y != b->y)
+        return (a->y < b->y) ? -1 : +1;
+    return (a->x < b->x) ? -1 : (a->x > b->x) ? +1 : 0;
+}
+
+// Merge queued Updates[] rectangles (e.g. many small adjacent glyphs) into fewer and larger ones.
+// Two rectangles are merged when the pixels of their bounding box which were not requested are at most 'max_waste' of the bounding box.
+// Merged rectangles may include pixels which are not part of any request: this is fine as Pixels[] is always the reference.
+void ImTextureDataMergeUpdates(ImTextureData* tex, float max_waste)
+{
+    ImVector<ImTextureRect>& rects = tex->Updates;
+    if (max_waste < 0.0f || rects.Size < 2)
+        return;
+
+    // Sort so rectangles of a same packing row tend to be consecutive, then merge each into first compatible output rectangle.
+    // Output rectangles are merged together again until stable, which is cheap as there are generally few of them.
+    ImQsort(rects.Data, (size_t)rects.Size, sizeof(ImTextureRect), ImTextureRectComparerByYX);
+    ImVector<int> requested_surfaces;
+    requested_surfaces.resize(rects.Size);
+    int out_count = 0;
+    for (int pass = 0; ; pass++)
+    {
+        const int in_count = (pass == 0) ? rects.Size : out_count;
+        bool merged_any = false;
+        out_count = 0;
+        for (int in_n = 0; in_n < in_count; in_n++)
+        {
+            ImTextureRect r = rects[in_n];
+            int r_surface = (pass == 0) ? r.w * r.h : requested_surfaces[in_n];
+            int out_n = 0;
+            for (; out_n < out_count; out_n++)
+            {
+                ImTextureRect& out_r = rects[out_n];
+                const int x0 = ImMin(out_r.x, r.x), y0 = ImMin(out_r.y, r.y);
+                const int x1 = ImMax(out_r.x + out_r.w, r.x + r.w), y1 = ImMax(out_r.y + out_r.h, r.y + r.h);
+                const int merged_surface = (x1 - x0) * (y1 - y0);
+                if (merged_surface - (requested_surfaces[out_n] + r_surface) > merged_surface * max_waste)
+                    continue;
+                out_r.x = (unsigned short)x0;
+                out_r.y = (unsigned short)y0;
+                out_r.w = (unsigned short)(x1 - x0);
+                out_r.h = (unsigned short)(y1 - y0);
+                requested_surfaces[out_n] += r_surface;
+                merged_any = true;
+                break;
+            }
+            if (out_n == out_count)
+            {
+                rects[out_count] = r;
+                requested_surfaces[out_count] = r_surface;
+                out_count++;
+            }
+        }
+        if (!merged_any || out_count < 2)
+            break;
+    }
+    rects.resize(out_count);
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] ImFontAtlas, ImFontAtlasBuilder
 //-----------------------------------------------------------------------------
@@ -2562,8 +3898,22 @@ void ImTextureData::DestroyPixels()
 // - ImFontBaked_BuildGrowIndex()
 // - ImFontBaked_BuildLoadGlyph()
 // - ImFontBaked_BuildLoadGlyphAdvanceX()
+// - ImFontAtlasBuildBeginGlyphJobs()
+// - ImFontAtlasBuildEndGlyphJobs()
+// - ImFontAtlasBuildAddGlyphJob()
+// - ImFontAtlasBuildFlushGlyphJobs()
+// - ImFontAtlasBakedLoadGlyphsForText()
 // - ImFontAtlasDebugLogTextureRequests()
 //-----------------------------------------------------------------------------
+// - ImFontAtlas::LoadGlyphCacheFromFile()
+// - ImFontAtlas::LoadGlyphCacheFromMemory()
+// - ImFontAtlas::SaveGlyphCacheToFile()
+// - ImFontAtlasGlyphCacheCreate()
+// - ImFontAtlasGlyphCacheDestroy()
+// - ImFontAtlasGlyphCacheGetKey()
+// - ImFontAtlasGlyphCacheFind()
+// - ImFontAtlasGlyphCacheLoadGlyph()
+//-----------------------------------------------------------------------------
 // - ImFontAtlasGetFontLoaderForStbTruetype()
 //-----------------------------------------------------------------------------
 
@@ -2631,6 +3981,7 @@ ImFontAtlas::ImFontAtlas()
     TexMinHeight = 128;
     TexMaxWidth = 8192;
     TexMaxHeight = 8192;
+    TexUpdatesMergeWaste = 0.50f;
     TexRef._TexID = ImTextureID_Invalid;
     RendererHasTextures = false; // Assumed false by default, as apps can call e.g Atlas::Build() after backend init and before ImGui can update.
     TexNextUniqueID = 1;
@@ -2646,6 +3997,9 @@ ImFontAtlas::~ImFontAtlas()
     ClearTexData();
     TexList.clear_delete();
     TexData = NULL;
+    if (GlyphCache)
+        ImFontAtlasGlyphCacheDestroy(GlyphCache);
+    GlyphCache = NULL;
 }
 
 void ImFontAtlas::Clear()
@@ -2864,8 +4218,8 @@ void ImFontAtlasTextureBlockConvert(const unsigned char* src_pixels, ImTextureFo
 // Post-process hooks may eventually be added here.
 void ImFontAtlasTextureBlockPostProcess(ImFontAtlasPostProcessData* data)
 {
-    // Multiply operator (legacy)
-    if (data->FontSrc->RasterizerMultiply != 1.0f)
+    // Multiply operator (legacy). Not applicable to distance values.
+    if (data->FontSrc->RasterizerMultiply != 1.0f && (data->Font->Flags & ImFontFlags_SDF) == 0)
         ImFontAtlasTextureBlockPostProcessMultiply(data, data->FontSrc->RasterizerMultiply);
 }
 
@@ -3033,6 +4387,7 @@ ImFont* ImFontAtlas::AddFont(const ImFontConfig* font_cfg_in)
     ImFontConfig* font_cfg = &Sources.back();
     if (font_cfg->DstFont == NULL)
         font_cfg->DstFont = font;
+    font_cfg->FontDataHash = 0;
     font->Sources.push_back(font_cfg);
     ImFontAtlasBuildUpdatePointers(this); // Pointers to Sources are otherwise dangling after we called Sources.push_back().
 
@@ -3333,8 +4688,9 @@ bool ImFontAtlas::GetCustomRect(ImFontAtlasRectId id, ImFontAtlasRect* out_r) co
     out_r->y = r->y;
     out_r->w = r->w;
     out_r->h = r->h;
-    out_r->uv0 = ImVec2((float)(r->x), (float)(r->y)) * TexUvScale;
-    out_r->uv1 = ImVec2((float)(r->x + r->w), (float)(r->y + r->h)) * TexUvScale;
+    const ImVec2 uv_scale = Builder->Pages[ImFontAtlasPackGetRectPage((ImFontAtlas*)this, id)]->TexUvScale;
+    out_r->uv0 = ImVec2((float)(r->x), (float)(r->y)) * uv_scale;
+    out_r->uv1 = ImVec2((float)(r->x + r->w), (float)(r->y + r->h)) * uv_scale;
     return true;
 }
 
@@ -3381,6 +4737,13 @@ void ImFontAtlasBuildMain(ImFontAtlas* atlas)
 
 void ImFontAtlasBuildGetOversampleFactors(ImFontConfig* src, ImFontBaked* baked, int* out_oversample_h, int* out_oversample_v)
 {
+    // Signed distance fields are resampled at any scale, oversampling would only waste texture space
+    if (src->DstFont->Flags & ImFontFlags_SDF)
+    {
+        *out_oversample_h = *out_oversample_v = 1;
+        return;
+    }
+
     // Automatically disable horizontal oversampling over size 36
     const float raster_size = baked->Size * baked->RasterizerDensity * src->RasterizerDensity;
     *out_oversample_h = (src->OversampleH != 0) ? src->OversampleH : (raster_size > 36.0f || src->PixelSnapH) ? 1 : 2;
@@ -3418,6 +4781,7 @@ void ImFontAtlasBuildSetupFontLoader(ImFontAtlas* atlas, const ImFontLoader* fon
 void ImFontAtlasBuildLegacyPreloadAllGlyphRanges(ImFontAtlas* atlas)
 {
     atlas->Builder->PreloadedAllGlyphsRanges = true;
+    ImFontAtlasBuildBeginGlyphJobs(atlas);
     for (ImFont* font : atlas->Fonts)
     {
         ImFontBaked* baked = font->GetFontBaked(font->LegacySize);
@@ -3433,6 +4797,7 @@ void ImFontAtlasBuildLegacyPreloadAllGlyphRanges(ImFontAtlas* atlas)
                     baked->FindGlyph((ImWchar)c);
         }
     }
+    ImFontAtlasBuildEndGlyphJobs(atlas);
 }
 
 // FIXME: May make ImFont::Sources a ImSpan<> and move ownership to ImFontAtlas
@@ -3642,12 +5007,13 @@ static ImFontGlyph* ImFontAtlasBuildSetupFontBakedEllipsis(ImFontAtlas* atlas, I
         dot_glyph = baked->FindGlyphNoFallback((ImWchar)0xFF0E);
     if (dot_glyph == NULL)
         return NULL;
+    ImFontAtlasBuildFlushGlyphJobs(atlas); // We copy pixels from the dot glyph
     ImFontAtlasRectId dot_r_id = dot_glyph->PackId; // Deep copy to avoid invalidation of glyphs and rect pointers
     ImTextureRect* dot_r = ImFontAtlasPackGetRect(atlas, dot_r_id);
     const int dot_spacing = 1;
     const float dot_step = (dot_glyph->X1 - dot_glyph->X0) + dot_spacing;
 
-    ImFontAtlasRectId pack_id = ImFontAtlasPackAddRect(atlas, (dot_r->w * 3 + dot_spacing * 2), dot_r->h);
+    ImFontAtlasRectId pack_id = ImFontAtlasPackAddGlyphRect(atlas, (dot_r->w * 3 + dot_spacing * 2), dot_r->h);
     ImTextureRect* r = ImFontAtlasPackGetRect(atlas, pack_id);
 
     ImFontGlyph glyph_in = {};
@@ -3666,9 +5032,10 @@ static ImFontGlyph* ImFontAtlasBuildSetupFontBakedEllipsis(ImFontAtlas* atlas, I
     // Copy to texture, post-process and queue update for backend
     // FIXME-NEWATLAS-V2: Dot glyph is already post-processed as this point, so this would damage it.
     dot_r = ImFontAtlasPackGetRect(atlas, dot_r_id);
-    ImTextureData* tex = atlas->TexData;
+    ImTextureData* dot_tex = atlas->Builder->Pages[ImFontAtlasPackGetRectPage(atlas, dot_r_id)]->Tex;
+    ImTextureData* tex = atlas->Builder->Pages[ImFontAtlasPackGetRectPage(atlas, pack_id)]->Tex;
     for (int n = 0; n < 3; n++)
-        ImFontAtlasTextureBlockCopy(tex, dot_r->x, dot_r->y, tex, r->x + (dot_r->w + dot_spacing) * n, r->y, dot_r->w, dot_r->h);
+        ImFontAtlasTextureBlockCopy(dot_tex, dot_r->x, dot_r->y, tex, r->x + (dot_r->w + dot_spacing) * n, r->y, dot_r->w, dot_r->h);
     ImFontAtlasTextureBlockQueueUpload(atlas, tex, r->x, r->y, r->w, r->h);
 
     return glyph;
@@ -3751,6 +5118,7 @@ void ImFontAtlasBuildSetupFontSpecialGlyphs(ImFontAtlas* atlas, ImFont* font, Im
 
 void ImFontAtlasBakedDiscardFontGlyph(ImFontAtlas* atlas, ImFont* font, ImFontBaked* baked, ImFontGlyph* glyph)
 {
+    ImFontAtlasBuildFlushGlyphJobs(atlas);
     if (glyph->PackId != ImFontAtlasRectId_Invalid)
     {
         ImFontAtlasPackDiscardRect(atlas, glyph->PackId);
@@ -3762,6 +5130,7 @@ void ImFontAtlasBakedDiscardFontGlyph(ImFontAtlas* atlas, ImFont* font, ImFontBa
     IM_UNUSED(font);
     baked->IndexLookup[c] = IM_FONTGLYPH_INDEX_UNUSED;
     baked->IndexAdvanceX[c] = baked->FallbackAdvanceX;
+    atlas->BakedGeneration++;
 }
 
 ImFontBaked* ImFontAtlasBakedAdd(ImFontAtlas* atlas, ImFont* font, float font_size, float font_rasterizer_density, ImGuiID baked_id)
@@ -3827,6 +5196,7 @@ ImFontBaked* ImFontAtlasBakedGetClosestMatch(ImFontAtlas* atlas, ImFont* font, f
 void ImFontAtlasBakedDiscard(ImFontAtlas* atlas, ImFont* font, ImFontBaked* baked)
 {
     ImFontAtlasBuilder* builder = atlas->Builder;
+    ImFontAtlasBuildFlushGlyphJobs(atlas);
     IMGUI_DEBUG_LOG_FONT("[font] Discard baked %.2f for \"%s\"\n", baked->Size, font->GetDebugName());
 
     for (ImFontGlyph& glyph : baked->Glyphs)
@@ -3848,6 +5218,7 @@ void ImFontAtlasBakedDiscard(ImFontAtlas* atlas, ImFont* font, ImFontBaked* bake
     }
     builder->BakedMap.SetVoidPtr(baked->BakedId, NULL);
     builder->BakedDiscardedCount++;
+    atlas->BakedGeneration++;
     baked->ClearOutputData();
     baked->WantDestroy = true;
     font->LastBaked = NULL;
@@ -3905,8 +5276,12 @@ void ImFontAtlasUpdateDrawListsTextures(ImFontAtlas* atlas, ImTextureRef old_tex
             // Replace in command-buffer
             // (there is not need to replace in ImDrawListSplitter: current channel is in ImDrawList's CmdBuffer[],
             //  other channels will be on SetCurrentChannel() which already needs to compare CmdHeader anyhow)
+            // (not using _SetTexture(): while ImFont::RenderText() temporarily binds a texture page, the stack holds the texture to restore)
             if (draw_list->CmdBuffer.Size > 0 && draw_list->_CmdHeader.TexRef == old_tex)
-                draw_list->_SetTexture(new_tex);
+            {
+                draw_list->_CmdHeader.TexRef = new_tex;
+                draw_list->_OnChangedTexture();
+            }
 
             // Replace in stack
             for (ImTextureRef& stacked_tex : draw_list->_TextureStack)
@@ -3935,13 +5310,32 @@ static void ImFontAtlasBuildSetTexture(ImFontAtlas* atlas, ImTextureData* tex)
     atlas->TexUvScale = ImVec2(1.0f / tex->Width, 1.0f / tex->Height);
     atlas->TexRef._TexData = tex;
     //atlas->TexRef._TexID = tex->TexID; // <-- We intentionally don't do that. It would be misleading and betray promise that both fields aren't set.
+    if (atlas->Builder != NULL && atlas->Builder->Pages.Size > 0)
+    {
+        atlas->Builder->Pages[0]->Tex = tex;
+        atlas->Builder->Pages[0]->TexUvScale = atlas->TexUvScale;
+    }
     ImFontAtlasUpdateDrawListsTextures(atlas, old_tex_ref, atlas->TexRef);
 }
 
-// Create a new texture, discard previous one
-ImTextureData* ImFontAtlasTextureAdd(ImFontAtlas* atlas, int w, int h)
+// Set texture of a page. Page 0 is atlas->TexData.
+static void ImFontAtlasBuildSetPageTexture(ImFontAtlas* atlas, int page_n, ImTextureData* tex)
+{
+    if (page_n == 0)
+    {
+        ImFontAtlasBuildSetTexture(atlas, tex);
+        return;
+    }
+    ImFontAtlasPage* page = atlas->Builder->Pages[page_n];
+    ImTextureRef old_tex_ref = page->Tex->GetTexRef();
+    page->Tex = tex;
+    page->TexUvScale = ImVec2(1.0f / tex->Width, 1.0f / tex->Height);
+    ImFontAtlasUpdateDrawListsTextures(atlas, old_tex_ref, tex->GetTexRef());
+}
+
+// Create a new texture and queue previous one (if any) to be destroyed next frame
+static ImTextureData* ImFontAtlasBuildCreateTexture(ImFontAtlas* atlas, ImTextureData* old_tex, int w, int h)
 {
-    ImTextureData* old_tex = atlas->TexData;
     ImTextureData* new_tex;
 
     // FIXME: Cannot reuse texture because old UV may have been used already (unless we remap UV).
@@ -3970,12 +5364,33 @@ ImTextureData* ImFontAtlasTextureAdd(ImFontAtlas* atlas, int w, int h)
 
     new_tex->Create(atlas->TexDesiredFormat, w, h);
     atlas->TexIsBuilt = false;
+    return new_tex;
+}
 
+// Create a new texture, discard previous one
+ImTextureData* ImFontAtlasTextureAdd(ImFontAtlas* atlas, int w, int h)
+{
+    ImTextureData* new_tex = ImFontAtlasBuildCreateTexture(atlas, atlas->TexData, w, h);
     ImFontAtlasBuildSetTexture(atlas, new_tex);
-
     return new_tex;
 }
 
+// Add a new page of TexMaxWidth x TexMaxHeight (ImFontAtlasFlags_MultiPage). Return NULL when reaching IM_FONTATLAS_MAX_PAGES.
+// New pages are never grown or copied: their initial size is final.
+ImFontAtlasPage* ImFontAtlasTextureAddPage(ImFontAtlas* atlas)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    if (builder->Pages.Size >= IM_FONTATLAS_MAX_PAGES)
+        return NULL;
+    ImFontAtlasPage* page = IM_NEW(ImFontAtlasPage)();
+    page->Tex = ImFontAtlasBuildCreateTexture(atlas, NULL, atlas->TexMaxWidth, atlas->TexMaxHeight);
+    page->TexUvScale = ImVec2(1.0f / page->Tex->Width, 1.0f / page->Tex->Height);
+    builder->Pages.push_back(page);
+    ImFontAtlasPackInit(atlas, builder->Pages.Size - 1);
+    IMGUI_DEBUG_LOG_FONT("[font] Texture #%03d: added as page %d (%dx%d)\n", page->Tex->UniqueID, builder->Pages.Size - 1, page->Tex->Width, page->Tex->Height);
+    return page;
+}
+
 #if 0
 #define STB_IMAGE_WRITE_IMPLEMENTATION
 #include "../stb/stb_image_write.h"
@@ -3989,14 +5404,26 @@ static void ImFontAtlasDebugWriteTexToDisk(ImTextureData* tex, const char* descr
 #endif
 
 void ImFontAtlasTextureRepack(ImFontAtlas* atlas, int w, int h)
+{
+    ImFontAtlasTextureRepackPage(atlas, 0, w, h);
+}
+
+static ImFontAtlasRectId ImFontAtlasPackAddRectInPage(ImFontAtlas* atlas, int page_n, int w, int h, ImFontAtlasRectEntry* overwrite_entry);
+static ImFontAtlasRectId ImFontAtlasPackReuseRectEntry(ImFontAtlas* atlas, ImFontAtlasRectEntry* index_entry);
+
+// Repack rectangles of a single page into a new texture, lose discarded rectangles, copy pixels.
+// Pixels of other pages are left untouched, so with ImFontAtlasFlags_MultiPage the copy cost is bounded by the size of a page.
+void ImFontAtlasTextureRepackPage(ImFontAtlas* atlas, int page_n, int w, int h)
 {
     ImFontAtlasBuilder* builder = atlas->Builder;
     builder->LockDisableResize = true;
 
-    ImTextureData* old_tex = atlas->TexData;
-    ImTextureData* new_tex = ImFontAtlasTextureAdd(atlas, w, h);
+    ImFontAtlasPage* page = builder->Pages[page_n];
+    ImTextureData* old_tex = page->Tex;
+    ImTextureData* new_tex = ImFontAtlasBuildCreateTexture(atlas, old_tex, w, h);
+    ImFontAtlasBuildSetPageTexture(atlas, page_n, new_tex);
     new_tex->UseColors = old_tex->UseColors;
-    IMGUI_DEBUG_LOG_FONT("[font] Texture #%03d: resize+repack %dx%d => Texture #%03d: %dx%d\n", old_tex->UniqueID, old_tex->Width, old_tex->Height, new_tex->UniqueID, new_tex->Width, new_tex->Height);
+    IMGUI_DEBUG_LOG_FONT("[font] Texture #%03d: resize+repack %dx%d => Texture #%03d: %dx%d (page %d)\n", old_tex->UniqueID, old_tex->Width, old_tex->Height, new_tex->UniqueID, new_tex->Width, new_tex->Height, page_n);
     //for (int baked_n = 0; baked_n < builder->BakedPool.Size; baked_n++)
     //    IMGUI_DEBUG_LOG_FONT("[font] - Baked %.2fpx, %d glyphs, want_destroy=%d\n", builder->BakedPool[baked_n].FontSize, builder->BakedPool[baked_n].Glyphs.Size, builder->BakedPool[baked_n].WantDestroy);
     //IMGUI_DEBUG_LOG_FONT("[font] - Old packed rects: %d, area %d px\n", builder->RectsPackedCount, builder->RectsPackedSurface);
@@ -4006,7 +5433,7 @@ void ImFontAtlasTextureRepack(ImFontAtlas* atlas, int w, int h)
     // FIXME-NEWATLAS: This is unstable because packing order is based on RectsIndex
     // FIXME-NEWATLAS-V2: Repacking in batch would be beneficial to packing heuristic, and fix stability.
     // FIXME-NEWATLAS-TESTS: Test calling RepackTexture with size too small to fits existing rects.
-    ImFontAtlasPackInit(atlas);
+    ImFontAtlasPackInit(atlas, page_n);
     ImVector<ImTextureRect> old_rects;
     ImVector<ImFontAtlasRectEntry> old_index = builder->RectsIndex;
     old_rects.swap(builder->Rects);
@@ -4018,7 +5445,24 @@ void ImFontAtlasTextureRepack(ImFontAtlas* atlas, int w, int h)
         ImTextureRect& old_r = old_rects[index_entry.TargetIndex];
         if (old_r.w == 0 && old_r.h == 0)
             continue;
-        ImFontAtlasRectId new_r_id = ImFontAtlasPackAddRect(atlas, old_r.w, old_r.h, &index_entry);
+        if (index_entry.Page != (unsigned int)page_n)
+        {
+            // Rectangle from another page: keep as is
+            builder->Rects.push_back(old_r);
+            ImFontAtlasPackReuseRectEntry(atlas, &index_entry);
+            continue;
+        }
+        ImFontAtlasRectId new_r_id = ImFontAtlasPackAddRectInPage(atlas, page_n, old_r.w, old_r.h, &index_entry);
+        if (new_r_id == ImFontAtlasRectId_Invalid && page_n > 0)
+        {
+            // Pages other than 0 only hold glyphs and can't grow: move rectangle to another page.
+            for (int other_page_n = builder->Pages.Size - 1; other_page_n > 0 && new_r_id == ImFontAtlasRectId_Invalid; other_page_n--)
+                if (other_page_n != page_n)
+                    new_r_id = ImFontAtlasPackAddRectInPage(atlas, other_page_n, old_r.w, old_r.h, &index_entry);
+            if (new_r_id == ImFontAtlasRectId_Invalid && ImFontAtlasTextureAddPage(atlas) != NULL)
+                new_r_id = ImFontAtlasPackAddRectInPage(atlas, builder->Pages.Size - 1, old_r.w, old_r.h, &index_entry);
+            IM_ASSERT(new_r_id != ImFontAtlasRectId_Invalid && "Out of texture pages.");
+        }
         if (new_r_id == ImFontAtlasRectId_Invalid)
         {
             // Undo, grow texture and try repacking again.
@@ -4027,39 +5471,48 @@ void ImFontAtlasTextureRepack(ImFontAtlas* atlas, int w, int h)
             new_tex->WantDestroyNextFrame = true;
             builder->Rects.swap(old_rects);
             builder->RectsIndex = old_index;
-            ImFontAtlasBuildSetTexture(atlas, old_tex);
+            ImFontAtlasBuildSetPageTexture(atlas, page_n, old_tex);
             ImFontAtlasTextureGrow(atlas, w, h); // Recurse
             return;
         }
         IM_ASSERT(ImFontAtlasRectId_GetIndex(new_r_id) == builder->RectsIndex.index_from_ptr(&index_entry));
         ImTextureRect* new_r = ImFontAtlasPackGetRect(atlas, new_r_id);
-        ImFontAtlasTextureBlockCopy(old_tex, old_r.x, old_r.y, new_tex, new_r->x, new_r->y, new_r->w, new_r->h);
+        ImFontAtlasTextureBlockCopy(old_tex, old_r.x, old_r.y, builder->Pages[index_entry.Page]->Tex, new_r->x, new_r->y, new_r->w, new_r->h);
     }
     IM_ASSERT(old_rects.Size == builder->Rects.Size + builder->RectsDiscardedCount);
     builder->RectsDiscardedCount = 0;
-    builder->RectsDiscardedSurface = 0;
+    builder->RectsDiscardedSurface -= page->RectsDiscardedSurface;
+    page->RectsDiscardedSurface = 0;
 
     // Patch glyphs UV
     for (int baked_n = 0; baked_n < builder->BakedPool.Size; baked_n++)
         for (ImFontGlyph& glyph : builder->BakedPool[baked_n].Glyphs)
             if (glyph.PackId != ImFontAtlasRectId_Invalid)
             {
+                const int glyph_page_n = ImFontAtlasPackGetRectPage(atlas, glyph.PackId);
+                ImVec2 uv_scale = builder->Pages[glyph_page_n]->TexUvScale;
                 ImTextureRect* r = ImFontAtlasPackGetRect(atlas, glyph.PackId);
-                glyph.U0 = (r->x) * atlas->TexUvScale.x;
-                glyph.V0 = (r->y) * atlas->TexUvScale.y;
-                glyph.U1 = (r->x + r->w) * atlas->TexUvScale.x;
-                glyph.V1 = (r->y + r->h) * atlas->TexUvScale.y;
+                glyph.TexPage = glyph_page_n;
+                glyph.U0 = (r->x) * uv_scale.x;
+                glyph.V0 = (r->y) * uv_scale.y;
+                glyph.U1 = (r->x + r->w) * uv_scale.x;
+                glyph.V1 = (r->y + r->h) * uv_scale.y;
             }
 
     // Update other cached UV
-    ImFontAtlasBuildUpdateLinesTexData(atlas);
-    ImFontAtlasBuildUpdateBasicTexData(atlas);
+    if (page_n == 0)
+    {
+        ImFontAtlasBuildUpdateLinesTexData(atlas);
+        ImFontAtlasBuildUpdateBasicTexData(atlas);
+    }
 
     builder->LockDisableResize = false;
-    ImFontAtlasUpdateDrawListsSharedData(atlas);
+    if (page_n == 0)
+        ImFontAtlasUpdateDrawListsSharedData(atlas);
     //ImFontAtlasDebugWriteTexToDisk(new_tex, "After Pack");
 }
 
+// Grow page 0 (atlas->TexData). Additional pages of a ImFontAtlasFlags_MultiPage atlas never grow.
 void ImFontAtlasTextureGrow(ImFontAtlas* atlas, int old_tex_w, int old_tex_h)
 {
     //ImFontAtlasDebugWriteTexToDisk(atlas->TexData, "Before Grow");
@@ -4097,10 +5550,12 @@ void ImFontAtlasTextureMakeSpace(ImFontAtlas* atlas)
     // Can some baked contents be ditched?
     //IMGUI_DEBUG_LOG_FONT("[font] ImFontAtlasBuildMakeSpace()\n");
     ImFontAtlasBuilder* builder = atlas->Builder;
+    ImFontAtlasBuildFlushGlyphJobs(atlas); // Pending glyphs need to be in texture before it gets repacked
     ImFontAtlasBuildDiscardBakes(atlas, 2);
 
     // Currently using a heuristic for repack without growing.
-    if (builder->RectsDiscardedSurface < builder->RectsPackedSurface * 0.20f)
+    ImFontAtlasPage* page = builder->Pages[0];
+    if (page->RectsDiscardedSurface < page->RectsPackedSurface * 0.20f)
         ImFontAtlasTextureGrow(atlas);
     else
         ImFontAtlasTextureRepack(atlas, atlas->TexData->Width, atlas->TexData->Height);
@@ -4116,7 +5571,7 @@ ImVec2i ImFontAtlasTextureGetSizeEstimate(ImFontAtlas* atlas)
     ImFontAtlasBuilder* builder = atlas->Builder;
     min_w = ImMax(ImUpperPowerOfTwo(builder->MaxRectSize.x), min_w);
     min_h = ImMax(ImUpperPowerOfTwo(builder->MaxRectSize.y), min_h);
-    const int surface_approx = builder->RectsPackedSurface - builder->RectsDiscardedSurface; // Expected surface after repack
+    const int surface_approx = builder->Pages[0]->RectsPackedSurface - builder->Pages[0]->RectsDiscardedSurface; // Expected surface after repack
     const int surface_sqrt = (int)sqrtf((float)surface_approx);
 
     int new_tex_w;
@@ -4161,10 +5616,26 @@ void ImFontAtlasTextureCompact(ImFontAtlas* atlas)
     ImFontAtlasBuilder* builder = atlas->Builder;
     ImFontAtlasBuildDiscardBakes(atlas, 1);
 
+    // Additional pages (ImFontAtlasFlags_MultiPage) keep their size: repack those with discarded rectangles, release trailing empty ones.
+    for (int page_n = builder->Pages.Size - 1; page_n > 0; page_n--)
+    {
+        ImFontAtlasPage* page = builder->Pages[page_n];
+        if (page->RectsDiscardedSurface > 0)
+            ImFontAtlasTextureRepackPage(atlas, page_n, page->Tex->Width, page->Tex->Height);
+        if (page->RectsPackedCount == 0 && page_n == builder->Pages.Size - 1)
+        {
+            IMGUI_DEBUG_LOG_FONT("[font] Texture #%03d: released empty page %d\n", page->Tex->UniqueID, page_n);
+            page->Tex->WantDestroyNextFrame = true;
+            IM_DELETE(page);
+            builder->Pages.pop_back();
+        }
+    }
+    builder->PagesCurrent = ImMin(builder->PagesCurrent, builder->Pages.Size - 1);
+
     ImTextureData* old_tex = atlas->TexData;
     ImVec2i old_tex_size = ImVec2i(old_tex->Width, old_tex->Height);
     ImVec2i new_tex_size = ImFontAtlasTextureGetSizeEstimate(atlas);
-    if (builder->RectsDiscardedCount == 0 && new_tex_size.x == old_tex_size.x && new_tex_size.y == old_tex_size.y)
+    if (builder->Pages[0]->RectsDiscardedSurface == 0 && new_tex_size.x == old_tex_size.x && new_tex_size.y == old_tex_size.y)
         return;
 
     ImFontAtlasTextureRepack(atlas, new_tex_size.x, new_tex_size.y);
@@ -4224,23 +5695,45 @@ void ImFontAtlasBuildDestroy(ImFontAtlas* atlas)
         atlas->FontLoader->LoaderShutdown(atlas);
         IM_ASSERT(atlas->FontLoaderData == NULL);
     }
+    if (atlas->Builder)
+        for (int page_n = 0; page_n < atlas->Builder->Pages.Size; page_n++)
+        {
+            if (page_n > 0)
+                atlas->Builder->Pages[page_n]->Tex->WantDestroyNextFrame = true; // Page 0 is atlas->TexData, which is kept or replaced by the next build.
+            IM_DELETE(atlas->Builder->Pages[page_n]);
+        }
     IM_DELETE(atlas->Builder);
     atlas->Builder = NULL;
 }
 
-void ImFontAtlasPackInit(ImFontAtlas * atlas)
+// Start packing over a page, generally following the creation of its texture.
+void ImFontAtlasPackInit(ImFontAtlas* atlas, int page_n)
 {
-    ImTextureData* tex = atlas->TexData;
     ImFontAtlasBuilder* builder = atlas->Builder;
+    if (builder->Pages.Size == 0)
+    {
+        IM_ASSERT(page_n == 0);
+        ImFontAtlasPage* page = IM_NEW(ImFontAtlasPage)();
+        page->Tex = atlas->TexData;
+        page->TexUvScale = atlas->TexUvScale;
+        builder->Pages.push_back(page);
+    }
+    ImFontAtlasPage* page = builder->Pages[page_n];
+    ImTextureData* tex = page->Tex;
 
     // In theory we could decide to reduce the number of nodes, e.g. halve them, and waste a little texture space, but it doesn't seem worth it.
     const int pack_node_count = tex->Width / 2;
-    builder->PackNodes.resize(pack_node_count);
+    page->PackNodes.resize(pack_node_count);
     IM_STATIC_ASSERT(sizeof(stbrp_context) <= sizeof(stbrp_context_opaque));
-    stbrp_init_target((stbrp_context*)(void*)&builder->PackContext, tex->Width, tex->Height, builder->PackNodes.Data, builder->PackNodes.Size);
-    builder->RectsPackedSurface = builder->RectsPackedCount = 0;
-    builder->MaxRectSize = ImVec2i(0, 0);
-    builder->MaxRectBounds = ImVec2i(0, 0);
+    stbrp_init_target((stbrp_context*)(void*)&page->PackContext, tex->Width, tex->Height, page->PackNodes.Data, page->PackNodes.Size);
+    builder->RectsPackedCount -= page->RectsPackedCount;
+    builder->RectsPackedSurface -= page->RectsPackedSurface;
+    page->RectsPackedSurface = page->RectsPackedCount = 0;
+    if (builder->Pages.Size == 1)
+    {
+        builder->MaxRectSize = ImVec2i(0, 0);
+        builder->MaxRectBounds = ImVec2i(0, 0);
+    }
 }
 
 // This is essentially a free-list pattern, it may be nice to wrap it into a dedicated type.
@@ -4295,37 +5788,62 @@ void ImFontAtlasPackDiscardRect(ImFontAtlas* atlas, ImFontAtlasRectId id)
     index_entry->Generation++;
 
     const int pack_padding = atlas->TexGlyphPadding;
+    const int surface = (rect->w + pack_padding) * (rect->h + pack_padding);
     builder->RectsIndexFreeListStart = index_idx;
     builder->RectsDiscardedCount++;
-    builder->RectsDiscardedSurface += (rect->w + pack_padding) * (rect->h + pack_padding);
+    builder->RectsDiscardedSurface += surface;
+    builder->Pages[index_entry->Page]->RectsDiscardedSurface += surface;
     rect->w = rect->h = 0; // Clear rectangle so it won't be packed again
 }
 
-// Important: Calling this may recreate a new texture and therefore change atlas->TexData
-// FIXME-NEWFONTS: Expose other glyph padding settings for custom alteration (e.g. drop shadows). See #7962
-ImFontAtlasRectId ImFontAtlasPackAddRect(ImFontAtlas* atlas, int w, int h, ImFontAtlasRectEntry* overwrite_entry)
+// Pack into a given page. Does not try to make space on failure.
+static ImFontAtlasRectId ImFontAtlasPackAddRectInPage(ImFontAtlas* atlas, int page_n, int w, int h, ImFontAtlasRectEntry* overwrite_entry)
 {
     IM_ASSERT(w > 0 && w <= 0xFFFF);
     IM_ASSERT(h > 0 && h <= 0xFFFF);
 
     ImFontAtlasBuilder* builder = (ImFontAtlasBuilder*)atlas->Builder;
+    ImFontAtlasPage* page = builder->Pages[page_n];
     const int pack_padding = atlas->TexGlyphPadding;
     builder->MaxRectSize.x = ImMax(builder->MaxRectSize.x, w);
     builder->MaxRectSize.y = ImMax(builder->MaxRectSize.y, h);
 
-    // Pack
-    ImTextureRect r = { 0, 0, (unsigned short)w, (unsigned short)h };
+    stbrp_rect pack_r = {};
+    pack_r.w = w + pack_padding;
+    pack_r.h = h + pack_padding;
+    stbrp_pack_rects((stbrp_context*)(void*)&page->PackContext, &pack_r, 1);
+    if (!pack_r.was_packed)
+        return ImFontAtlasRectId_Invalid;
+    ImTextureRect r = { (unsigned short)pack_r.x, (unsigned short)pack_r.y, (unsigned short)w, (unsigned short)h };
+
+    builder->MaxRectBounds.x = ImMax(builder->MaxRectBounds.x, r.x + r.w + pack_padding);
+    builder->MaxRectBounds.y = ImMax(builder->MaxRectBounds.y, r.y + r.h + pack_padding);
+    builder->RectsPackedCount++;
+    builder->RectsPackedSurface += (w + pack_padding) * (h + pack_padding);
+    page->RectsPackedCount++;
+    page->RectsPackedSurface += (w + pack_padding) * (h + pack_padding);
+
+    builder->Rects.push_back(r);
+    ImFontAtlasRectId r_id;
+    if (overwrite_entry != NULL)
+        r_id = ImFontAtlasPackReuseRectEntry(atlas, overwrite_entry); // Write into an existing entry instead of adding one (used during repack)
+    else
+        r_id = ImFontAtlasPackAllocRectEntry(atlas, builder->Rects.Size - 1);
+    builder->RectsIndex[ImFontAtlasRectId_GetIndex(r_id)].Page = page_n;
+    return r_id;
+}
+
+// Important: Calling this may recreate a new texture and therefore change atlas->TexData
+// FIXME-NEWFONTS: Expose other glyph padding settings for custom alteration (e.g. drop shadows). See #7962
+ImFontAtlasRectId ImFontAtlasPackAddRect(ImFontAtlas* atlas, int w, int h, ImFontAtlasRectEntry* overwrite_entry)
+{
+    ImFontAtlasBuilder* builder = (ImFontAtlasBuilder*)atlas->Builder;
     for (int attempts_remaining = 3; attempts_remaining >= 0; attempts_remaining--)
     {
         // Try packing
-        stbrp_rect pack_r = {};
-        pack_r.w = w + pack_padding;
-        pack_r.h = h + pack_padding;
-        stbrp_pack_rects((stbrp_context*)(void*)&builder->PackContext, &pack_r, 1);
-        r.x = (unsigned short)pack_r.x;
-        r.y = (unsigned short)pack_r.y;
-        if (pack_r.was_packed)
-            break;
+        ImFontAtlasRectId r_id = ImFontAtlasPackAddRectInPage(atlas, 0, w, h, overwrite_entry);
+        if (r_id != ImFontAtlasRectId_Invalid)
+            return r_id;
 
         // If we ran out of attempts, return fallback
         if (attempts_remaining == 0 || builder->LockDisableResize)
@@ -4337,17 +5855,56 @@ ImFontAtlasRectId ImFontAtlasPackAddRect(ImFontAtlas* atlas, int w, int h, ImFon
         // Resize or repack atlas! (this should be a rare event)
         ImFontAtlasTextureMakeSpace(atlas);
     }
+    return ImFontAtlasRectId_Invalid;
+}
 
-    builder->MaxRectBounds.x = ImMax(builder->MaxRectBounds.x, r.x + r.w + pack_padding);
-    builder->MaxRectBounds.y = ImMax(builder->MaxRectBounds.y, r.y + r.h + pack_padding);
-    builder->RectsPackedCount++;
-    builder->RectsPackedSurface += (w + pack_padding) * (h + pack_padding);
+// Pack a glyph. With ImFontAtlasFlags_MultiPage, page 0 grows as usual until reaching TexMaxWidth x TexMaxHeight. After that,
+// when the current page is full we repack the single page with the most discarded pixels, or add a new page, instead of
+// repacking and copying everything. Either way the cost of making space is bounded by the size of a page.
+ImFontAtlasRectId ImFontAtlasPackAddGlyphRect(ImFontAtlas* atlas, int w, int h)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    if ((atlas->Flags & ImFontAtlasFlags_MultiPage) == 0 || !atlas->RendererHasTextures || builder->LockDisableResize)
+        return ImFontAtlasPackAddRect(atlas, w, h);
 
-    builder->Rects.push_back(r);
-    if (overwrite_entry != NULL)
-        return ImFontAtlasPackReuseRectEntry(atlas, overwrite_entry); // Write into an existing entry instead of adding one (used during repack)
-    else
-        return ImFontAtlasPackAllocRectEntry(atlas, builder->Rects.Size - 1);
+    ImFontAtlasRectId r_id = ImFontAtlasPackAddRectInPage(atlas, builder->PagesCurrent, w, h, NULL);
+    if (r_id != ImFontAtlasRectId_Invalid)
+        return r_id;
+    if (builder->PagesCurrent == 0 && (atlas->TexData->Width < atlas->TexMaxWidth || atlas->TexData->Height < atlas->TexMaxHeight))
+        if ((r_id = ImFontAtlasPackAddRect(atlas, w, h)) != ImFontAtlasRectId_Invalid)
+            return r_id;
+
+    // Reclaim discarded space from one page
+    ImFontAtlasBuildDiscardBakes(atlas, 2);
+    int compact_page_n = -1;
+    for (int page_n = 0; page_n < builder->Pages.Size; page_n++)
+    {
+        ImFontAtlasPage* page = builder->Pages[page_n];
+        if (page->RectsDiscardedSurface >= page->RectsPackedSurface * 0.20f && page->RectsDiscardedSurface > 0)
+            if (compact_page_n == -1 || page->RectsDiscardedSurface > builder->Pages[compact_page_n]->RectsDiscardedSurface)
+                compact_page_n = page_n;
+    }
+    if (compact_page_n != -1)
+    {
+        ImFontAtlasBuildFlushGlyphJobs(atlas); // Pending glyphs need to be in texture before it gets repacked
+        ImFontAtlasPage* page = builder->Pages[compact_page_n];
+        ImFontAtlasTextureRepackPage(atlas, compact_page_n, page->Tex->Width, page->Tex->Height);
+        if ((r_id = ImFontAtlasPackAddRectInPage(atlas, compact_page_n, w, h, NULL)) != ImFontAtlasRectId_Invalid)
+        {
+            builder->PagesCurrent = compact_page_n;
+            return r_id;
+        }
+    }
+
+    // Add a new page
+    const int pack_padding = atlas->TexGlyphPadding;
+    if (w + pack_padding <= atlas->TexMaxWidth && h + pack_padding <= atlas->TexMaxHeight && ImFontAtlasTextureAddPage(atlas) != NULL)
+    {
+        builder->PagesCurrent = builder->Pages.Size - 1;
+        return ImFontAtlasPackAddRectInPage(atlas, builder->PagesCurrent, w, h, NULL);
+    }
+    IMGUI_DEBUG_LOG_FONT("[font] Failed packing %dx%d rectangle. Returning fallback.\n", w, h);
+    return ImFontAtlasRectId_Invalid;
 }
 
 // Generally for non-user facing functions: assert on invalid ID.
@@ -4362,6 +5919,15 @@ ImTextureRect* ImFontAtlasPackGetRect(ImFontAtlas* atlas, ImFontAtlasRectId id)
     return &builder->Rects[index_entry->TargetIndex];
 }
 
+int ImFontAtlasPackGetRectPage(ImFontAtlas* atlas, ImFontAtlasRectId id)
+{
+    IM_ASSERT(id != ImFontAtlasRectId_Invalid);
+    ImFontAtlasRectEntry* index_entry = &atlas->Builder->RectsIndex[ImFontAtlasRectId_GetIndex(id)];
+    IM_ASSERT(index_entry->Generation == ImFontAtlasRectId_GetGeneration(id));
+    IM_ASSERT(index_entry->IsUsed);
+    return index_entry->Page;
+}
+
 // For user-facing functions: return NULL on invalid ID.
 // Important: return pointer is valid until next call to AddRect(), e.g. FindGlyph(), CalcTextSize() can all potentially invalidate previous pointers.
 ImTextureRect* ImFontAtlasPackGetRectSafe(ImFontAtlas* atlas, ImFontAtlasRectId id)
@@ -4407,6 +5973,8 @@ static void ImFontAtlas_FontHookRemapCodepoint(ImFontAtlas* atlas, ImFont* font,
         *c = (ImWchar)font->RemapPairs.GetInt((ImGuiID)*c, (int)*c);
 }
 
+static bool ImFontAtlasGlyphCacheLoadGlyph(ImFontAtlas* atlas, ImFontConfig* src, int src_n, ImFontBaked* baked, ImWchar codepoint, float* only_load_advance_x, ImFontGlyph** out_glyph);
+
 static ImFontGlyph* ImFontBaked_BuildLoadGlyph(ImFontBaked* baked, ImWchar codepoint, float* only_load_advance_x)
 {
     ImFont* font = baked->ContainerFont;
@@ -4440,6 +6008,12 @@ static ImFontGlyph* ImFontBaked_BuildLoadGlyph(ImFontBaked* baked, ImWchar codep
         const ImFontLoader* loader = src->FontLoader ? src->FontLoader : atlas->FontLoader;
         if (!src->GlyphExcludeRanges || ImFontAtlasBuildAcceptCodepointForSource(src, codepoint))
         {
+            // Persistent cache (ignored for remapped codepoints as pairs are not part of cache key)
+            ImFontGlyph* cached_glyph;
+            if (atlas->GlyphCache != NULL && codepoint == src_codepoint)
+                if (ImFontAtlasGlyphCacheLoadGlyph(atlas, src, src_n, baked, codepoint, only_load_advance_x, &cached_glyph))
+                    return cached_glyph;
+
             if (only_load_advance_x == NULL)
             {
                 ImFontGlyph glyph_buf;
@@ -4487,20 +6061,169 @@ static float ImFontBaked_BuildLoadGlyphAdvanceX(ImFontBaked* baked, ImWchar code
         ImFontGlyph* glyph = ImFontBaked_BuildLoadGlyph(baked, (ImWchar)codepoint, &only_advance_x);
         return glyph ? glyph->AdvanceX : only_advance_x;
     }
-    else
+    else
+    {
+        ImFontGlyph* glyph = ImFontBaked_BuildLoadGlyph(baked, (ImWchar)codepoint, NULL);
+        return glyph ? glyph->AdvanceX : baked->FallbackAdvanceX;
+    }
+}
+
+// The point of this indirection is to not be inlined in debug mode in order to not bloat inner loop.b
+// When a glyph is missing, we also load missing glyphs from the next IM_FONTBAKED_PRELOAD_TEXT_MAX_BYTES bytes of text: they are likely
+// to be needed soon and can be rendered in a batch. The window is capped so each miss in a very large text stays cheap.
+// 'text_end' may be NULL for zero-terminated text.
+#define IM_FONTBAKED_PRELOAD_TEXT_MAX_BYTES     4096
+IM_MSVC_RUNTIME_CHECKS_OFF
+static float BuildLoadGlyphGetAdvanceOrFallback(ImFontBaked* baked, unsigned int codepoint, const char* text_remaining, const char* text_end)
+{
+    ImFontAtlas* atlas = baked->ContainerFont->ContainerAtlas;
+    if (baked->Size >= IMGUI_FONT_SIZE_THRESHOLD_FOR_LOADADVANCEXONLYMODE || baked->LoadNoRenderOnLayout)
+        return ImFontBaked_BuildLoadGlyphAdvanceX(baked, (ImWchar)codepoint);
+
+    // Find end of preload window, without reading past a zero-terminator nor cutting an UTF-8 sequence
+    const char* preload_end = text_remaining;
+    if (text_end != NULL)
+        preload_end = (text_end - text_remaining > IM_FONTBAKED_PRELOAD_TEXT_MAX_BYTES) ? text_remaining + IM_FONTBAKED_PRELOAD_TEXT_MAX_BYTES : text_end;
+    else
+        while (preload_end - text_remaining < IM_FONTBAKED_PRELOAD_TEXT_MAX_BYTES && *preload_end != 0)
+            preload_end++;
+    if (preload_end != text_end && *preload_end != 0)
+        while (preload_end > text_remaining && (*preload_end & 0xC0) == 0x80)
+            preload_end--;
+    if (preload_end <= text_remaining)
+        return ImFontBaked_BuildLoadGlyphAdvanceX(baked, (ImWchar)codepoint);
+
+    ImFontAtlasBuildBeginGlyphJobs(atlas);
+    float advance_x = ImFontBaked_BuildLoadGlyphAdvanceX(baked, (ImWchar)codepoint);
+    ImFontAtlasBakedLoadGlyphsForText(atlas, baked, text_remaining, preload_end);
+    ImFontAtlasBuildEndGlyphJobs(atlas);
+    return advance_x;
+}
+IM_MSVC_RUNTIME_CHECKS_RESTORE
+
+//-----------------------------------------------------------------------------
+// Deferred glyph rasterization
+// - Loading a glyph's metrics and packing its rectangle is cheap, rendering its pixels is not. When many glyphs are loaded at
+//   once (new font size, text using many new characters, legacy preloading) we queue rendering and run it in a batch,
+//   possibly in parallel with ImFontAtlas::ParallelFor. Packing, texture writes and upload requests stay on calling thread.
+//-----------------------------------------------------------------------------
+
+#define IM_FONTATLAS_GLYPH_JOBS_MAX_WORKERS     16
+#define IM_FONTATLAS_GLYPH_JOBS_SCRATCH_SIZE    (256 * 1024)    // Per worker. Jobs needing more are rendered again from calling thread.
+
+void ImFontAtlasBuildBeginGlyphJobs(ImFontAtlas* atlas)
+{
+    atlas->Builder->GlyphJobsDeferDepth++;
+}
+
+void ImFontAtlasBuildEndGlyphJobs(ImFontAtlas* atlas)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    IM_ASSERT(builder->GlyphJobsDeferDepth > 0);
+    if (--builder->GlyphJobsDeferDepth == 0)
+        ImFontAtlasBuildFlushGlyphJobs(atlas);
+}
+
+ImFontAtlasGlyphJob* ImFontAtlasBuildAddGlyphJob(ImFontAtlas* atlas, ImFontBaked* baked, ImFontConfig* src, ImFontAtlasRectId pack_id, int w, int h)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    if (builder->GlyphJobsDeferDepth == 0)
+        return NULL;
+    ImFontAtlasGlyphJob job = {};
+    job.Baked = baked;
+    job.Src = src;
+    job.GlyphIdx = baked->Glyphs.Size;
+    job.PackId = pack_id;
+    job.Width = w;
+    job.Height = h;
+    job.PixelsOffset = builder->GlyphJobsPixels.Size;
+    builder->GlyphJobsPixels.resize(builder->GlyphJobsPixels.Size + w * h);
+    builder->GlyphJobs.push_back(job);
+    return &builder->GlyphJobs.back();
+}
+
+static bool ImFontAtlasBuildRunGlyphJob(ImFontAtlas* atlas, ImFontAtlasGlyphJob* job, ImFontAtlasGlyphJobScratch* scratch)
+{
+    const ImFontLoader* loader = job->Src->FontLoader ? job->Src->FontLoader : atlas->FontLoader;
+    unsigned char* pixels = atlas->Builder->GlyphJobsPixels.Data + job->PixelsOffset;
+    memset(pixels, 0, (size_t)job->Width * job->Height);
+    if (scratch != NULL)
+    {
+        scratch->Used = 0;
+        scratch->Overflow = false;
+    }
+    bool ret = loader->FontBakedRasterizeGlyph(atlas, job->Src, job, pixels, scratch);
+    return ret && (scratch == NULL || !scratch->Overflow);
+}
+
+struct ImFontAtlasGlyphJobsWorkData
+{
+    ImFontAtlas*        Atlas;
+    int                 WorkersCount;
+    unsigned char*      ScratchData;
+};
+
+// Interleave glyphs across workers, as consecutive glyphs tend to have similar costs.
+static void ImFontAtlasBuildGlyphJobsWorker(int worker_index, void* job_data)
+{
+    ImFontAtlasGlyphJobsWorkData* data = (ImFontAtlasGlyphJobsWorkData*)job_data;
+    ImFontAtlasBuilder* builder = data->Atlas->Builder;
+    ImFontAtlasGlyphJobScratch scratch = { data->ScratchData + worker_index * IM_FONTATLAS_GLYPH_JOBS_SCRATCH_SIZE, IM_FONTATLAS_GLYPH_JOBS_SCRATCH_SIZE, 0, false };
+    for (int job_n = worker_index; job_n < builder->GlyphJobs.Size; job_n += data->WorkersCount)
+    {
+        ImFontAtlasGlyphJob* job = &builder->GlyphJobs.Data[job_n];
+        job->Done = ImFontAtlasBuildRunGlyphJob(data->Atlas, job, &scratch);
+    }
+}
+
+void ImFontAtlasBuildFlushGlyphJobs(ImFontAtlas* atlas)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    if (builder == NULL || builder->GlyphJobs.Size == 0)
+        return;
+
+    // Render pixels
+    // (running in parallel requires our stb_truetype implementation, as its allocations are redirected to scratch memory)
+    int workers_count = 1;
+#ifndef IMGUI_DISABLE_STB_TRUETYPE_IMPLEMENTATION
+    if (atlas->ParallelFor != NULL)
+        workers_count = ImMin(builder->GlyphJobs.Size, IM_FONTATLAS_GLYPH_JOBS_MAX_WORKERS);
+#endif
+    if (workers_count > 1)
+    {
+        ImVector<unsigned char> scratch_buffer;
+        scratch_buffer.resize(workers_count * IM_FONTATLAS_GLYPH_JOBS_SCRATCH_SIZE);
+        ImFontAtlasGlyphJobsWorkData data = { atlas, workers_count, scratch_buffer.Data };
+        atlas->ParallelFor(workers_count, ImFontAtlasBuildGlyphJobsWorker, &data, atlas->ParallelForUserData);
+    }
+
+    // Copy to texture in submission order
+    for (ImFontAtlasGlyphJob& job : builder->GlyphJobs)
     {
-        ImFontGlyph* glyph = ImFontBaked_BuildLoadGlyph(baked, (ImWchar)codepoint, NULL);
-        return glyph ? glyph->AdvanceX : baked->FallbackAdvanceX;
+        if (!job.Done)
+            ImFontAtlasBuildRunGlyphJob(atlas, &job, NULL);
+        ImFontGlyph* glyph = &job.Baked->Glyphs[job.GlyphIdx];
+        IM_ASSERT(glyph->PackId == job.PackId);
+        ImTextureRect* r = ImFontAtlasPackGetRect(atlas, job.PackId);
+        ImFontAtlasBakedSetFontGlyphBitmap(atlas, job.Baked, job.Src, glyph, r, builder->GlyphJobsPixels.Data + job.PixelsOffset, ImTextureFormat_Alpha8, job.Width);
     }
+    builder->GlyphJobs.resize(0);
+    builder->GlyphJobsPixels.resize(0);
 }
 
-// The point of this indirection is to not be inlined in debug mode in order to not bloat inner loop.b
-IM_MSVC_RUNTIME_CHECKS_OFF
-static float BuildLoadGlyphGetAdvanceOrFallback(ImFontBaked* baked, unsigned int codepoint)
+// Load all missing glyphs used by a text in one batch.
+void ImFontAtlasBakedLoadGlyphsForText(ImFontAtlas* atlas, ImFontBaked* baked, const char* text, const char* text_end)
 {
-    return ImFontBaked_BuildLoadGlyphAdvanceX(baked, (ImWchar)codepoint);
+    ImFontAtlasBuildBeginGlyphJobs(atlas);
+    for (const char* s = text; s < text_end; )
+    {
+        unsigned int c = (unsigned int)*s;
+        s += (c < 0x80) ? 1 : ImTextCharFromUtf8(&c, s, text_end);
+        if (c >= 32 && (c >= (unsigned int)baked->IndexLookup.Size || baked->IndexLookup.Data[c] == IM_FONTGLYPH_INDEX_UNUSED))
+            ImFontBaked_BuildLoadGlyph(baked, (ImWchar)c, NULL);
+    }
+    ImFontAtlasBuildEndGlyphJobs(atlas);
 }
-IM_MSVC_RUNTIME_CHECKS_RESTORE
 
 #ifndef IMGUI_DISABLE_DEBUG_TOOLS
 void ImFontAtlasDebugLogTextureRequests(ImFontAtlas* atlas)
@@ -4531,6 +6254,333 @@ void ImFontAtlasDebugLogTextureRequests(ImFontAtlas* atlas)
 }
 #endif
 
+//-------------------------------------------------------------------------
+// [SECTION] ImFontAtlas: glyph cache
+//-------------------------------------------------------------------------
+
+bool ImFontAtlas::LoadGlyphCacheFromFile(const char* filename)
+{
+    size_t data_size = 0;
+    void* data = ImFileLoadToMemory(filename, "rb", &data_size, 0);
+    if (!data)
+        return false;
+    if (!LoadGlyphCacheFromMemory(data, data_size))
+    {
+        IM_FREE(data);
+        return false;
+    }
+    GlyphCache->DataOwned = true;
+    return true;
+}
+
+// Data is used in place and needs to stay valid (e.g. memory-mapped file).
+bool ImFontAtlas::LoadGlyphCacheFromMemory(const void* data, size_t data_size)
+{
+    ImFontAtlasGlyphCache* cache = ImFontAtlasGlyphCacheCreate(data, data_size);
+    if (cache == NULL)
+    {
+        IMGUI_DEBUG_LOG_FONT("[font] Glyph cache: invalid or outdated data, ignoring.\n");
+        return false;
+    }
+    if (GlyphCache != NULL)
+        ImFontAtlasGlyphCacheDestroy(GlyphCache);
+    GlyphCache = cache;
+    IMGUI_DEBUG_LOG_FONT("[font] Glyph cache: loaded %d blocks, %d glyphs.\n", cache->BlocksCount, ((const ImFontAtlasGlyphCacheHeader*)data)->GlyphsCount);
+    return true;
+}
+
+bool ImFontAtlas::SaveGlyphCacheToFile(const char* filename)
+{
+    ImVector<unsigned char> buf;
+    if (!ImFontAtlasGlyphCacheBuild(this, &buf))
+        return false;
+    ImFileHandle f = ImFileOpen(filename, "wb");
+    if (!f)
+        return false;
+    bool ret = ImFileWrite(buf.Data, 1, (ImU64)buf.Size, f) == (ImU64)buf.Size;
+    ImFileClose(f);
+    return ret;
+}
+
+ImFontAtlasGlyphCache* ImFontAtlasGlyphCacheCreate(const void* data, size_t data_size)
+{
+    IM_ASSERT(data != NULL && ((size_t)data & 3) == 0 && "Glyph cache data needs to be 4-bytes aligned.");
+    const ImFontAtlasGlyphCacheHeader* header = (const ImFontAtlasGlyphCacheHeader*)data;
+    if (data_size < sizeof(*header) || memcmp(header->Magic, IM_FONTATLAS_GLYPHCACHE_MAGIC, sizeof(header->Magic)) != 0 || header->Version != IM_FONTATLAS_GLYPHCACHE_VERSION)
+        return NULL;
+
+    // Validate sections sizes and all offsets, so lookups don't need to
+    const ImU64 blocks_offset = sizeof(ImFontAtlasGlyphCacheHeader);
+    const ImU64 glyphs_offset = blocks_offset + (ImU64)header->BlocksCount * sizeof(ImFontAtlasGlyphCacheBlock);
+    const ImU64 pixels_offset = glyphs_offset + (ImU64)header->GlyphsCount * sizeof(ImFontAtlasGlyphCacheGlyph);
+    if (pixels_offset + header->PixelsSize > (ImU64)data_size || header->BlocksCount > 0xFFFF)
+        return NULL;
+    const ImFontAtlasGlyphCacheBlock* blocks = (const ImFontAtlasGlyphCacheBlock*)(const void*)((const unsigned char*)data + blocks_offset);
+    const ImFontAtlasGlyphCacheGlyph* glyphs = (const ImFontAtlasGlyphCacheGlyph*)(const void*)((const unsigned char*)data + glyphs_offset);
+    for (ImU32 n = 0; n < header->BlocksCount; n++)
+        if ((ImU64)blocks[n].GlyphsStart + blocks[n].GlyphsCount > header->GlyphsCount)
+            return NULL;
+    for (ImU32 n = 0; n < header->GlyphsCount; n++)
+        if ((ImU64)glyphs[n].PixelsOffset + (ImU64)glyphs[n].Width * glyphs[n].Height > header->PixelsSize)
+            return NULL;
+
+    ImFontAtlasGlyphCache* cache = IM_NEW(ImFontAtlasGlyphCache)();
+    cache->Data = (const unsigned char*)data;
+    cache->DataSize = data_size;
+    cache->Blocks = blocks;
+    cache->Glyphs = glyphs;
+    cache->Pixels = (const unsigned char*)data + pixels_offset;
+    cache->BlocksCount = (int)header->BlocksCount;
+    cache->BlocksMap.Data.reserve(cache->BlocksCount);
+    for (int n = 0; n < cache->BlocksCount; n++)
+        cache->BlocksMap.Data.push_back(ImGuiStoragePair(blocks[n].Key, n));
+    cache->BlocksMap.BuildSortByKey();
+    return cache;
+}
+
+void ImFontAtlasGlyphCacheDestroy(ImFontAtlasGlyphCache* cache)
+{
+    if (cache->DataOwned)
+        IM_FREE((void*)cache->Data);
+    IM_DELETE(cache);
+}
+
+// Hash everything affecting glyphs metrics and pixels for a given source at a given baked size.
+// Font data is hashed once on first use, which may take a few milliseconds for large fonts.
+ImGuiID ImFontAtlasGlyphCacheGetKey(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked)
+{
+    if (src->FontDataHash == 0)
+        src->FontDataHash = ImHashData(src->FontData, (size_t)src->FontDataSize);
+
+    int oversample_h, oversample_v;
+    ImFontAtlasBuildGetOversampleFactors(src, baked, &oversample_h, &oversample_v);
+    struct
+    {
+        float   Size, RefSize, SrcSize, RasterizerDensity, RasterizerMultiply;
+        float   GlyphOffsetX, GlyphOffsetY, GlyphMinAdvanceX, GlyphMaxAdvanceX, GlyphExtraAdvanceX;
+        ImU32   FontNo, FontLoaderFlags, AtlasFontLoaderFlags, OversampleH, OversampleV, PixelSnap, SDF;
+    } key_data;
+    key_data.Size = baked->Size;
+    key_data.RefSize = baked->ContainerFont->Sources[0]->SizePixels;
+    key_data.SrcSize = src->SizePixels; // Merged sources are scaled by SizePixels/RefSize (negative selects EM sizing)
+    key_data.RasterizerDensity = src->RasterizerDensity * baked->RasterizerDensity;
+    key_data.RasterizerMultiply = src->RasterizerMultiply;
+    key_data.GlyphOffsetX = src->GlyphOffset.x;
+    key_data.GlyphOffsetY = src->GlyphOffset.y;
+    key_data.GlyphMinAdvanceX = src->GlyphMinAdvanceX;
+    key_data.GlyphMaxAdvanceX = src->GlyphMaxAdvanceX;
+    key_data.GlyphExtraAdvanceX = src->GlyphExtraAdvanceX;
+    key_data.FontNo = src->FontNo;
+    key_data.FontLoaderFlags = src->FontLoaderFlags;
+    key_data.AtlasFontLoaderFlags = atlas->FontLoaderFlags;
+    key_data.OversampleH = (ImU32)oversample_h;
+    key_data.OversampleV = (ImU32)oversample_v;
+    key_data.PixelSnap = (src->PixelSnapH ? 1 : 0) | (src->PixelSnapV ? 2 : 0);
+    key_data.SDF = (baked->ContainerFont->Flags & ImFontFlags_SDF) ? 1 : 0;
+
+    const ImFontLoader* loader = src->FontLoader ? src->FontLoader : atlas->FontLoader;
+    ImGuiID key = ImHashData(&key_data, sizeof(key_data), src->FontDataHash);
+    return ImHashStr((loader && loader->Name) ? loader->Name : "", 0, key);
+}
+
+const ImFontAtlasGlyphCacheGlyph* ImFontAtlasGlyphCacheFind(ImFontAtlasGlyphCache* cache, ImGuiID key, ImWchar codepoint)
+{
+    const int block_idx = cache->BlocksMap.GetInt(key, -1);
+    if (block_idx == -1)
+        return NULL;
+    const ImFontAtlasGlyphCacheBlock* block = &cache->Blocks[block_idx];
+    const ImFontAtlasGlyphCacheGlyph* glyphs = cache->Glyphs + block->GlyphsStart;
+    int lo = 0, hi = (int)block->GlyphsCount;
+    while (lo < hi)
+    {
+        int mid = (lo + hi) >> 1;
+        if (glyphs[mid].Codepoint < (ImU32)codepoint)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return (lo < (int)block->GlyphsCount && glyphs[lo].Codepoint == (ImU32)codepoint) ? &glyphs[lo] : NULL;
+}
+
+// Called by ImFontBaked_BuildLoadGlyph() before calling the font loader. Return false on cache miss.
+// Stored metrics are final and stored pixels are already post-processed: we bypass ImFontAtlasBakedAddFontGlyph() adjustments.
+static bool ImFontAtlasGlyphCacheLoadGlyph(ImFontAtlas* atlas, ImFontConfig* src, int src_n, ImFontBaked* baked, ImWchar codepoint, float* only_load_advance_x, ImFontGlyph** out_glyph)
+{
+    ImFontAtlasGlyphCache* cache = atlas->GlyphCache;
+    const ImFontAtlasGlyphCacheGlyph* cached_glyph = ImFontAtlasGlyphCacheFind(cache, ImFontAtlasGlyphCacheGetKey(atlas, src, baked), codepoint);
+    if (cached_glyph == NULL)
+        return false;
+
+    if (only_load_advance_x != NULL)
+    {
+        *only_load_advance_x = cached_glyph->AdvanceX;
+        ImFontAtlasBakedAddFontGlyphAdvancedX(atlas, baked, NULL, codepoint, cached_glyph->AdvanceX);
+        *out_glyph = NULL;
+        return true;
+    }
+
+    ImFontGlyph glyph;
+    glyph.Codepoint = codepoint;
+    glyph.SourceIdx = src_n;
+    glyph.Visible = cached_glyph->Visible ? 1 : 0;
+    glyph.AdvanceX = cached_glyph->AdvanceX;
+    glyph.X0 = cached_glyph->X0;
+    glyph.Y0 = cached_glyph->Y0;
+    glyph.X1 = cached_glyph->X1;
+    glyph.Y1 = cached_glyph->Y1;
+    const int w = cached_glyph->Width;
+    const int h = cached_glyph->Height;
+    if (w > 0 && h > 0)
+    {
+        glyph.PackId = ImFontAtlasPackAddGlyphRect(atlas, w, h);
+        if (glyph.PackId == ImFontAtlasRectId_Invalid)
+            return false;
+    }
+    *out_glyph = ImFontAtlasBakedAddFontGlyph(atlas, baked, NULL, &glyph);
+    if (glyph.PackId != ImFontAtlasRectId_Invalid)
+    {
+        ImTextureData* tex = atlas->Builder->Pages[(*out_glyph)->TexPage]->Tex;
+        ImTextureRect* r = ImFontAtlasPackGetRect(atlas, glyph.PackId);
+        ImFontAtlasTextureBlockConvert(cache->Pixels + cached_glyph->PixelsOffset, ImTextureFormat_Alpha8, w, (unsigned char*)tex->GetPixelsAt(r->x, r->y), tex->Format, tex->GetPitch(), w, h);
+        ImFontAtlasTextureBlockQueueUpload(atlas, tex, r->x, r->y, w, h);
+    }
+    cache->GlyphsLoadedCount++;
+    return true;
+}
+
+static int IMGUI_CDECL ImFontAtlasGlyphCacheGlyphComparerByCodepoint(const void* lhs, const void* rhs)
+{
+    const ImU32 a = ((const ImFontAtlasGlyphCacheGlyph*)lhs)->Codepoint;
+    const ImU32 b = ((const ImFontAtlasGlyphCacheGlyph*)rhs)->Codepoint;
+    return (a < b) ? -1 : (a > b) ? 1 : 0;
+}
+
+// Copy a glyph from loaded cache into output buffers.
+static void ImFontAtlasGlyphCacheCopyGlyph(const ImFontAtlasGlyphCache* cache, const ImFontAtlasGlyphCacheGlyph* src_glyph, ImVector<ImFontAtlasGlyphCacheGlyph>* glyphs, ImVector<unsigned char>* pixels)
+{
+    ImFontAtlasGlyphCacheGlyph glyph = *src_glyph;
+    const int pixels_size = glyph.Width * glyph.Height;
+    glyph.PixelsOffset = (ImU32)pixels->Size;
+    pixels->resize(pixels->Size + pixels_size);
+    memcpy(pixels->Data + glyph.PixelsOffset, cache->Pixels + src_glyph->PixelsOffset, (size_t)pixels_size);
+    glyphs->push_back(glyph);
+}
+
+// Serialize all currently baked glyphs + entries of loaded cache which are not currently baked.
+bool ImFontAtlasGlyphCacheBuild(ImFontAtlas* atlas, ImVector<unsigned char>* out_data)
+{
+    ImVector<ImFontAtlasGlyphCacheBlock> blocks;
+    ImVector<ImFontAtlasGlyphCacheGlyph> glyphs;
+    ImVector<unsigned char> pixels;
+    ImGuiStorage keys_written;
+
+    if (ImFontAtlasBuilder* builder = atlas->Builder)
+    {
+        if (atlas->TexData == NULL || atlas->TexData->Pixels == NULL)
+            return false;
+        ImFontAtlasBuildFlushGlyphJobs(atlas); // Pending glyphs need to be in texture before we read them back
+
+        for (int baked_n = 0; baked_n < builder->BakedPool.Size; baked_n++)
+        {
+            ImFontBaked* baked = &builder->BakedPool[baked_n];
+            if (baked->WantDestroy)
+                continue;
+            ImFont* font = baked->ContainerFont;
+            for (int src_n = 0; src_n < font->Sources.Size; src_n++)
+            {
+                ImFontConfig* src = font->Sources[src_n];
+                const ImGuiID key = ImFontAtlasGlyphCacheGetKey(atlas, src, baked);
+                if (keys_written.GetBool(key))
+                    continue;
+                keys_written.SetBool(key, true);
+
+                ImFontAtlasGlyphCacheBlock block = { key, (ImU32)glyphs.Size, 0, 0 };
+                for (int glyph_idx = 0; glyph_idx < baked->Glyphs.Size; glyph_idx++)
+                {
+                    // Skip glyphs not coming from loader (fallback, tab, auto-baked ellipsis, custom rects) and discarded glyphs.
+                    const ImFontGlyph* glyph = &baked->Glyphs[glyph_idx];
+                    const ImWchar c = (ImWchar)glyph->Codepoint;
+                    if (glyph->SourceIdx != (unsigned int)src_n || c < 32 || glyph->Colored || baked->IndexLookup[c] != glyph_idx)
+                        continue;
+                    if ((font->EllipsisAutoBake && c == font->EllipsisChar) || (ImWchar)font->RemapPairs.GetInt(c, c) != c)
+                        continue;
+                    if (glyph->Visible && glyph->PackId == ImFontAtlasRectId_Invalid)
+                        continue;
+
+                    ImFontAtlasGlyphCacheGlyph out_glyph = { glyph->Codepoint, 0, 0, glyph->AdvanceX, glyph->X0, glyph->Y0, glyph->X1, glyph->Y1, (ImU32)pixels.Size, glyph->Visible };
+                    if (glyph->PackId != ImFontAtlasRectId_Invalid)
+                    {
+                        ImTextureData* tex = builder->Pages[glyph->TexPage]->Tex;
+                        ImTextureRect* r = ImFontAtlasPackGetRect(atlas, glyph->PackId);
+                        out_glyph.Width = r->w;
+                        out_glyph.Height = r->h;
+                        pixels.resize(pixels.Size + r->w * r->h);
+                        ImFontAtlasTextureBlockConvert((const unsigned char*)tex->GetPixelsAt(r->x, r->y), tex->Format, tex->GetPitch(), pixels.Data + out_glyph.PixelsOffset, ImTextureFormat_Alpha8, r->w, r->w, r->h);
+                    }
+                    glyphs.push_back(out_glyph);
+                    block.GlyphsCount++;
+                }
+                ImQsort(glyphs.Data + block.GlyphsStart, block.GlyphsCount, sizeof(ImFontAtlasGlyphCacheGlyph), ImFontAtlasGlyphCacheGlyphComparerByCodepoint);
+
+                // Keep glyphs of the loaded cache block with same key which were not used during this run.
+                // Both lists are sorted by codepoint so we can merge them linearly, then sort again.
+                const int loaded_block_idx = atlas->GlyphCache ? atlas->GlyphCache->BlocksMap.GetInt(key, -1) : -1;
+                if (loaded_block_idx != -1)
+                {
+                    const ImFontAtlasGlyphCache* cache = atlas->GlyphCache;
+                    const ImFontAtlasGlyphCacheBlock* loaded_block = &cache->Blocks[loaded_block_idx];
+                    const ImU32 baked_glyphs_count = block.GlyphsCount;
+                    for (ImU32 loaded_n = 0, out_glyph_n = 0; loaded_n < loaded_block->GlyphsCount; loaded_n++)
+                    {
+                        const ImFontAtlasGlyphCacheGlyph* loaded_glyph = &cache->Glyphs[loaded_block->GlyphsStart + loaded_n];
+                        while (out_glyph_n < baked_glyphs_count && glyphs[block.GlyphsStart + out_glyph_n].Codepoint < loaded_glyph->Codepoint)
+                            out_glyph_n++;
+                        if (out_glyph_n < baked_glyphs_count && glyphs[block.GlyphsStart + out_glyph_n].Codepoint == loaded_glyph->Codepoint)
+                            continue;
+                        ImFontAtlasGlyphCacheCopyGlyph(cache, loaded_glyph, &glyphs, &pixels);
+                        block.GlyphsCount++;
+                    }
+                    if (block.GlyphsCount != baked_glyphs_count)
+                        ImQsort(glyphs.Data + block.GlyphsStart, block.GlyphsCount, sizeof(ImFontAtlasGlyphCacheGlyph), ImFontAtlasGlyphCacheGlyphComparerByCodepoint);
+                }
+                if (block.GlyphsCount == 0)
+                    continue;
+                blocks.push_back(block);
+            }
+        }
+    }
+
+    // Keep loaded blocks which were not used during this run (blocks used during this run were merged above)
+    if (ImFontAtlasGlyphCache* cache = atlas->GlyphCache)
+        for (int block_n = 0; block_n < cache->BlocksCount; block_n++)
+        {
+            const ImFontAtlasGlyphCacheBlock* src_block = &cache->Blocks[block_n];
+            if (keys_written.GetBool(src_block->Key))
+                continue;
+            keys_written.SetBool(src_block->Key, true);
+            ImFontAtlasGlyphCacheBlock block = { src_block->Key, (ImU32)glyphs.Size, src_block->GlyphsCount, 0 };
+            for (ImU32 n = 0; n < src_block->GlyphsCount; n++)
+                ImFontAtlasGlyphCacheCopyGlyph(cache, &cache->Glyphs[src_block->GlyphsStart + n], &glyphs, &pixels);
+            blocks.push_back(block);
+        }
+
+    ImFontAtlasGlyphCacheHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.Magic, IM_FONTATLAS_GLYPHCACHE_MAGIC, sizeof(header.Magic));
+    header.Version = IM_FONTATLAS_GLYPHCACHE_VERSION;
+    header.BlocksCount = (ImU32)blocks.Size;
+    header.GlyphsCount = (ImU32)glyphs.Size;
+    header.PixelsSize = (ImU32)pixels.Size;
+    out_data->resize((int)sizeof(header) + blocks.size_in_bytes() + glyphs.size_in_bytes() + pixels.size_in_bytes());
+    unsigned char* p = out_data->Data;
+    memcpy(p, &header, sizeof(header)); p += sizeof(header);
+    memcpy(p, blocks.Data, (size_t)blocks.size_in_bytes()); p += blocks.size_in_bytes();
+    memcpy(p, glyphs.Data, (size_t)glyphs.size_in_bytes()); p += glyphs.size_in_bytes();
+    memcpy(p, pixels.Data, (size_t)pixels.size_in_bytes());
+    IMGUI_DEBUG_LOG_FONT("[font] Glyph cache: saved %d blocks, %d glyphs, %d bytes.\n", blocks.Size, glyphs.Size, out_data->Size);
+    return true;
+}
+
 //-------------------------------------------------------------------------
 // [SECTION] ImFontAtlas: backend for stb_truetype
 //-------------------------------------------------------------------------
@@ -4567,6 +6617,7 @@ static bool ImGui_ImplStbTrueType_FontSrcInit(ImFontAtlas* atlas, ImFontConfig*
         IM_ASSERT_USER_ERROR(0, "stbtt_InitFont(): failed to parse FontData. It is correct and complete? Check FontDataSize.");
         return false;
     }
+    bd_font_data->FontInfo.userdata = NULL; // Passed to STBTT_malloc(): only set by glyph jobs
     src->FontLoaderData = bd_font_data;
 
     const float ref_size = src->DstFont->Sources[0]->SizePixels;
@@ -4620,6 +6671,25 @@ static bool ImGui_ImplStbTrueType_FontBakedInit(ImFontAtlas* atlas, ImFontConfig
     return true;
 }
 
+// Same as stbtt__oversample_shift(), which is not available with IMGUI_DISABLE_STB_TRUETYPE_IMPLEMENTATION.
+static float ImGui_ImplStbTrueType_OversampleShift(int oversample)
+{
+    return (oversample != 0) ? (float)-(oversample - 1) / (2.0f * (float)oversample) : 0.0f;
+}
+
+// Render a signed distance field glyph (ImFontFlags_SDF) into a w*h buffer, including IMGUI_FONT_SDF_PADDING texels on each side.
+static bool ImGui_ImplStbTrueType_MakeGlyphSDF(const stbtt_fontinfo* info, unsigned char* out_pixels, int w, int h, float scale, int glyph_index)
+{
+    int sdf_w, sdf_h, sdf_off_x, sdf_off_y;
+    unsigned char* sdf_pixels = stbtt_GetGlyphSDF(info, scale, glyph_index, IMGUI_FONT_SDF_PADDING, IM_FONT_SDF_ONEDGE_VALUE, IM_FONT_SDF_PIXEL_DIST_SCALE, &sdf_w, &sdf_h, &sdf_off_x, &sdf_off_y);
+    if (sdf_pixels == NULL)
+        return false;
+    IM_ASSERT(sdf_w == w && sdf_h == h);
+    memcpy(out_pixels, sdf_pixels, (size_t)w * h);
+    stbtt_FreeSDF(sdf_pixels, info->userdata);
+    return true;
+}
+
 static bool ImGui_ImplStbTrueType_FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void*, ImWchar codepoint, ImFontGlyph* out_glyph, float* out_advance_x)
 {
     // Search for first font which has the glyph
@@ -4630,6 +6700,7 @@ static bool ImGui_ImplStbTrueType_FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontC
         return false;
 
     // Fonts unit to pixels
+    const bool is_sdf = (src->DstFont->Flags & ImFontFlags_SDF) != 0;
     int oversample_h, oversample_v;
     ImFontAtlasBuildGetOversampleFactors(src, baked, &oversample_h, &oversample_v);
     const float scale_for_layout = bd_font_data->ScaleFactor * baked->Size;
@@ -4660,9 +6731,10 @@ static bool ImGui_ImplStbTrueType_FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontC
     const bool is_visible = (x0 != x1 && y0 != y1);
     if (is_visible)
     {
-        const int w = (x1 - x0 + oversample_h - 1);
-        const int h = (y1 - y0 + oversample_v - 1);
-        ImFontAtlasRectId pack_id = ImFontAtlasPackAddRect(atlas, w, h);
+        const int sdf_padding = is_sdf ? IMGUI_FONT_SDF_PADDING : 0;
+        const int w = (x1 - x0 + oversample_h - 1) + sdf_padding * 2;
+        const int h = (y1 - y0 + oversample_v - 1) + sdf_padding * 2;
+        ImFontAtlasRectId pack_id = ImFontAtlasPackAddGlyphRect(atlas, w, h);
         if (pack_id == ImFontAtlasRectId_Invalid)
         {
             // Pathological out of memory case (TexMaxWidth/TexMaxHeight set too small?)
@@ -4671,18 +6743,37 @@ static bool ImGui_ImplStbTrueType_FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontC
         }
         ImTextureRect* r = ImFontAtlasPackGetRect(atlas, pack_id);
 
-        // Render
+        // Render now, or queue rendering when loading many glyphs at once
         stbtt_GetGlyphBitmapBox(&bd_font_data->FontInfo, glyph_index, scale_for_raster_x, scale_for_raster_y, &x0, &y0, &x1, &y1);
-        ImFontAtlasBuilder* builder = atlas->Builder;
-        builder->TempBuffer.resize(w * h * 1);
-        unsigned char* bitmap_pixels = builder->TempBuffer.Data;
-        memset(bitmap_pixels, 0, w * h * 1);
-
-        // Render with oversampling
-        // (those functions conveniently assert if pixels are not cleared, which is another safety layer)
-        float sub_x, sub_y;
-        stbtt_MakeGlyphBitmapSubpixelPrefilter(&bd_font_data->FontInfo, bitmap_pixels, w, h, w,
-            scale_for_raster_x, scale_for_raster_y, 0, 0, oversample_h, oversample_v, &sub_x, &sub_y, glyph_index);
+        x0 -= sdf_padding;
+        y0 -= sdf_padding;
+        unsigned char* bitmap_pixels = NULL;
+        if (ImFontAtlasGlyphJob* job = ImFontAtlasBuildAddGlyphJob(atlas, baked, src, pack_id, w, h))
+        {
+            job->LoaderGlyphIndex = glyph_index;
+            job->LoaderScaleX = scale_for_raster_x;
+            job->LoaderScaleY = scale_for_raster_y;
+            job->LoaderOversampleH = oversample_h;
+            job->LoaderOversampleV = oversample_v;
+        }
+        else
+        {
+            ImFontAtlasBuilder* builder = atlas->Builder;
+            builder->TempBuffer.resize(w * h * 1);
+            bitmap_pixels = builder->TempBuffer.Data;
+            memset(bitmap_pixels, 0, w * h * 1);
+
+            // Render with oversampling
+            // (those functions conveniently assert if pixels are not cleared, which is another safety layer)
+            float unused_sub_x, unused_sub_y;
+            if (is_sdf)
+                ImGui_ImplStbTrueType_MakeGlyphSDF(&bd_font_data->FontInfo, bitmap_pixels, w, h, scale_for_raster_x, glyph_index);
+            else
+                stbtt_MakeGlyphBitmapSubpixelPrefilter(&bd_font_data->FontInfo, bitmap_pixels, w, h, w,
+                    scale_for_raster_x, scale_for_raster_y, 0, 0, oversample_h, oversample_v, &unused_sub_x, &unused_sub_y, glyph_index);
+        }
+        float sub_x = ImGui_ImplStbTrueType_OversampleShift(oversample_h);
+        float sub_y = ImGui_ImplStbTrueType_OversampleShift(oversample_v);
 
         const float ref_size = baked->ContainerFont->Sources[0]->SizePixels;
         const float offsets_scale = (ref_size != 0.0f) ? (baked->Size / ref_size) : 1.0f;
@@ -4706,9 +6797,54 @@ static bool ImGui_ImplStbTrueType_FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontC
         out_glyph->Y1 = (y0 + (int)r->h) * recip_v + font_off_y;
         out_glyph->Visible = true;
         out_glyph->PackId = pack_id;
-        ImFontAtlasBakedSetFontGlyphBitmap(atlas, baked, src, out_glyph, r, bitmap_pixels, ImTextureFormat_Alpha8, w);
+        if (bitmap_pixels != NULL)
+            ImFontAtlasBakedSetFontGlyphBitmap(atlas, baked, src, out_glyph, r, bitmap_pixels, ImTextureFormat_Alpha8, w);
+    }
+
+    return true;
+}
+
+// Render a glyph queued by ImGui_ImplStbTrueType_FontBakedLoadGlyph(). May be called from any thread.
+static bool ImGui_ImplStbTrueType_FontBakedRasterizeGlyph(ImFontAtlas* atlas, ImFontConfig* src, const ImFontAtlasGlyphJob* job, unsigned char* out_pixels, ImFontAtlasGlyphJobScratch* scratch)
+{
+    IM_UNUSED(atlas);
+    ImGui_ImplStbTrueType_FontSrcData* bd_font_data = (ImGui_ImplStbTrueType_FontSrcData*)src->FontLoaderData;
+
+    // stb_truetype doesn't check all allocations: leave to main thread what may not fit in scratch memory.
+    // - Scanline buffer (allocated without check for glyphs wider than 64 pixels).
+    // - CFF outlines (vertices allocated without check).
+    // - Signed distance field buffers (allocated without check, verified below once outline size is known).
+    const bool is_sdf = (src->DstFont->Flags & ImFontFlags_SDF) != 0;
+    if (scratch != NULL && ((!is_sdf && (job->Width * 2 + 1) * (int)sizeof(float) > scratch->Size / 4) || bd_font_data->FontInfo.cff.size != 0))
+    {
+        scratch->Overflow = true;
+        return false;
     }
 
+    stbtt_fontinfo font_info = bd_font_data->FontInfo; // Copy so allocations are redirected to scratch memory
+    font_info.userdata = scratch;
+    if (is_sdf)
+    {
+        if (scratch != NULL)
+        {
+            // stbtt_GetGlyphSDF() allocates: outline vertices (measured with a dry run), distance field, one float per vertex.
+            stbtt_vertex* vertices = NULL;
+            const int scratch_used = scratch->Used;
+            const int vertices_count = stbtt_GetGlyphShape(&font_info, job->LoaderGlyphIndex, &vertices);
+            const int vertices_size = scratch->Used - scratch_used;
+            scratch->Used = scratch_used;
+            const int sdf_size = ((job->Width * job->Height + 15) & ~15) + ((vertices_count * (int)sizeof(float) + 15) & ~15);
+            if (scratch->Overflow || vertices_size + sdf_size > scratch->Size - scratch_used)
+            {
+                scratch->Overflow = true;
+                return false;
+            }
+        }
+        return ImGui_ImplStbTrueType_MakeGlyphSDF(&font_info, out_pixels, job->Width, job->Height, job->LoaderScaleX, job->LoaderGlyphIndex);
+    }
+    float sub_x, sub_y;
+    stbtt_MakeGlyphBitmapSubpixelPrefilter(&font_info, out_pixels, job->Width, job->Height, job->Width,
+        job->LoaderScaleX, job->LoaderScaleY, 0, 0, job->LoaderOversampleH, job->LoaderOversampleV, &sub_x, &sub_y, job->LoaderGlyphIndex);
     return true;
 }
 
@@ -4722,6 +6858,7 @@ const ImFontLoader* ImFontAtlasGetFontLoaderForStbTruetype()
     loader.FontBakedInit = ImGui_ImplStbTrueType_FontBakedInit;
     loader.FontBakedDestroy = NULL;
     loader.FontBakedLoadGlyph = ImGui_ImplStbTrueType_FontBakedLoadGlyph;
+    loader.FontBakedRasterizeGlyph = ImGui_ImplStbTrueType_FontBakedRasterizeGlyph;
     return &loader;
 }
 
@@ -5110,15 +7247,20 @@ ImFontGlyph* ImFontAtlasBakedAddFontGlyph(ImFontAtlas* atlas, ImFontBaked* baked
     IM_ASSERT(baked->Glyphs.Size < 0xFFFE); // IndexLookup[] hold 16-bit values and -1/-2 are reserved.
 
     // Set UV from packed rectangle
+    ImTextureData* tex = atlas->TexData;
     if (glyph->PackId != ImFontAtlasRectId_Invalid)
     {
         ImTextureRect* r = ImFontAtlasPackGetRect(atlas, glyph->PackId);
+        const int page_n = ImFontAtlasPackGetRectPage(atlas, glyph->PackId);
+        ImFontAtlasPage* page = atlas->Builder->Pages[page_n];
         IM_ASSERT(glyph->U0 == 0.0f && glyph->V0 == 0.0f && glyph->U1 == 0.0f && glyph->V1 == 0.0f);
-        glyph->U0 = (r->x) * atlas->TexUvScale.x;
-        glyph->V0 = (r->y) * atlas->TexUvScale.y;
-        glyph->U1 = (r->x + r->w) * atlas->TexUvScale.x;
-        glyph->V1 = (r->y + r->h) * atlas->TexUvScale.y;
+        glyph->TexPage = page_n;
+        glyph->U0 = (r->x) * page->TexUvScale.x;
+        glyph->V0 = (r->y) * page->TexUvScale.y;
+        glyph->U1 = (r->x + r->w) * page->TexUvScale.x;
+        glyph->V1 = (r->y + r->h) * page->TexUvScale.y;
         baked->MetricsTotalSurface += r->w * r->h;
+        tex = page->Tex;
     }
 
     if (src != NULL)
@@ -5142,7 +7284,7 @@ ImFontGlyph* ImFontAtlasBakedAddFontGlyph(ImFontAtlas* atlas, ImFontBaked* baked
         glyph->AdvanceX = advance_x + src->GlyphExtraAdvanceX;
     }
     if (glyph->Colored)
-        atlas->TexPixelsUseColors = atlas->TexData->UseColors = true;
+        atlas->TexPixelsUseColors = tex->UseColors = true;
 
     // Update lookup tables
     const int codepoint = glyph->Codepoint;
@@ -5181,7 +7323,7 @@ void ImFontAtlasBakedAddFontGlyphAdvancedX(ImFontAtlas* atlas, ImFontBaked* bake
 // Copy to texture, post-process and queue update for backend
 void ImFontAtlasBakedSetFontGlyphBitmap(ImFontAtlas* atlas, ImFontBaked* baked, ImFontConfig* src, ImFontGlyph* glyph, ImTextureRect* r, const unsigned char* src_pixels, ImTextureFormat src_fmt, int src_pitch)
 {
-    ImTextureData* tex = atlas->TexData;
+    ImTextureData* tex = atlas->Builder->Pages[glyph->TexPage]->Tex;
     IM_ASSERT(r->x + r->w <= tex->Width && r->y + r->h <= tex->Height);
     ImFontAtlasTextureBlockConvert(src_pixels, src_fmt, src_pitch, (unsigned char*)tex->GetPixelsAt(r->x, r->y), tex->Format, tex->GetPitch(), r->w, r->h);
     ImFontAtlasPostProcessData pp_data = { atlas, baked->ContainerFont, src, baked, glyph, tex->GetPixelsAt(r->x, r->y), tex->Format, tex->GetPitch(), r->w, r->h };
@@ -5239,6 +7381,32 @@ bool ImFontBaked::IsGlyphLoaded(ImWchar c)
     return false;
 }
 
+// Find baked copy matching GetFontBaked() rounding and density. Return NULL if the size was not registered with AddWorkerDrawListFont().
+// Density comes from the setup time snapshot: font->CurrentRasterizerDensity may be modified by main thread while workers are running.
+static ImFontBaked* ImDrawListSharedDataFindWorkerFontBaked(const ImDrawListSharedData* data, ImFont* font, float size)
+{
+    const bool is_sdf = (font->Flags & ImFontFlags_SDF) != 0;
+    size = is_sdf ? IMGUI_FONT_SDF_BAKE_SIZE : ImGui::GetRoundedFontSize(size);
+    const float density = is_sdf ? 1.0f : data->WorkerFontRasterizerDensity;
+    for (ImFontBaked* baked : data->WorkerFontBakeds)
+        if (baked->ContainerFont == font && baked->Size == size && baked->RasterizerDensity == density)
+            return baked;
+    IM_ASSERT(0 && "Font size not registered with AddWorkerDrawListFont()!");
+    return NULL;
+}
+
+// Read-only version of ImFontBaked::FindGlyph(): missing or not yet loaded glyphs return the fallback glyph.
+static inline const ImFontGlyph* ImFontBakedFindGlyphNoLoad(const ImFontBaked* baked, unsigned int c)
+{
+    if (c < (unsigned int)baked->IndexLookup.Size)
+    {
+        const int i = (int)baked->IndexLookup.Data[c];
+        if (i != IM_FONTGLYPH_INDEX_NOT_FOUND && i != IM_FONTGLYPH_INDEX_UNUSED)
+            return &baked->Glyphs.Data[i];
+    }
+    return &baked->Glyphs.Data[baked->FallbackGlyphIndex];
+}
+
 // This is not fast query
 bool ImFont::IsGlyphInFont(ImWchar c)
 {
@@ -5288,6 +7456,12 @@ ImFontBaked* ImFont::GetFontBaked(float size, float density)
 
     if (density < 0.0f)
         density = CurrentRasterizerDensity;
+    if (Flags & ImFontFlags_SDF)
+    {
+        // Signed distance field fonts use a single bake for all sizes and densities. Callers scale glyphs by 'size / baked->Size'.
+        size = IMGUI_FONT_SDF_BAKE_SIZE;
+        density = 1.0f;
+    }
     if (baked && baked->Size == size && baked->RasterizerDensity == density)
         return baked;
 
@@ -5301,6 +7475,36 @@ ImFontBaked* ImFont::GetFontBaked(float size, float density)
     return baked;
 }
 
+// Predict glyphs needed by a new size from glyphs recently used at another size of the same font (e.g. after a DPI change), and load them in a batch.
+static void ImFontAtlasBakedPreloadGlyphsFromRecentSize(ImFontAtlas* atlas, ImFont* font, ImFontBaked* baked)
+{
+    if (atlas->Locked || (font->Flags & ImFontFlags_NoLoadGlyphs) || baked->Size >= IMGUI_FONT_SIZE_THRESHOLD_FOR_LOADADVANCEXONLYMODE || baked->LoadNoRenderOnLayout)
+        return;
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    ImFontBaked* ref_baked = NULL;
+    for (int baked_n = 0; baked_n < builder->BakedPool.Size; baked_n++)
+    {
+        ImFontBaked* other_baked = &builder->BakedPool[baked_n];
+        if (other_baked == baked || other_baked->ContainerFont != font || other_baked->WantDestroy || other_baked->LastUsedFrame < builder->FrameCount - 1)
+            continue;
+        if (ref_baked == NULL || other_baked->Glyphs.Size > ref_baked->Glyphs.Size)
+            ref_baked = other_baked;
+    }
+    if (ref_baked == NULL)
+        return;
+
+    ImVector<ImWchar> codepoints;
+    codepoints.reserve(ref_baked->Glyphs.Size);
+    for (const ImFontGlyph& glyph : ref_baked->Glyphs)
+        if (glyph.Codepoint >= 32)
+            codepoints.push_back((ImWchar)glyph.Codepoint);
+    ImFontAtlasBuildBeginGlyphJobs(atlas);
+    for (ImWchar c : codepoints)
+        if (!baked->IsGlyphLoaded(c))
+            ImFontBaked_BuildLoadGlyph(baked, c, NULL);
+    ImFontAtlasBuildEndGlyphJobs(atlas);
+}
+
 ImFontBaked* ImFontAtlasBakedGetOrAdd(ImFontAtlas* atlas, ImFont* font, float font_size, float font_rasterizer_density)
 {
     // FIXME-NEWATLAS: Design for picking a nearest size based on some criteria?
@@ -5333,6 +7537,7 @@ ImFontBaked* ImFontAtlasBakedGetOrAdd(ImFontAtlas* atlas, ImFont* font, float fo
     // Create new
     baked = ImFontAtlasBakedAdd(atlas, font, font_size, font_rasterizer_density, baked_id);
     *p_baked_in_map = baked; // To avoid 'builder->BakedMap.SetVoidPtr(baked_id, baked);' while we can.
+    ImFontAtlasBakedPreloadGlyphsFromRecentSize(atlas, font, baked);
     return baked;
 }
 
@@ -5405,7 +7610,7 @@ const char* ImFont::CalcWordWrapPosition(float size, const char* text, const cha
         // Optimized inline version of 'float char_width = GetCharAdvance((ImWchar)c);'
         float char_width = (c < (unsigned int)baked->IndexAdvanceX.Size) ? baked->IndexAdvanceX.Data[c] : -1.0f;
         if (char_width < 0.0f)
-            char_width = BuildLoadGlyphGetAdvanceOrFallback(baked, c);
+            char_width = BuildLoadGlyphGetAdvanceOrFallback(baked, c, next_s, text_end);
 
         if (ImCharIsBlankW(c))
         {
@@ -5455,29 +7660,35 @@ const char* ImFont::CalcWordWrapPosition(float size, const char* text, const cha
     return s;
 }
 
-ImVec2 ImFont::CalcTextSizeA(float size, float max_width, float wrap_width, const char* text_begin, const char* text_end, const char** remaining)
+// Optionally output the [begin, end) offsets of each line, as they are rendered by RenderText() (with leading blanks of wrapped lines skipped).
+static ImVec2 ImFontCalcTextSizeEx(ImFont* font, float size, float max_width, float wrap_width, const char* text_begin, const char* text_end, const char** remaining, ImVector<int>* out_lines)
 {
-    if (!text_end)
-        text_end = text_begin + ImStrlen(text_begin); // FIXME-OPT: Need to avoid this.
+    // When text_end is NULL we stop on the zero terminator instead of measuring the string first.
+    // Only word-wrapping and loading new glyphs need the end, which is then computed once.
+    const bool word_wrap_enabled = (wrap_width > 0.0f);
+    if (!text_end && word_wrap_enabled)
+        text_end = text_begin + ImStrlen(text_begin);
 
     const float line_height = size;
-    ImFontBaked* baked = GetFontBaked(size);
+    ImFontBaked* baked = font->GetFontBaked(size);
     const float scale = size / baked->Size;
 
     ImVec2 text_size = ImVec2(0, 0);
     float line_width = 0.0f;
 
-    const bool word_wrap_enabled = (wrap_width > 0.0f);
     const char* word_wrap_eol = NULL;
+    const char* ascii_run_end = NULL;
+    if (out_lines)
+        out_lines->push_back(0);
 
     const char* s = text_begin;
-    while (s < text_end)
+    while (text_end ? (s < text_end) : (*s != 0))
     {
         if (word_wrap_enabled)
         {
             // Calculate how far we can render. Requires two passes on the string data but keeps the code simple and not intrusive for what's essentially an uncommon feature.
             if (!word_wrap_eol)
-                word_wrap_eol = CalcWordWrapPosition(size, s, text_end, wrap_width - line_width);
+                word_wrap_eol = font->CalcWordWrapPosition(size, s, text_end, wrap_width - line_width);
 
             if (s >= word_wrap_eol)
             {
@@ -5486,18 +7697,53 @@ ImVec2 ImFont::CalcTextSizeA(float size, float max_width, float wrap_width, cons
                 text_size.y += line_height;
                 line_width = 0.0f;
                 word_wrap_eol = NULL;
+                if (out_lines)
+                    out_lines->push_back((int)(s - text_begin));
                 s = CalcWordWrapNextLineStartA(s, text_end); // Wrapping skips upcoming blanks
+                if (out_lines)
+                    out_lines->push_back((int)(s - text_begin));
                 continue;
             }
         }
 
+        // Fast path for runs of printable ASCII characters: no decoding, no control characters.
+        // Widths are accumulated in the same order as the generic path below, so results are identical.
+        // Characters whose advance is not loaded yet and reaching max_width are left to the generic path.
+        if (s >= ascii_run_end && (unsigned char)*s >= 0x20 && (unsigned char)*s < 0x80)
+            ascii_run_end = ImTextFindPrintableAsciiEnd(s, word_wrap_enabled ? word_wrap_eol : text_end);
+        if (s < ascii_run_end)
+        {
+            const float* advances = baked->IndexAdvanceX.Data;
+            const unsigned int advances_count = (unsigned int)baked->IndexAdvanceX.Size;
+            const char* run_begin = s;
+            for (; s < ascii_run_end; s++)
+            {
+                const unsigned int c = (unsigned char)*s;
+                float char_width = (c < advances_count) ? advances[c] : -1.0f;
+                if (char_width < 0.0f)
+                    break;
+                char_width *= scale;
+                if (line_width + char_width >= max_width)
+                    break;
+                line_width += char_width;
+            }
+            if (s != run_begin)
+                continue;
+        }
+
         // Decode and advance source
         const char* prev_s = s;
         unsigned int c = (unsigned int)*s;
         if (c < 0x80)
+        {
             s += 1;
+        }
         else
+        {
+            if (!text_end)
+                text_end = s + ImStrlen(s); // Bound UTF-8 decoding of zero-terminated text, so a truncated sequence can't read past the terminator
             s += ImTextCharFromUtf8(&c, s, text_end);
+        }
 
         if (c < 32)
         {
@@ -5506,6 +7752,11 @@ ImVec2 ImFont::CalcTextSizeA(float size, float max_width, float wrap_width, cons
                 text_size.x = ImMax(text_size.x, line_width);
                 text_size.y += line_height;
                 line_width = 0.0f;
+                if (out_lines)
+                {
+                    out_lines->push_back((int)(prev_s - text_begin));
+                    out_lines->push_back((int)(s - text_begin));
+                }
                 continue;
             }
             if (c == '\r')
@@ -5515,7 +7766,7 @@ ImVec2 ImFont::CalcTextSizeA(float size, float max_width, float wrap_width, cons
         // Optimized inline version of 'float char_width = GetCharAdvance((ImWchar)c);'
         float char_width = (c < (unsigned int)baked->IndexAdvanceX.Size) ? baked->IndexAdvanceX.Data[c] : -1.0f;
         if (char_width < 0.0f)
-            char_width = BuildLoadGlyphGetAdvanceOrFallback(baked, c);
+            char_width = BuildLoadGlyphGetAdvanceOrFallback(baked, c, s, text_end);
         char_width *= scale;
 
         if (line_width + char_width >= max_width)
@@ -5535,15 +7786,43 @@ ImVec2 ImFont::CalcTextSizeA(float size, float max_width, float wrap_width, cons
 
     if (remaining)
         *remaining = s;
+    if (out_lines)
+        out_lines->push_back((int)(s - text_begin));
 
     return text_size;
 }
 
+ImVec2 ImFont::CalcTextSizeA(float size, float max_width, float wrap_width, const char* text_begin, const char* text_end, const char** remaining)
+{
+    return ImFontCalcTextSizeEx(this, size, max_width, wrap_width, text_begin, text_end, remaining, NULL);
+}
+
+// Measure text and output the [begin, end) offsets of each line into out_lines[] (two entries per line). Used by the text layout cache.
+ImVec2 ImFontCalcTextSizeWithLines(ImFont* font, float size, float wrap_width, const char* text_begin, const char* text_end, ImVector<int>* out_lines)
+{
+    IM_ASSERT(text_end != NULL && out_lines != NULL);
+    out_lines->resize(0);
+    return ImFontCalcTextSizeEx(font, size, FLT_MAX, wrap_width, text_begin, text_end, NULL, out_lines);
+}
+
+// Texture to bind for glyphs of a given atlas page. Page 0 is the bound font atlas texture.
+static ImTextureRef ImFontGetPageTexRef(ImFont* font, ImDrawList* draw_list, int page_n)
+{
+    if (page_n == 0)
+        return draw_list->_TextureStack.back();
+    ImTextureRef tex_ref;
+    tex_ref._TexData = draw_list->_Data->IsWorkerCopy ? draw_list->_Data->WorkerTexPages[page_n] : font->ContainerAtlas->Builder->Pages[page_n]->Tex;
+    return tex_ref;
+}
+
 // Note: as with every ImDrawList drawing function, this expects that the font atlas texture is bound.
 void ImFont::RenderChar(ImDrawList* draw_list, float size, const ImVec2& pos, ImU32 col, ImWchar c, const ImVec4* cpu_fine_clip)
 {
-    ImFontBaked* baked = GetFontBaked(size);
-    const ImFontGlyph* glyph = baked->FindGlyph(c);
+    const bool is_worker = draw_list->_Data->IsWorkerCopy;
+    ImFontBaked* baked = is_worker ? ImDrawListSharedDataFindWorkerFontBaked(draw_list->_Data, this, size) : GetFontBaked(size);
+    if (baked == NULL)
+        return;
+    const ImFontGlyph* glyph = is_worker ? ImFontBakedFindGlyphNoLoad(baked, c) : baked->FindGlyph(c);
     if (!glyph || !glyph->Visible)
         return;
     if (glyph->Colored)
@@ -5574,15 +7853,28 @@ void ImFont::RenderChar(ImDrawList* draw_list, float size, const ImVec2& pos, Im
         if (y1 >= y2)
             return;
     }
+    const bool is_sdf = (Flags & ImFontFlags_SDF) != 0;
+    if (draw_list->_SdfActive != is_sdf)
+        draw_list->_SetSdfRenderState(is_sdf);
+    if (glyph->TexPage != 0)
+    {
+        draw_list->_CmdHeader.TexRef = ImFontGetPageTexRef(this, draw_list, glyph->TexPage);
+        draw_list->_OnChangedTexture();
+    }
     draw_list->PrimReserve(6, 4);
     draw_list->PrimRectUV(ImVec2(x1, y1), ImVec2(x2, y2), ImVec2(u1, v1), ImVec2(u2, v2), col);
+    if (glyph->TexPage != 0)
+    {
+        draw_list->_CmdHeader.TexRef = draw_list->_TextureStack.back();
+        draw_list->_OnChangedTexture();
+    }
 }
 
 // Note: as with every ImDrawList drawing function, this expects that the font atlas texture is bound.
+// With ImFontAtlasFlags_MultiPage, glyphs stored on other pages temporarily bind their page texture.
 void ImFont::RenderText(ImDrawList* draw_list, float size, const ImVec2& pos, ImU32 col, const ImVec4& clip_rect, const char* text_begin, const char* text_end, float wrap_width, bool cpu_fine_clip)
 {
     // Align to be pixel perfect
-begin:
     float x = IM_TRUNC(pos.x);
     float y = IM_TRUNC(pos.y);
     if (y > clip_rect.w)
@@ -5592,11 +7884,15 @@ begin:
         text_end = text_begin + ImStrlen(text_begin); // ImGui:: functions generally already provides a valid text_end, so this is merely to handle direct calls.
 
     const float line_height = size;
-    ImFontBaked* baked = GetFontBaked(size);
+    const bool is_worker = draw_list->_Data->IsWorkerCopy; // See ImGui::SetupWorkerDrawListSharedData()
+    ImFontBaked* baked = is_worker ? ImDrawListSharedDataFindWorkerFontBaked(draw_list->_Data, this, size) : GetFontBaked(size);
+    if (baked == NULL)
+        return;
 
     const float scale = size / baked->Size;
     const float origin_x = x;
     const bool word_wrap_enabled = (wrap_width > 0.0f);
+    IM_ASSERT((!word_wrap_enabled || !is_worker) && "Word-wrapping is not supported on worker draw lists.");
 
     // Fast-forward to first visible line
     const char* s = text_begin;
@@ -5636,6 +7932,27 @@ begin:
     if (s == text_end)
         return;
 
+    // Signed distance field glyphs need the backend to switch render state, which is kept until a different primitive needs it.
+    const bool is_sdf = (Flags & ImFontFlags_SDF) != 0;
+    if (draw_list->_SdfActive != is_sdf)
+        draw_list->_SetSdfRenderState(is_sdf);
+
+    const ImU32 col_untinted = col | ~IM_COL32_A_MASK;
+    const char* word_wrap_eol = NULL;
+    const char* ascii_run_end;
+    int tex_page = 0;
+
+    // Output is emitted in segments of glyphs sharing the same texture page. Without ImFontAtlasFlags_MultiPage there is a single segment.
+    const char* segment_s;
+    const char* segment_word_wrap_eol;
+    float segment_x, segment_y;
+begin_segment:
+    segment_s = s;
+    segment_word_wrap_eol = word_wrap_eol;
+    segment_x = x;
+    segment_y = y;
+    ascii_run_end = NULL;
+
     // Reserve vertices for remaining worse case (over-reserving is useful and easily amortized)
     const int vtx_count_max = (int)(text_end - s) * 4;
     const int idx_count_max = (int)(text_end - s) * 6;
@@ -5645,9 +7962,7 @@ begin:
     ImDrawIdx*   idx_write = draw_list->_IdxWritePtr;
     unsigned int vtx_index = draw_list->_VtxCurrentIdx;
     const int cmd_count = draw_list->CmdBuffer.Size;
-
-    const ImU32 col_untinted = col | ~IM_COL32_A_MASK;
-    const char* word_wrap_eol = NULL;
+    bool tex_page_changed = false;
 
     while (s < text_end)
     {
@@ -5670,29 +7985,43 @@ begin:
         }
 
         // Decode and advance source
+        // Runs of printable ASCII characters skip decoding and control characters checks, and look up loaded glyphs directly.
+        const char* s_char = s;
         unsigned int c = (unsigned int)*s;
-        if (c < 0x80)
+        const ImFontGlyph* glyph = NULL;
+        if (s >= ascii_run_end && c >= 0x20 && c < 0x80)
+            ascii_run_end = ImTextFindPrintableAsciiEnd(s, word_wrap_enabled ? word_wrap_eol : text_end);
+        if (s < ascii_run_end)
+        {
             s += 1;
+            const int glyph_idx = (c < (unsigned int)baked->IndexLookup.Size) ? (int)baked->IndexLookup.Data[c] : IM_FONTGLYPH_INDEX_UNUSED;
+            if (glyph_idx != IM_FONTGLYPH_INDEX_UNUSED && glyph_idx != IM_FONTGLYPH_INDEX_NOT_FOUND)
+                glyph = &baked->Glyphs.Data[glyph_idx];
+        }
         else
-            s += ImTextCharFromUtf8(&c, s, text_end);
-
-        if (c < 32)
         {
-            if (c == '\n')
+            if (c < 0x80)
+                s += 1;
+            else
+                s += ImTextCharFromUtf8(&c, s, text_end);
+
+            if (c < 32)
             {
-                x = origin_x;
-                y += line_height;
-                if (y > clip_rect.w)
-                    break; // break out of main loop
-                continue;
+                if (c == '\n')
+                {
+                    x = origin_x;
+                    y += line_height;
+                    if (y > clip_rect.w)
+                        break; // break out of main loop
+                    continue;
+                }
+                if (c == '\r')
+                    continue;
             }
-            if (c == '\r')
-                continue;
         }
 
-        const ImFontGlyph* glyph = baked->FindGlyph((ImWchar)c);
-        //if (glyph == NULL)
-        //    continue;
+        if (glyph == NULL)
+            glyph = is_worker ? ImFontBakedFindGlyphNoLoad(baked, c) : baked->FindGlyph((ImWchar)c);
 
         float char_width = glyph->AdvanceX * scale;
         if (glyph->Visible)
@@ -5704,6 +8033,15 @@ begin:
             float y2 = y + glyph->Y1 * scale;
             if (x1 <= clip_rect.z && x2 >= clip_rect.x)
             {
+                // Glyph is on another texture page: close current segment and start a new one from this character.
+                if (glyph->TexPage != (unsigned int)tex_page)
+                {
+                    s = s_char;
+                    tex_page = glyph->TexPage;
+                    tex_page_changed = true;
+                    break;
+                }
+
                 // Render a character
                 float u1 = glyph->U0;
                 float v1 = glyph->V0;
@@ -5745,10 +8083,10 @@ begin:
 
                 // We are NOT calling PrimRectUV() here because non-inlined causes too much overhead in a debug builds. Inlined here:
                 {
-                    vtx_write[0].pos.x = x1; vtx_write[0].pos.y = y1; vtx_write[0].col = glyph_col; vtx_write[0].uv.x = u1; vtx_write[0].uv.y = v1;
-                    vtx_write[1].pos.x = x2; vtx_write[1].pos.y = y1; vtx_write[1].col = glyph_col; vtx_write[1].uv.x = u2; vtx_write[1].uv.y = v1;
-                    vtx_write[2].pos.x = x2; vtx_write[2].pos.y = y2; vtx_write[2].col = glyph_col; vtx_write[2].uv.x = u2; vtx_write[2].uv.y = v2;
-                    vtx_write[3].pos.x = x1; vtx_write[3].pos.y = y2; vtx_write[3].col = glyph_col; vtx_write[3].uv.x = u1; vtx_write[3].uv.y = v2;
+                    draw_list->SetVtx(&vtx_write[0], ImVec2(x1, y1), ImVec2(u1, v1), glyph_col);
+                    draw_list->SetVtx(&vtx_write[1], ImVec2(x2, y1), ImVec2(u2, v1), glyph_col);
+                    draw_list->SetVtx(&vtx_write[2], ImVec2(x2, y2), ImVec2(u2, v2), glyph_col);
+                    draw_list->SetVtx(&vtx_write[3], ImVec2(x1, y2), ImVec2(u1, v2), glyph_col);
                     idx_write[0] = (ImDrawIdx)(vtx_index); idx_write[1] = (ImDrawIdx)(vtx_index + 1); idx_write[2] = (ImDrawIdx)(vtx_index + 2);
                     idx_write[3] = (ImDrawIdx)(vtx_index); idx_write[4] = (ImDrawIdx)(vtx_index + 2); idx_write[5] = (ImDrawIdx)(vtx_index + 3);
                     vtx_write += 4;
@@ -5761,6 +8099,7 @@ begin:
     }
 
     // Edge case: calling RenderText() with unloaded glyphs triggering texture change. It doesn't happen via ImGui:: calls because CalcTextSize() is always used.
+    // (previous segments were emitted with their own texture and are kept, only the current segment is restarted)
     if (cmd_count != draw_list->CmdBuffer.Size) //-V547
     {
         IM_ASSERT(draw_list->CmdBuffer[draw_list->CmdBuffer.Size - 1].ElemCount == 0);
@@ -5769,9 +8108,11 @@ begin:
         draw_list->AddDrawCmd();
         //IMGUI_DEBUG_LOG("RenderText: cancel and retry to missing glyphs.\n"); // [DEBUG]
         //draw_list->AddRectFilled(pos, pos + ImVec2(10, 10), IM_COL32(255, 0, 0, 255)); // [DEBUG]
-        goto begin;
-        //RenderText(draw_list, size, pos, col, clip_rect, text_begin, text_end, wrap_width, cpu_fine_clip); // FIXME-OPT: Would a 'goto begin' be better for code-gen?
-        //return;
+        s = segment_s;
+        word_wrap_eol = segment_word_wrap_eol;
+        x = segment_x;
+        y = segment_y;
+        goto begin_segment;
     }
 
     // Give back unused vertices (clipped ones, blanks) ~ this is essentially a PrimUnreserve() action.
@@ -5781,6 +8122,19 @@ begin:
     draw_list->_VtxWritePtr = vtx_write;
     draw_list->_IdxWritePtr = idx_write;
     draw_list->_VtxCurrentIdx = vtx_index;
+
+    // Bind texture page for next segment, or restore atlas texture when done.
+    if (tex_page_changed)
+    {
+        draw_list->_CmdHeader.TexRef = ImFontGetPageTexRef(this, draw_list, tex_page);
+        draw_list->_OnChangedTexture();
+        goto begin_segment;
+    }
+    if (tex_page != 0)
+    {
+        draw_list->_CmdHeader.TexRef = draw_list->_TextureStack.back();
+        draw_list->_OnChangedTexture();
+    }
 }
 
 //-----------------------------------------------------------------------------
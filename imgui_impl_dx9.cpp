@@ -6,6 +6,9 @@
 //  [X] Renderer: Large meshes support (64k+ vertices) even with 16-bit indices (ImGuiBackendFlags_RendererHasVtxOffset).
 //  [X] Renderer: Texture updates support for dynamic font atlas (ImGuiBackendFlags_RendererHasTextures).
 //  [X] Renderer: IMGUI_USE_BGRA_PACKED_COLOR support, as this is the optimal color encoding for DirectX9.
+//  [X] Renderer: Native vertex layout support (vertices are copied with memcpy() when ImDrawVert matches our vertex format, see imconfig.h).
+//  [X] Renderer: Ring buffer uploads with D3DLOCK_NOOVERWRITE. Draw lists which didn't change since last frame are not uploaded again.
+//  [X] Renderer: Adaptive index size. With 32-bit ImDrawIdx, draw lists with less than 64K vertices are uploaded with 16-bit indices (narrowed on the CPU while copying).
 
 // You can use unmodified imgui_impl_* files in your project. See examples/ folder for examples of using this.
 // Prefer including the entire imgui/ repository into your project (either as a copy or as a submodule), and only build the backends you need.
@@ -17,6 +20,10 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2026-10-18: DirectX9: Support for IMGUI_USE_PACKED_DRAWVERT (vertices are decoded while copying, as fixed-function pipeline needs float positions).
+//  2026-10-18: DirectX9: With 32-bit ImDrawIdx, upload indices of draw lists that don't need 32-bit as 16-bit (ImDrawList::CalcIdxSize(), indices are narrowed while copying), using a separate index buffer.
+//  2026-10-18: DirectX9: Vertex/index buffers are used as ring buffers (D3DLOCK_NOOVERWRITE, D3DLOCK_DISCARD on wrap) and grow geometrically. Unchanged draw lists are not uploaded again. State block is created once and reused.
+//  2026-10-18: DirectX9: Copy vertex buffers with a single memcpy() when imconfig.h sets up ImDrawVert to match our vertex format and IMGUI_USE_BGRA_PACKED_COLOR.
 //  2025-06-11: DirectX9: Added support for ImGuiBackendFlags_RendererHasTextures, for dynamic font atlas.
 //  2024-10-07: DirectX9: Changed default texture sampler to Clamp instead of Repeat/Wrap.
 //  2024-02-12: DirectX9: Using RGBA format when supported by the driver to avoid CPU side conversion. (#6575)
@@ -52,17 +59,39 @@
 #pragma clang diagnostic ignored "-Wsign-conversion"        // warning: implicit conversion changes signedness
 #endif
 
+// Location of a draw list contents in our vertex/index buffers
+struct ImGui_ImplDX9_DrawListUpload
+{
+    const ImDrawList*           DrawList;
+    ImU64                       Hash;                   // Hash of vertex and index buffers contents
+    int                         VtxCount;
+    int                         IdxCount;
+    int                         IdxSize;                // 2: indices are in pIB, 4: indices are in pIB32
+    int                         VtxStart;               // Position in pVB, -1 if needs uploading
+    int                         IdxStart;               // Position in pIB or pIB32
+    int                         BufferGeneration;       // Value of BufferGeneration when uploaded
+};
+
 // DirectX data
 struct ImGui_ImplDX9_Data
 {
     LPDIRECT3DDEVICE9           pd3dDevice;
     LPDIRECT3DVERTEXBUFFER9     pVB;
-    LPDIRECT3DINDEXBUFFER9      pIB;
+    LPDIRECT3DINDEXBUFFER9      pIB;                    // 16-bit indices
+    LPDIRECT3DINDEXBUFFER9      pIB32;                  // 32-bit indices, only created when using 32-bit ImDrawIdx and a draw list has more than 64K vertices
+    LPDIRECT3DSTATEBLOCK9       pStateBlock;
     int                         VertexBufferSize;
     int                         IndexBufferSize;
+    int                         IndexBuffer32Size;
+    int                         VertexBufferPos;        // Ring buffer write position in pVB. Data before it may be used by draw lists uploaded on previous frames.
+    int                         IndexBufferPos;         // Ring buffer write position in pIB
+    int                         IndexBuffer32Pos;       // Ring buffer write position in pIB32
+    int                         BufferGeneration;       // Incremented every time buffers contents are discarded
     bool                        HasRgbaSupport;
+    ImVector<ImGui_ImplDX9_DrawListUpload> Uploads;     // Draw lists rendered this frame and their location in our buffers
+    ImVector<ImGui_ImplDX9_DrawListUpload> UploadsPrev;
 
-    ImGui_ImplDX9_Data()        { memset((void*)this, 0, sizeof(*this)); VertexBufferSize = 5000; IndexBufferSize = 10000; }
+    ImGui_ImplDX9_Data()        { memset((void*)this, 0, sizeof(*this)); VertexBufferSize = 5000; IndexBufferSize = IndexBuffer32Size = 10000; }
 };
 
 struct CUSTOMVERTEX
@@ -79,6 +108,13 @@ struct CUSTOMVERTEX
 #define IMGUI_COL_TO_DX9_ARGB(_COL)     (((_COL) & 0xFF00FF00) | (((_COL) & 0xFF0000) >> 16) | (((_COL) & 0xFF) << 16))
 #endif
 
+// Vertices can be copied as-is when ImDrawVert has the same layout as CUSTOMVERTEX, with BGRA colors and 'z' cleared by ImDrawList (see imconfig.h)
+#if defined(IMGUI_USE_BGRA_PACKED_COLOR) && defined(IMGUI_OVERRIDE_DRAWVERT_STRUCT_INIT)
+static const bool ImGui_ImplDX9_HasNativeVertexLayout = sizeof(ImDrawVert) == sizeof(CUSTOMVERTEX) && offsetof(ImDrawVert, pos) == offsetof(CUSTOMVERTEX, pos) && offsetof(ImDrawVert, col) == offsetof(CUSTOMVERTEX, col) && offsetof(ImDrawVert, uv) == offsetof(CUSTOMVERTEX, uv);
+#else
+static const bool ImGui_ImplDX9_HasNativeVertexLayout = false;
+#endif
+
 // Backend data stored in io.BackendRendererUserData to allow support for multiple Dear ImGui contexts
 // It is STRONGLY preferred that you use docking branch with multi-viewports (== single Dear ImGui context + multiple windows) instead of multiple Dear ImGui contexts.
 static ImGui_ImplDX9_Data* ImGui_ImplDX9_GetBackendData()
@@ -160,6 +196,38 @@ static void ImGui_ImplDX9_SetupRenderState(ImDrawData* draw_data)
     }
 }
 
+// Hash draw list contents to detect lists that didn't change since last frame. Reading is much cheaper than writing to a dynamic buffer.
+// With IMGUI_USE_PACKED_DRAWVERT, positions are relative to VtxPosOrigin, which is part of the key: e.g. a child window moved along with its parent has same vertices but a different origin.
+static ImU64 ImGui_ImplDX9_HashDrawList(const ImDrawList* draw_list)
+{
+    ImU64 h = 0xCBF29CE484222325ULL ^ ((ImU64)draw_list->VtxBuffer.Size << 32) ^ (ImU64)draw_list->IdxBuffer.Size;
+#ifdef IMGUI_USE_PACKED_DRAWVERT
+    {
+        ImU64 origin;
+        memcpy(&origin, &draw_list->VtxPosOrigin, sizeof(origin));
+        h = (h ^ origin) * 0x100000001B3ULL;
+        h ^= h >> 29;
+    }
+#endif
+    const void* buffers[2] = { draw_list->VtxBuffer.Data, draw_list->IdxBuffer.Data };
+    const int sizes[2] = { draw_list->VtxBuffer.size_in_bytes(), draw_list->IdxBuffer.size_in_bytes() };
+    for (int buffer_n = 0; buffer_n < 2; buffer_n++)
+    {
+        const unsigned char* p = (const unsigned char*)buffers[buffer_n];
+        const unsigned char* p_end = p + sizes[buffer_n];
+        for (; p + 8 <= p_end; p += 8)
+        {
+            ImU64 v;
+            memcpy(&v, p, 8);
+            h = (h ^ v) * 0x100000001B3ULL;
+            h ^= h >> 29;
+        }
+        for (; p < p_end; p++)
+            h = (h ^ *p) * 0x100000001B3ULL;
+    }
+    return h;
+}
+
 // Render function.
 void ImGui_ImplDX9_RenderDrawData(ImDrawData* draw_data)
 {
@@ -177,31 +245,47 @@ void ImGui_ImplDX9_RenderDrawData(ImDrawData* draw_data)
             if (tex->Status != ImTextureStatus_OK)
                 ImGui_ImplDX9_UpdateTexture(tex);
 
-    // Create and grow buffers if needed
-    if (!bd->pVB || bd->VertexBufferSize < draw_data->TotalVtxCount)
+    // Create and grow buffers if needed (contents are lost)
+    // We grow geometrically and keep room for at least two frames, so unchanged draw lists can stay in the ring buffers for a while.
+    if (!bd->pVB || bd->VertexBufferSize < draw_data->TotalVtxCount * 2)
     {
         if (bd->pVB) { bd->pVB->Release(); bd->pVB = nullptr; }
-        bd->VertexBufferSize = draw_data->TotalVtxCount + 5000;
+        while (bd->VertexBufferSize < draw_data->TotalVtxCount * 2)
+            bd->VertexBufferSize *= 2;
         if (device->CreateVertexBuffer(bd->VertexBufferSize * sizeof(CUSTOMVERTEX), D3DUSAGE_DYNAMIC | D3DUSAGE_WRITEONLY, D3DFVF_CUSTOMVERTEX, D3DPOOL_DEFAULT, &bd->pVB, nullptr) < 0)
             return;
+        bd->VertexBufferPos = bd->VertexBufferSize; // Contents are lost: force discard and upload of all draw lists
+        bd->BufferGeneration++;
     }
-    if (!bd->pIB || bd->IndexBufferSize < draw_data->TotalIdxCount)
+    const int idx16_count = draw_data->TotalIdxCount - draw_data->TotalIdx32Count;
+    const int idx32_count = draw_data->TotalIdx32Count;
+    if (!bd->pIB || bd->IndexBufferSize < idx16_count * 2)
     {
         if (bd->pIB) { bd->pIB->Release(); bd->pIB = nullptr; }
-        bd->IndexBufferSize = draw_data->TotalIdxCount + 10000;
-        if (device->CreateIndexBuffer(bd->IndexBufferSize * sizeof(ImDrawIdx), D3DUSAGE_DYNAMIC | D3DUSAGE_WRITEONLY, sizeof(ImDrawIdx) == 2 ? D3DFMT_INDEX16 : D3DFMT_INDEX32, D3DPOOL_DEFAULT, &bd->pIB, nullptr) < 0)
+        while (bd->IndexBufferSize < idx16_count * 2)
+            bd->IndexBufferSize *= 2;
+        if (device->CreateIndexBuffer(bd->IndexBufferSize * sizeof(ImU16), D3DUSAGE_DYNAMIC | D3DUSAGE_WRITEONLY, D3DFMT_INDEX16, D3DPOOL_DEFAULT, &bd->pIB, nullptr) < 0)
+            return;
+        bd->IndexBufferPos = bd->IndexBufferSize; // Contents are lost: force discard and upload of all draw lists
+        bd->BufferGeneration++;
+    }
+    if (idx32_count > 0 && (!bd->pIB32 || bd->IndexBuffer32Size < idx32_count * 2))
+    {
+        if (bd->pIB32) { bd->pIB32->Release(); bd->pIB32 = nullptr; }
+        while (bd->IndexBuffer32Size < idx32_count * 2)
+            bd->IndexBuffer32Size *= 2;
+        if (device->CreateIndexBuffer(bd->IndexBuffer32Size * sizeof(ImU32), D3DUSAGE_DYNAMIC | D3DUSAGE_WRITEONLY, D3DFMT_INDEX32, D3DPOOL_DEFAULT, &bd->pIB32, nullptr) < 0)
             return;
+        bd->IndexBuffer32Pos = bd->IndexBuffer32Size; // Contents are lost: force discard and upload of all draw lists
+        bd->BufferGeneration++;
     }
 
-    // Backup the DX9 state
-    IDirect3DStateBlock9* state_block = nullptr;
-    if (device->CreateStateBlock(D3DSBT_ALL, &state_block) < 0)
+    // Backup the DX9 state (state block is created once, then we only capture current state into it)
+    if (!bd->pStateBlock && device->CreateStateBlock(D3DSBT_ALL, &bd->pStateBlock) < 0)
         return;
+    IDirect3DStateBlock9* state_block = bd->pStateBlock;
     if (state_block->Capture() < 0)
-    {
-        state_block->Release();
         return;
-    }
 
     // Backup the DX9 transform (DX9 documentation suggests that it is included in the StateBlock but it doesn't appear to)
     D3DMATRIX last_world, last_view, last_projection;
@@ -209,44 +293,144 @@ void ImGui_ImplDX9_RenderDrawData(ImDrawData* draw_data)
     device->GetTransform(D3DTS_VIEW, &last_view);
     device->GetTransform(D3DTS_PROJECTION, &last_projection);
 
-    // Allocate buffers
-    CUSTOMVERTEX* vtx_dst;
-    ImDrawIdx* idx_dst;
-    if (bd->pVB->Lock(0, (UINT)(draw_data->TotalVtxCount * sizeof(CUSTOMVERTEX)), (void**)&vtx_dst, D3DLOCK_DISCARD) < 0)
+    // Find draw lists which are unchanged since they were uploaded: they are still in our buffers and we can draw them from there.
+    bd->Uploads.swap(bd->UploadsPrev);
+    bd->Uploads.resize(draw_data->CmdListsCount);
+    int upload_vtx_count = 0;
+    int upload_idx16_count = 0;
+    int upload_idx32_count = 0;
+    for (int n = 0; n < draw_data->CmdListsCount; n++)
     {
-        state_block->Release();
-        return;
+        const ImDrawList* draw_list = draw_data->CmdLists[n];
+        ImGui_ImplDX9_DrawListUpload* upload = &bd->Uploads[n];
+        upload->DrawList = draw_list;
+        upload->Hash = ImGui_ImplDX9_HashDrawList(draw_list);
+        upload->VtxCount = draw_list->VtxBuffer.Size;
+        upload->IdxCount = draw_list->IdxBuffer.Size;
+        upload->IdxSize = draw_list->CalcIdxSize();
+        upload->VtxStart = upload->IdxStart = -1;
+        upload->BufferGeneration = bd->BufferGeneration;
+
+        const ImGui_ImplDX9_DrawListUpload* prev = (n < bd->UploadsPrev.Size && bd->UploadsPrev[n].DrawList == draw_list) ? &bd->UploadsPrev[n] : nullptr; // Lists are generally submitted in same order.
+        for (int prev_n = 0; prev == nullptr && prev_n < bd->UploadsPrev.Size; prev_n++)
+            if (bd->UploadsPrev[prev_n].DrawList == draw_list)
+                prev = &bd->UploadsPrev[prev_n];
+        if (prev && prev->VtxStart != -1 && prev->BufferGeneration == bd->BufferGeneration && prev->Hash == upload->Hash && prev->VtxCount == upload->VtxCount && prev->IdxCount == upload->IdxCount)
+        {
+            upload->VtxStart = prev->VtxStart;
+            upload->IdxStart = prev->IdxStart;
+        }
+        else
+        {
+            upload_vtx_count += upload->VtxCount;
+            (upload->IdxSize == 2 ? upload_idx16_count : upload_idx32_count) += upload->IdxCount;
+        }
     }
-    if (bd->pIB->Lock(0, (UINT)(draw_data->TotalIdxCount * sizeof(ImDrawIdx)), (void**)&idx_dst, D3DLOCK_DISCARD) < 0)
+
+    // Allocate from ring buffers. Append with D3DLOCK_NOOVERWRITE, so the GPU may keep reading previous data.
+    // When reaching the end, discard contents and upload everything again from the start.
+    DWORD lock_flags = D3DLOCK_NOOVERWRITE;
+    if (bd->VertexBufferPos + upload_vtx_count > bd->VertexBufferSize || bd->IndexBufferPos + upload_idx16_count > bd->IndexBufferSize || (upload_idx32_count > 0 && bd->IndexBuffer32Pos + upload_idx32_count > bd->IndexBuffer32Size))
     {
-        bd->pVB->Unlock();
-        state_block->Release();
+        lock_flags = D3DLOCK_DISCARD;
+        bd->BufferGeneration++;
+        for (ImGui_ImplDX9_DrawListUpload& upload : bd->Uploads)
+        {
+            upload.VtxStart = upload.IdxStart = -1;
+            upload.BufferGeneration = bd->BufferGeneration;
+        }
+        upload_vtx_count = draw_data->TotalVtxCount;
+        upload_idx16_count = idx16_count;
+        upload_idx32_count = idx32_count;
+
+        // Only rewind buffers which are locked (with D3DLOCK_DISCARD) below. A buffer we don't lock keeps its contents
+        // and the GPU may still be reading them: writing at its start later with D3DLOCK_NOOVERWRITE would be a hazard.
+        if (upload_vtx_count > 0)
+            bd->VertexBufferPos = 0;
+        if (upload_idx16_count > 0)
+            bd->IndexBufferPos = 0;
+        if (upload_idx32_count > 0)
+            bd->IndexBuffer32Pos = 0;
+    }
+    CUSTOMVERTEX* vtx_dst = nullptr;
+    ImU16* idx16_dst = nullptr;
+    ImU32* idx32_dst = nullptr;
+    bool lock_ok = true;
+    if (lock_ok && upload_vtx_count > 0)
+        lock_ok = bd->pVB->Lock((UINT)(bd->VertexBufferPos * sizeof(CUSTOMVERTEX)), (UINT)(upload_vtx_count * sizeof(CUSTOMVERTEX)), (void**)&vtx_dst, lock_flags) >= 0;
+    if (lock_ok && upload_idx16_count > 0)
+        lock_ok = bd->pIB->Lock((UINT)(bd->IndexBufferPos * sizeof(ImU16)), (UINT)(upload_idx16_count * sizeof(ImU16)), (void**)&idx16_dst, lock_flags) >= 0;
+    if (lock_ok && upload_idx32_count > 0)
+        lock_ok = bd->pIB32->Lock((UINT)(bd->IndexBuffer32Pos * sizeof(ImU32)), (UINT)(upload_idx32_count * sizeof(ImU32)), (void**)&idx32_dst, lock_flags) >= 0;
+    if (!lock_ok)
+    {
+        if (vtx_dst) bd->pVB->Unlock();
+        if (idx16_dst) bd->pIB->Unlock();
+        bd->Uploads.resize(0);
         return;
     }
 
     // Copy and convert all vertices into a single contiguous buffer, convert colors to DX9 default format.
-    // FIXME-OPT: This is a minor waste of resource, the ideal is to use imconfig.h and
+    // This is a minor waste of resource, the ideal is to use imconfig.h to make ImDrawList output our native format directly:
     //  1) to avoid repacking colors:   #define IMGUI_USE_BGRA_PACKED_COLOR
     //  2) to avoid repacking vertices: #define IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT struct ImDrawVert { ImVec2 pos; float z; ImU32 col; ImVec2 uv; }
-    for (const ImDrawList* draw_list : draw_data->CmdLists)
+    //                                  #define IMGUI_OVERRIDE_DRAWVERT_STRUCT_INIT(_VTX) (_VTX)->z = 0.0f
+    for (ImGui_ImplDX9_DrawListUpload& upload : bd->Uploads)
     {
-        const ImDrawVert* vtx_src = draw_list->VtxBuffer.Data;
-        for (int i = 0; i < draw_list->VtxBuffer.Size; i++)
+        if (upload.VtxStart != -1)
+            continue;
+        const ImDrawList* draw_list = upload.DrawList;
+        upload.VtxStart = bd->VertexBufferPos;
+        upload.IdxStart = (upload.IdxSize == 2) ? bd->IndexBufferPos : bd->IndexBuffer32Pos;
+        bd->VertexBufferPos += upload.VtxCount;
+        (upload.IdxSize == 2 ? bd->IndexBufferPos : bd->IndexBuffer32Pos) += upload.IdxCount;
+        if (ImGui_ImplDX9_HasNativeVertexLayout)
+        {
+            memcpy(vtx_dst, draw_list->VtxBuffer.Data, draw_list->VtxBuffer.Size * sizeof(CUSTOMVERTEX));
+            vtx_dst += draw_list->VtxBuffer.Size;
+        }
+        else
         {
-            vtx_dst->pos[0] = vtx_src->pos.x;
-            vtx_dst->pos[1] = vtx_src->pos.y;
-            vtx_dst->pos[2] = 0.0f;
-            vtx_dst->col = IMGUI_COL_TO_DX9_ARGB(vtx_src->col);
-            vtx_dst->uv[0] = vtx_src->uv.x;
-            vtx_dst->uv[1] = vtx_src->uv.y;
-            vtx_dst++;
-            vtx_src++;
+            const ImDrawVert* vtx_src = draw_list->VtxBuffer.Data;
+            for (int i = 0; i < draw_list->VtxBuffer.Size; i++)
+            {
+                const ImVec2 pos = draw_list->GetVtxPos(*vtx_src); // Decode (with IMGUI_USE_PACKED_DRAWVERT)
+                const ImVec2 uv = draw_list->GetVtxUV(*vtx_src);
+                vtx_dst->pos[0] = pos.x;
+                vtx_dst->pos[1] = pos.y;
+                vtx_dst->pos[2] = 0.0f;
+                vtx_dst->col = IMGUI_COL_TO_DX9_ARGB(vtx_src->col);
+                vtx_dst->uv[0] = uv.x;
+                vtx_dst->uv[1] = uv.y;
+                vtx_dst++;
+                vtx_src++;
+            }
+        }
+        if (upload.IdxSize == 4)
+        {
+            memcpy(idx32_dst, draw_list->IdxBuffer.Data, draw_list->IdxBuffer.Size * sizeof(ImU32));
+            idx32_dst += draw_list->IdxBuffer.Size;
+        }
+        else if (sizeof(ImDrawIdx) == 2)
+        {
+            memcpy(idx16_dst, draw_list->IdxBuffer.Data, draw_list->IdxBuffer.Size * sizeof(ImU16));
+            idx16_dst += draw_list->IdxBuffer.Size;
+        }
+        else
+        {
+            // 32-bit ImDrawIdx but less than 64K vertices: narrow to 16-bit, halving index data size.
+            // This is a conversion loop, not a memcpy(): only 16-bit ImDrawIdx builds can copy 16-bit lists as-is.
+            const ImDrawIdx* idx_src = draw_list->IdxBuffer.Data;
+            for (int i = 0; i < draw_list->IdxBuffer.Size; i++)
+                *idx16_dst++ = (ImU16)*idx_src++;
         }
-        memcpy(idx_dst, draw_list->IdxBuffer.Data, draw_list->IdxBuffer.Size * sizeof(ImDrawIdx));
-        idx_dst += draw_list->IdxBuffer.Size;
     }
-    bd->pVB->Unlock();
-    bd->pIB->Unlock();
+    if (vtx_dst)
+        bd->pVB->Unlock();
+    if (idx16_dst)
+        bd->pIB->Unlock();
+    if (idx32_dst)
+        bd->pIB32->Unlock();
     device->SetStreamSource(0, bd->pVB, 0, sizeof(CUSTOMVERTEX));
     device->SetIndices(bd->pIB);
     device->SetFVF(D3DFVF_CUSTOMVERTEX);
@@ -255,12 +439,20 @@ void ImGui_ImplDX9_RenderDrawData(ImDrawData* draw_data)
     ImGui_ImplDX9_SetupRenderState(draw_data);
 
     // Render command lists
-    // (Because we merged all buffers into a single one, we maintain our own offset into them)
-    int global_vtx_offset = 0;
-    int global_idx_offset = 0;
+    // (Because all draw lists share our buffers, we use the offset of each list into them)
     ImVec2 clip_off = draw_data->DisplayPos;
-    for (const ImDrawList* draw_list : draw_data->CmdLists)
+    LPDIRECT3DINDEXBUFFER9 current_ib = bd->pIB;
+    for (const ImGui_ImplDX9_DrawListUpload& upload : bd->Uploads)
     {
+        const ImDrawList* draw_list = upload.DrawList;
+        const int global_vtx_offset = upload.VtxStart;
+        const int global_idx_offset = upload.IdxStart;
+        LPDIRECT3DINDEXBUFFER9 ib = (upload.IdxSize == 2) ? bd->pIB : bd->pIB32;
+        if (ib != current_ib)
+        {
+            device->SetIndices(ib);
+            current_ib = ib;
+        }
         for (int cmd_i = 0; cmd_i < draw_list->CmdBuffer.Size; cmd_i++)
         {
             const ImDrawCmd* pcmd = &draw_list->CmdBuffer[cmd_i];
@@ -291,8 +483,6 @@ void ImGui_ImplDX9_RenderDrawData(ImDrawData* draw_data)
                 device->DrawIndexedPrimitive(D3DPT_TRIANGLELIST, pcmd->VtxOffset + global_vtx_offset, 0, (UINT)draw_list->VtxBuffer.Size, pcmd->IdxOffset + global_idx_offset, pcmd->ElemCount / 3);
             }
         }
-        global_idx_offset += draw_list->IdxBuffer.Size;
-        global_vtx_offset += draw_list->VtxBuffer.Size;
     }
 
     // Restore the DX9 transform
@@ -302,7 +492,6 @@ void ImGui_ImplDX9_RenderDrawData(ImDrawData* draw_data)
 
     // Restore the DX9 state
     state_block->Apply();
-    state_block->Release();
 }
 
 static bool ImGui_ImplDX9_CheckFormatSupport(LPDIRECT3DDEVICE9 pDevice, D3DFORMAT format)
@@ -462,6 +651,10 @@ void ImGui_ImplDX9_InvalidateDeviceObjects()
         }
     if (bd->pVB) { bd->pVB->Release(); bd->pVB = nullptr; }
     if (bd->pIB) { bd->pIB->Release(); bd->pIB = nullptr; }
+    if (bd->pIB32) { bd->pIB32->Release(); bd->pIB32 = nullptr; }
+    if (bd->pStateBlock) { bd->pStateBlock->Release(); bd->pStateBlock = nullptr; }
+    bd->Uploads.clear();
+    bd->UploadsPrev.clear();
 }
 
 void ImGui_ImplDX9_NewFrame()
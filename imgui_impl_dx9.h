@@ -6,6 +6,9 @@
 //  [X] Renderer: Large meshes support (64k+ vertices) even with 16-bit indices (ImGuiBackendFlags_RendererHasVtxOffset).
 //  [X] Renderer: Texture updates support for dynamic font atlas (ImGuiBackendFlags_RendererHasTextures).
 //  [X] Renderer: IMGUI_USE_BGRA_PACKED_COLOR support, as this is the optimal color encoding for DirectX9.
+//  [X] Renderer: Native vertex layout support (vertices are copied with memcpy() when ImDrawVert matches our vertex format, see imconfig.h).
+//  [X] Renderer: Ring buffer uploads with D3DLOCK_NOOVERWRITE. Draw lists which didn't change since last frame are not uploaded again.
+//  [X] Renderer: Adaptive index size. With 32-bit ImDrawIdx, draw lists with less than 64K vertices are uploaded with 16-bit indices (narrowed on the CPU while copying).
 
 // You can use unmodified imgui_impl_* files in your project. See examples/ folder for examples of using this.
 // Prefer including the entire imgui/ repository into your project (either as a copy or as a submodule), and only build the backends you need.
@@ -0,0 +1,688 @@
+// dear imgui: Renderer Backend for CPU software rasterization (headless, no graphics API required)
+// This needs to be used along with a Platform Backend, or with no Platform Backend at all for headless/offscreen uses.
+
+// Implemented features:
+//  [X] Renderer: User texture binding. Use 'ImGui_ImplSoft_Texture*' as texture identifier. Read the FAQ about ImTextureID/ImTextureRef!
+//  [X] Renderer: Large meshes support (64k+ vertices) even with 16-bit indices (ImGuiBackendFlags_RendererHasVtxOffset).
+//  [X] Renderer: Texture updates support for dynamic font atlas (ImGuiBackendFlags_RendererHasTextures).
+//  [X] Renderer: Tile-binned rasterization, tiles may be processed in parallel by providing a ParallelFor function.
+//  [X] Renderer: Partial repaint of a set of rectangles (e.g. from ImDrawDataDamageTracker).
+//  [X] Renderer: Packed vertices support (IMGUI_USE_PACKED_DRAWVERT).
+//  [X] Renderer: Signed distance field fonts (ImGuiBackendFlags_RendererHasSdfFonts).
+
+// You can use unmodified imgui_impl_* files in your project. See examples/ folder for examples of using this.
+// Prefer including the entire imgui/ repository into your project (either as a copy or as a submodule), and only build the backends you need.
+// Learn about Dear ImGui:
+// - FAQ                  https://dearimgui.com/faq
+// - Getting Started      https://dearimgui.com/getting-started
+// - Documentation        https://dearimgui.com/docs (same as your local docs/ folder).
+// - Introduction, links and more at the top of imgui.cpp
+
+// CHANGELOG
+//  2026-10-18: Added ImGui_ImplSoft_GetTexUploadStats() to validate io.MetricsTexUploadRects/io.MetricsTexUploadBytes.
+//  2026-10-18: Support for signed distance field fonts (ImFontFlags_SDF) with ImGuiBackendFlags_RendererHasSdfFonts.
+//  2026-10-18: Support for IMGUI_USE_PACKED_DRAWVERT.
+//  2026-10-18: Added ImGui_ImplSoft_RenderDrawDataInRects() to only repaint some rectangles, e.g. from ImDrawDataDamageTracker.
+//  2026-10-18: Initial version: tile binning, SSE2 edge functions, bilinear texture sampling, texture updates.
+
+#include "imgui.h"
+#ifndef IMGUI_DISABLE
+#include "imgui_impl_soft.h"
+#include <math.h>       // floor, floorf, fabsf
+#include <stdint.h>     // intptr_t
+
+// Enable SSE2 intrinsics if available
+#if (defined __SSE2__ || defined __x86_64__ || defined _M_X64 || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))) && !defined(IMGUI_DISABLE_SSE)
+#define IMGUI_IMPL_SOFT_USE_SSE2
+#include <emmintrin.h>
+#endif
+
+// Clang/GCC warnings with -Weverything
+#if defined(__clang__)
+#pragma clang diagnostic ignored "-Wold-style-cast"         // warning: use of old-style cast                            // yes, they are more terse.
+#pragma clang diagnostic ignored "-Wsign-conversion"        // warning: implicit conversion changes signedness
+#pragma clang diagnostic ignored "-Wfloat-equal"            // warning: comparing floating point with == or != is unsafe
+#endif
+
+// Vertices are snapped to a 1/256th of a pixel grid. Edge functions are evaluated in double precision:
+// with snapped coordinates every intermediate value is an integer below 2^53, so evaluation is exact and
+// an edge shared by two triangles always gives opposite values, which guarantees water-tight rasterization.
+#define IMGUI_IMPL_SOFT_SUBPIXEL_BITS   8
+#define IMGUI_IMPL_SOFT_SUBPIXEL_SCALE  256.0
+#define IMGUI_IMPL_SOFT_SUBPIXEL_HALF   128.0
+
+// Triangle setup data
+struct ImGui_ImplSoft_Triangle
+{
+    double                          EdgeA[3], EdgeB[3], EdgeC[3];   // E(px,py) = A*px + B*py + C in subpixel units. Pixel is covered if E >= 0 for all edges (fill rule bias is included in C)
+    float                           Attr[6][3];                     // R,G,B,A (0..255), U,V planes: value(x,y) = [0] + [1]*x + [2]*y with x,y integer pixel coordinates (sampled at center)
+    int                             MinX, MinY, MaxX, MaxY;         // Inclusive pixel bounds, already intersected with clip rectangle and framebuffer
+    const ImGui_ImplSoft_Texture*   Tex;
+    ImU32                           FlatColor;                      // Final color when IsFlat
+    float                           SdfScale;                       // Texture alpha is a signed distance field when IsSdf: coverage = (alpha - onedge) * SdfScale + 0.5
+    bool                            IsFlat;                         // Constant color and UV: we can skip interpolation and texture sampling
+    bool                            IsSdf;                          // Within ImDrawCallback_SetSdfRenderState, with varying UV
+};
+
+// Software renderer data
+struct ImGui_ImplSoft_Data
+{
+    ImVector<ImGui_ImplSoft_Triangle>   Triangles;
+    ImVector<int>                       TileOffsets;            // Index into TileEntries[] for each tile, size is tiles_count+1
+    ImVector<int>                       TileEntries;            // Triangle indices, sorted by tile then by submission order
+    int                                 TileSize;
+    ImGui_ImplSoft_ParallelForFunc      ParallelFor;
+    void*                               ParallelForUserData;
+
+    // Current framebuffer (valid during ImGui_ImplSoft_RenderDrawData() call)
+    ImU32*                              FbPixels;
+    int                                 FbWidth;
+    int                                 FbHeight;
+    int                                 FbPitch;
+    int                                 TilesX;
+    int                                 TilesY;
+    const ImVec4*                       Rects;                  // Rectangles to repaint, or NULL to repaint everything
+    int                                 RectsCount;
+    ImU32                               RectsClearColor;
+
+    // Texture upload stats since last ImGui_ImplSoft_NewFrame()
+    int                                 TexUploadRects;
+    int                                 TexUploadBytes;
+
+    ImGui_ImplSoft_Data()               { memset((void*)this, 0, sizeof(*this)); TileSize = 64; }
+};
+
+// Backend data stored in io.BackendRendererUserData to allow support for multiple Dear ImGui contexts
+// It is STRONGLY preferred that you use docking branch with multi-viewports (== single Dear ImGui context + multiple windows) instead of multiple Dear ImGui contexts.
+static ImGui_ImplSoft_Data* ImGui_ImplSoft_GetBackendData()
+{
+    return ImGui::GetCurrentContext() ? (ImGui_ImplSoft_Data*)ImGui::GetIO().BackendRendererUserData : nullptr;
+}
+
+// Functions
+static inline int   ImGui_ImplSoft_Min(int a, int b)            { return a < b ? a : b; }
+static inline int   ImGui_ImplSoft_Max(int a, int b)            { return a > b ? a : b; }
+static inline float ImGui_ImplSoft_Saturate255(float v)         { return v < 0.0f ? 0.0f : v > 255.0f ? 255.0f : v; }
+static inline double ImGui_ImplSoft_Snap(float v)               { return floor((double)v * IMGUI_IMPL_SOFT_SUBPIXEL_SCALE + 0.5); }
+
+static void ImGui_ImplSoft_SampleTexture(const ImGui_ImplSoft_Texture* tex, float u, float v, float out_rgba[4])
+{
+    if (tex == nullptr || tex->Pixels == nullptr)
+    {
+        out_rgba[0] = out_rgba[1] = out_rgba[2] = out_rgba[3] = 255.0f;
+        return;
+    }
+
+    // Bilinear filtering, clamp addressing, texel centers at half-integer coordinates.
+    const float fx = u * (float)tex->Width - 0.5f;
+    const float fy = v * (float)tex->Height - 0.5f;
+    const float fx0 = floorf(fx);
+    const float fy0 = floorf(fy);
+    const float tx = fx - fx0;
+    const float ty = fy - fy0;
+    const int x0 = ImGui_ImplSoft_Max(0, ImGui_ImplSoft_Min((int)fx0, tex->Width - 1));
+    const int y0 = ImGui_ImplSoft_Max(0, ImGui_ImplSoft_Min((int)fy0, tex->Height - 1));
+    const int x1 = ImGui_ImplSoft_Max(0, ImGui_ImplSoft_Min((int)fx0 + 1, tex->Width - 1));
+    const int y1 = ImGui_ImplSoft_Max(0, ImGui_ImplSoft_Min((int)fy0 + 1, tex->Height - 1));
+    const ImU32 c00 = tex->Pixels[y0 * tex->Width + x0];
+    if (tx == 0.0f && ty == 0.0f)
+    {
+        // Fast path: sampling exactly at a texel center (e.g. pixel-aligned text)
+        out_rgba[0] = (float)((c00 >> IM_COL32_R_SHIFT) & 0xFF);
+        out_rgba[1] = (float)((c00 >> IM_COL32_G_SHIFT) & 0xFF);
+        out_rgba[2] = (float)((c00 >> IM_COL32_B_SHIFT) & 0xFF);
+        out_rgba[3] = (float)((c00 >> IM_COL32_A_SHIFT) & 0xFF);
+        return;
+    }
+    const ImU32 c10 = tex->Pixels[y0 * tex->Width + x1];
+    const ImU32 c01 = tex->Pixels[y1 * tex->Width + x0];
+    const ImU32 c11 = tex->Pixels[y1 * tex->Width + x1];
+    const int shifts[4] = { IM_COL32_R_SHIFT, IM_COL32_G_SHIFT, IM_COL32_B_SHIFT, IM_COL32_A_SHIFT };
+    for (int n = 0; n < 4; n++)
+    {
+        const float v00 = (float)((c00 >> shifts[n]) & 0xFF);
+        const float v10 = (float)((c10 >> shifts[n]) & 0xFF);
+        const float v01 = (float)((c01 >> shifts[n]) & 0xFF);
+        const float v11 = (float)((c11 >> shifts[n]) & 0xFF);
+        const float top = v00 + (v10 - v00) * tx;
+        const float bottom = v01 + (v11 - v01) * tx;
+        out_rgba[n] = top + (bottom - top) * ty;
+    }
+}
+
+// Modulate vertex color with texture color, both in 0..255 range.
+static inline ImU32 ImGui_ImplSoft_ShadeColor(const float col[4], const float tex[4])
+{
+    const ImU32 r = (ImU32)(ImGui_ImplSoft_Saturate255(col[0] * tex[0] * (1.0f / 255.0f)) + 0.5f);
+    const ImU32 g = (ImU32)(ImGui_ImplSoft_Saturate255(col[1] * tex[1] * (1.0f / 255.0f)) + 0.5f);
+    const ImU32 b = (ImU32)(ImGui_ImplSoft_Saturate255(col[2] * tex[2] * (1.0f / 255.0f)) + 0.5f);
+    const ImU32 a = (ImU32)(ImGui_ImplSoft_Saturate255(col[3] * tex[3] * (1.0f / 255.0f)) + 0.5f);
+    return (r << IM_COL32_R_SHIFT) | (g << IM_COL32_G_SHIFT) | (b << IM_COL32_B_SHIFT) | (a << IM_COL32_A_SHIFT);
+}
+
+// Same blending equation as other backends: color = src * src_a + dst * (1 - src_a), alpha = src_a + dst_a * (1 - src_a)
+// Integer arithmetic, rounded: (x * a + 127) / 255 computed exactly with the (x + 1 + (x >> 8)) >> 8 trick.
+static inline ImU32 ImGui_ImplSoft_Blend(ImU32 src, ImU32 dst)
+{
+    const ImU32 sa = (src >> IM_COL32_A_SHIFT) & 0xFF;
+    if (sa == 0xFF)
+        return src;
+    if (sa == 0)
+        return dst;
+    const ImU32 inv_sa = 255 - sa;
+    ImU32 out = 0;
+    const int shifts[3] = { IM_COL32_R_SHIFT, IM_COL32_G_SHIFT, IM_COL32_B_SHIFT };
+    for (int n = 0; n < 3; n++)
+    {
+        const ImU32 s = (src >> shifts[n]) & 0xFF;
+        const ImU32 d = (dst >> shifts[n]) & 0xFF;
+        ImU32 v = s * sa + d * inv_sa + 128;
+        v = (v + (v >> 8)) >> 8;
+        out |= v << shifts[n];
+    }
+    ImU32 da = (dst >> IM_COL32_A_SHIFT) & 0xFF;
+    ImU32 a = da * inv_sa + 128;
+    a = sa + ((a + (a >> 8)) >> 8);
+    out |= (a > 255 ? 255 : a) << IM_COL32_A_SHIFT;
+    return out;
+}
+
+// Return a 4-bit mask of covered pixels for pixels (x..x+3, y)
+static inline int ImGui_ImplSoft_CoverageMask4(const ImGui_ImplSoft_Triangle* tri, int x, int y)
+{
+    const double py = y * IMGUI_IMPL_SOFT_SUBPIXEL_SCALE + IMGUI_IMPL_SOFT_SUBPIXEL_HALF;
+#ifdef IMGUI_IMPL_SOFT_USE_SSE2
+    const __m128d px01 = _mm_set_pd((x + 1) * IMGUI_IMPL_SOFT_SUBPIXEL_SCALE + IMGUI_IMPL_SOFT_SUBPIXEL_HALF, x * IMGUI_IMPL_SOFT_SUBPIXEL_SCALE + IMGUI_IMPL_SOFT_SUBPIXEL_HALF);
+    const __m128d px23 = _mm_add_pd(px01, _mm_set1_pd(2.0 * IMGUI_IMPL_SOFT_SUBPIXEL_SCALE));
+    const __m128d zero = _mm_setzero_pd();
+    __m128d m01 = _mm_cmpeq_pd(zero, zero);
+    __m128d m23 = m01;
+    for (int e = 0; e < 3; e++)
+    {
+        const __m128d a = _mm_set1_pd(tri->EdgeA[e]);
+        const __m128d row = _mm_set1_pd(tri->EdgeB[e] * py + tri->EdgeC[e]);
+        m01 = _mm_and_pd(m01, _mm_cmpge_pd(_mm_add_pd(_mm_mul_pd(a, px01), row), zero));
+        m23 = _mm_and_pd(m23, _mm_cmpge_pd(_mm_add_pd(_mm_mul_pd(a, px23), row), zero));
+    }
+    return _mm_movemask_pd(m01) | (_mm_movemask_pd(m23) << 2);
+#else
+    int mask = 0;
+    for (int n = 0; n < 4; n++)
+    {
+        const double px = (x + n) * IMGUI_IMPL_SOFT_SUBPIXEL_SCALE + IMGUI_IMPL_SOFT_SUBPIXEL_HALF;
+        bool inside = true;
+        for (int e = 0; e < 3 && inside; e++)
+            inside = (tri->EdgeA[e] * px + (tri->EdgeB[e] * py + tri->EdgeC[e])) >= 0.0;
+        if (inside)
+            mask |= 1 << n;
+    }
+    return mask;
+#endif
+}
+
+static void ImGui_ImplSoft_RasterizeTriangleInRect(const ImGui_ImplSoft_Triangle* tri, ImU32* fb_pixels, int fb_pitch, int rect_min_x, int rect_min_y, int rect_max_x, int rect_max_y)
+{
+    const int min_x = ImGui_ImplSoft_Max(tri->MinX, rect_min_x);
+    const int min_y = ImGui_ImplSoft_Max(tri->MinY, rect_min_y);
+    const int max_x = ImGui_ImplSoft_Min(tri->MaxX, rect_max_x);
+    const int max_y = ImGui_ImplSoft_Min(tri->MaxY, rect_max_y);
+    if (min_x > max_x || min_y > max_y)
+        return;
+
+    const int min_x_aligned = min_x & ~3;
+    for (int y = min_y; y <= max_y; y++)
+    {
+        ImU32* row = fb_pixels + y * fb_pitch;
+        for (int x4 = min_x_aligned; x4 <= max_x; x4 += 4)
+        {
+            int mask = ImGui_ImplSoft_CoverageMask4(tri, x4, y);
+            if (mask == 0)
+                continue;
+            for (int n = 0; n < 4; n++)
+            {
+                const int x = x4 + n;
+                if (!(mask & (1 << n)) || x < min_x || x > max_x)
+                    continue;
+                ImU32 src;
+                if (tri->IsFlat)
+                {
+                    src = tri->FlatColor;
+                }
+                else
+                {
+                    float col[4], tex[4];
+                    for (int attr_n = 0; attr_n < 4; attr_n++)
+                        col[attr_n] = tri->Attr[attr_n][0] + tri->Attr[attr_n][1] * (float)x + tri->Attr[attr_n][2] * (float)y;
+                    const float u = tri->Attr[4][0] + tri->Attr[4][1] * (float)x + tri->Attr[4][2] * (float)y;
+                    const float v = tri->Attr[5][0] + tri->Attr[5][1] * (float)x + tri->Attr[5][2] * (float)y;
+                    ImGui_ImplSoft_SampleTexture(tri->Tex, u, v, tex);
+                    if (tri->IsSdf)
+                        tex[3] = ImGui_ImplSoft_Saturate255(((tex[3] - IM_FONT_SDF_ONEDGE_VALUE) * tri->SdfScale + 0.5f) * 255.0f);
+                    src = ImGui_ImplSoft_ShadeColor(col, tex);
+                }
+                row[x] = ImGui_ImplSoft_Blend(src, row[x]);
+            }
+        }
+    }
+}
+
+// Setup a triangle. Positions are in framebuffer pixel coordinates. Return false if the triangle is culled.
+static bool ImGui_ImplSoft_SetupTriangle(ImGui_ImplSoft_Triangle* tri, const ImVec2 pos_in[3], const ImVec2 uv_in[3], const ImU32 col_in[3], const ImGui_ImplSoft_Texture* tex, bool sdf, int clip_min_x, int clip_min_y, int clip_max_x, int clip_max_y)
+{
+    double sx[3], sy[3];
+    for (int n = 0; n < 3; n++)
+    {
+        sx[n] = ImGui_ImplSoft_Snap(pos_in[n].x);
+        sy[n] = ImGui_ImplSoft_Snap(pos_in[n].y);
+    }
+
+    // Enforce positive area (Dear ImGui doesn't guarantee a winding order)
+    double area = (sx[1] - sx[0]) * (sy[2] - sy[0]) - (sy[1] - sy[0]) * (sx[2] - sx[0]);
+    if (area == 0.0)
+        return false;
+    int order[3] = { 0, 1, 2 };
+    if (area < 0.0)
+    {
+        order[1] = 2;
+        order[2] = 1;
+        area = -area;
+    }
+    double x[3], y[3];
+    ImVec2 uv[3];
+    ImU32 cols[3];
+    for (int n = 0; n < 3; n++)
+    {
+        x[n] = sx[order[n]];
+        y[n] = sy[order[n]];
+        uv[n] = uv_in[order[n]];
+        cols[n] = col_in[order[n]];
+    }
+
+    // Pixel bounds: pixel centers in [min, max]
+    double bb_min_x = x[0], bb_max_x = x[0], bb_min_y = y[0], bb_max_y = y[0];
+    for (int n = 1; n < 3; n++)
+    {
+        bb_min_x = x[n] < bb_min_x ? x[n] : bb_min_x; bb_max_x = x[n] > bb_max_x ? x[n] : bb_max_x;
+        bb_min_y = y[n] < bb_min_y ? y[n] : bb_min_y; bb_max_y = y[n] > bb_max_y ? y[n] : bb_max_y;
+    }
+    const double px_min_x = ceil((bb_min_x - IMGUI_IMPL_SOFT_SUBPIXEL_HALF) / IMGUI_IMPL_SOFT_SUBPIXEL_SCALE);
+    const double px_min_y = ceil((bb_min_y - IMGUI_IMPL_SOFT_SUBPIXEL_HALF) / IMGUI_IMPL_SOFT_SUBPIXEL_SCALE);
+    const double px_max_x = floor((bb_max_x - IMGUI_IMPL_SOFT_SUBPIXEL_HALF) / IMGUI_IMPL_SOFT_SUBPIXEL_SCALE);
+    const double px_max_y = floor((bb_max_y - IMGUI_IMPL_SOFT_SUBPIXEL_HALF) / IMGUI_IMPL_SOFT_SUBPIXEL_SCALE);
+    if (px_max_x < clip_min_x || px_max_y < clip_min_y || px_min_x > clip_max_x || px_min_y > clip_max_y)
+        return false;
+    tri->MinX = ImGui_ImplSoft_Max((int)px_min_x, clip_min_x);
+    tri->MinY = ImGui_ImplSoft_Max((int)px_min_y, clip_min_y);
+    tri->MaxX = ImGui_ImplSoft_Min((int)px_max_x, clip_max_x);
+    tri->MaxY = ImGui_ImplSoft_Min((int)px_max_y, clip_max_y);
+    if (tri->MinX > tri->MaxX || tri->MinY > tri->MaxY)
+        return false;
+
+    // Edge functions for edges (1,2), (2,0), (0,1). Edge n is opposite to vertex n.
+    // Fill rule: pixels exactly on an edge are only included for one of the two orientations of that edge.
+    for (int n = 0; n < 3; n++)
+    {
+        const int a = (n + 1) % 3;
+        const int b = (n + 2) % 3;
+        const double edge_a = -(y[b] - y[a]);
+        const double edge_b = (x[b] - x[a]);
+        const bool top_left = (edge_a > 0.0) || (edge_a == 0.0 && edge_b < 0.0);
+        tri->EdgeA[n] = edge_a;
+        tri->EdgeB[n] = edge_b;
+        tri->EdgeC[n] = -(edge_a * x[a] + edge_b * y[a]) - (top_left ? 0.0 : 1.0);
+    }
+
+    // Attribute planes
+    float attr_values[6][3];
+    for (int n = 0; n < 3; n++)
+    {
+        const ImU32 col = cols[n];
+        attr_values[0][n] = (float)((col >> IM_COL32_R_SHIFT) & 0xFF);
+        attr_values[1][n] = (float)((col >> IM_COL32_G_SHIFT) & 0xFF);
+        attr_values[2][n] = (float)((col >> IM_COL32_B_SHIFT) & 0xFF);
+        attr_values[3][n] = (float)((col >> IM_COL32_A_SHIFT) & 0xFF);
+        attr_values[4][n] = uv[n].x;
+        attr_values[5][n] = uv[n].y;
+    }
+    tri->IsFlat = (cols[0] == cols[1] && cols[0] == cols[2] && uv[0].x == uv[1].x && uv[0].x == uv[2].x && uv[0].y == uv[1].y && uv[0].y == uv[2].y);
+    tri->Tex = tex;
+    tri->IsSdf = false;
+    if (tri->IsFlat)
+    {
+        float col[4], tex_col[4];
+        for (int n = 0; n < 4; n++)
+            col[n] = attr_values[n][0];
+        ImGui_ImplSoft_SampleTexture(tex, uv[0].x, uv[0].y, tex_col);
+        tri->FlatColor = ImGui_ImplSoft_ShadeColor(col, tex_col);
+        return true;
+    }
+    const double dx1 = x[1] - x[0], dy1 = y[1] - y[0];
+    const double dx2 = x[2] - x[0], dy2 = y[2] - y[0];
+    for (int attr_n = 0; attr_n < 6; attr_n++)
+    {
+        const double d1 = (double)attr_values[attr_n][1] - attr_values[attr_n][0];
+        const double d2 = (double)attr_values[attr_n][2] - attr_values[attr_n][0];
+        const double grad_x = (d1 * dy2 - d2 * dy1) / area; // Per subpixel unit
+        const double grad_y = (d2 * dx1 - d1 * dx2) / area;
+        tri->Attr[attr_n][0] = (float)(attr_values[attr_n][0] + grad_x * (IMGUI_IMPL_SOFT_SUBPIXEL_HALF - x[0]) + grad_y * (IMGUI_IMPL_SOFT_SUBPIXEL_HALF - y[0]));
+        tri->Attr[attr_n][1] = (float)(grad_x * IMGUI_IMPL_SOFT_SUBPIXEL_SCALE);
+        tri->Attr[attr_n][2] = (float)(grad_y * IMGUI_IMPL_SOFT_SUBPIXEL_SCALE);
+    }
+
+    // Signed distance field: convert distance in texels to distance in pixels, using the number of texels per pixel.
+    // (same as fwidth(uv * texture_size) in a pixel shader, constant over the triangle as UV are interpolated linearly)
+    if (sdf && tex != nullptr)
+    {
+        const float texels_per_pixel_x = fabsf(tri->Attr[4][1] * tex->Width) + fabsf(tri->Attr[4][2] * tex->Width);
+        const float texels_per_pixel_y = fabsf(tri->Attr[5][1] * tex->Height) + fabsf(tri->Attr[5][2] * tex->Height);
+        const float texels_per_pixel = texels_per_pixel_x > texels_per_pixel_y ? texels_per_pixel_x : texels_per_pixel_y;
+        if (texels_per_pixel > 1.0f / 65536.0f) // Constant UV (e.g. white pixel with color gradient): regular sampling
+        {
+            tri->IsSdf = true;
+            tri->SdfScale = 1.0f / (IM_FONT_SDF_PIXEL_DIST_SCALE * texels_per_pixel);
+        }
+    }
+    return true;
+}
+
+static void ImGui_ImplSoft_RasterizeTile(int tile_index, void* job_data)
+{
+    ImGui_ImplSoft_Data* bd = (ImGui_ImplSoft_Data*)job_data;
+    const int tile_x = (tile_index % bd->TilesX) * bd->TileSize;
+    const int tile_y = (tile_index / bd->TilesX) * bd->TileSize;
+    const int tile_max_x = ImGui_ImplSoft_Min(tile_x + bd->TileSize, bd->FbWidth) - 1;
+    const int tile_max_y = ImGui_ImplSoft_Min(tile_y + bd->TileSize, bd->FbHeight) - 1;
+    if (bd->Rects == nullptr)
+    {
+        for (int entry_n = bd->TileOffsets[tile_index]; entry_n < bd->TileOffsets[tile_index + 1]; entry_n++)
+            ImGui_ImplSoft_RasterizeTriangleInRect(&bd->Triangles[bd->TileEntries[entry_n]], bd->FbPixels, bd->FbPitch, tile_x, tile_y, tile_max_x, tile_max_y);
+        return;
+    }
+
+    // Clear and repaint the parts of this tile covered by rectangles. Rectangles don't overlap so each pixel is processed once.
+    for (int rect_n = 0; rect_n < bd->RectsCount; rect_n++)
+    {
+        const ImVec4& rect = bd->Rects[rect_n];
+        const int min_x = ImGui_ImplSoft_Max(tile_x, (int)rect.x);
+        const int min_y = ImGui_ImplSoft_Max(tile_y, (int)rect.y);
+        const int max_x = ImGui_ImplSoft_Min(tile_max_x, (int)rect.z - 1);
+        const int max_y = ImGui_ImplSoft_Min(tile_max_y, (int)rect.w - 1);
+        if (min_x > max_x || min_y > max_y)
+            continue;
+        for (int y = min_y; y <= max_y; y++)
+            for (int x = min_x; x <= max_x; x++)
+                bd->FbPixels[y * bd->FbPitch + x] = bd->RectsClearColor;
+        for (int entry_n = bd->TileOffsets[tile_index]; entry_n < bd->TileOffsets[tile_index + 1]; entry_n++)
+            ImGui_ImplSoft_RasterizeTriangleInRect(&bd->Triangles[bd->TileEntries[entry_n]], bd->FbPixels, bd->FbPitch, min_x, min_y, max_x, max_y);
+    }
+}
+
+static bool ImGui_ImplSoft_TriangleOverlapsRects(const ImGui_ImplSoft_Triangle* tri, const ImVec4* rects, int rects_count)
+{
+    for (int rect_n = 0; rect_n < rects_count; rect_n++)
+        if (tri->MinX < (int)rects[rect_n].z && tri->MaxX >= (int)rects[rect_n].x && tri->MinY < (int)rects[rect_n].w && tri->MaxY >= (int)rects[rect_n].y)
+            return true;
+    return false;
+}
+
+// Render function.
+void ImGui_ImplSoft_RenderDrawData(ImDrawData* draw_data, ImU32* fb_pixels, int fb_width, int fb_height, int fb_pitch)
+{
+    ImGui_ImplSoft_RenderDrawDataInRects(draw_data, fb_pixels, fb_width, fb_height, fb_pitch, nullptr, 0, 0);
+}
+
+void ImGui_ImplSoft_RenderDrawDataInRects(ImDrawData* draw_data, ImU32* fb_pixels, int fb_width, int fb_height, int fb_pitch, const ImVec4* rects, int rects_count, ImU32 clear_col)
+{
+    if (fb_width <= 0 || fb_height <= 0 || draw_data->DisplaySize.x <= 0.0f || draw_data->DisplaySize.y <= 0.0f)
+        return;
+
+    ImGui_ImplSoft_Data* bd = ImGui_ImplSoft_GetBackendData();
+
+    // Catch up with texture updates. Most of the times, the list will have 1 element with an OK status, aka nothing to do.
+    // (This almost always points to ImGui::GetPlatformIO().Textures[] but is part of ImDrawData to allow overriding or disabling texture updates).
+    if (draw_data->Textures != nullptr)
+        for (ImTextureData* tex : *draw_data->Textures)
+            if (tex->Status != ImTextureStatus_OK)
+                ImGui_ImplSoft_UpdateTexture(tex);
+
+    bd->FbPixels = fb_pixels;
+    bd->FbWidth = fb_width;
+    bd->FbHeight = fb_height;
+    bd->FbPitch = (fb_pitch > 0) ? fb_pitch : fb_width;
+    bd->TilesX = (fb_width + bd->TileSize - 1) / bd->TileSize;
+    bd->TilesY = (fb_height + bd->TileSize - 1) / bd->TileSize;
+    bd->Rects = rects;
+    bd->RectsCount = rects_count;
+    bd->RectsClearColor = clear_col;
+    const int tiles_count = bd->TilesX * bd->TilesY;
+    if (rects != nullptr && rects_count == 0)
+        return;
+
+    // Setup triangles in submission order
+    // (User callbacks are called immediately in submission order. Our only render state is signed distance field sampling, which lasts until ImDrawCallback_ResetRenderState or the end of the list)
+    bd->Triangles.resize(0);
+    const ImVec2 clip_off = draw_data->DisplayPos;
+    const ImVec2 clip_scale = draw_data->FramebufferScale;
+    for (ImDrawList* draw_list : draw_data->CmdLists)
+    {
+        const ImDrawVert* vtx_buffer = draw_list->VtxBuffer.Data;
+        const ImDrawIdx* idx_buffer = draw_list->IdxBuffer.Data;
+        bool sdf = false;
+        for (int cmd_i = 0; cmd_i < draw_list->CmdBuffer.Size; cmd_i++)
+        {
+            const ImDrawCmd* pcmd = &draw_list->CmdBuffer[cmd_i];
+            if (pcmd->UserCallback != nullptr)
+            {
+                // User callback, registered via ImDrawList::AddCallback()
+                // (ImDrawCallback_ResetRenderState is a special callback value used by the user to request the renderer to reset render state.)
+                // (ImDrawCallback_SetSdfRenderState is a special callback value emitted when rendering text with a ImFontFlags_SDF font.)
+                if (pcmd->UserCallback == ImDrawCallback_ResetRenderState)
+                    sdf = false;
+                else if (pcmd->UserCallback == ImDrawCallback_SetSdfRenderState)
+                    sdf = true;
+                else
+                    pcmd->UserCallback(draw_list, pcmd);
+                continue;
+            }
+
+            // Project scissor/clipping rectangles into framebuffer space, convert to inclusive pixel bounds
+            ImVec2 clip_min((pcmd->ClipRect.x - clip_off.x) * clip_scale.x, (pcmd->ClipRect.y - clip_off.y) * clip_scale.y);
+            ImVec2 clip_max((pcmd->ClipRect.z - clip_off.x) * clip_scale.x, (pcmd->ClipRect.w - clip_off.y) * clip_scale.y);
+            const int clip_min_x = ImGui_ImplSoft_Max((int)clip_min.x, 0);
+            const int clip_min_y = ImGui_ImplSoft_Max((int)clip_min.y, 0);
+            const int clip_max_x = ImGui_ImplSoft_Min((int)clip_max.x, fb_width) - 1;
+            const int clip_max_y = ImGui_ImplSoft_Min((int)clip_max.y, fb_height) - 1;
+            if (clip_max_x < clip_min_x || clip_max_y < clip_min_y)
+                continue;
+
+            const ImGui_ImplSoft_Texture* tex = (const ImGui_ImplSoft_Texture*)(intptr_t)pcmd->GetTexID();
+            for (unsigned int elem_n = 0; elem_n + 2 < pcmd->ElemCount; elem_n += 3)
+            {
+                ImVec2 pos[3], uv[3];
+                ImU32 col[3];
+                for (int n = 0; n < 3; n++)
+                {
+                    const ImDrawVert& vtx = vtx_buffer[pcmd->VtxOffset + idx_buffer[pcmd->IdxOffset + elem_n + n]];
+                    const ImVec2 vtx_pos = draw_list->GetVtxPos(vtx); // Decode (with IMGUI_USE_PACKED_DRAWVERT)
+                    pos[n] = ImVec2((vtx_pos.x - clip_off.x) * clip_scale.x, (vtx_pos.y - clip_off.y) * clip_scale.y);
+                    uv[n] = draw_list->GetVtxUV(vtx);
+                    col[n] = vtx.col;
+                }
+                bd->Triangles.resize(bd->Triangles.Size + 1);
+                if (!ImGui_ImplSoft_SetupTriangle(&bd->Triangles.back(), pos, uv, col, tex, sdf, clip_min_x, clip_min_y, clip_max_x, clip_max_y))
+                    bd->Triangles.pop_back();
+                else if (rects != nullptr && !ImGui_ImplSoft_TriangleOverlapsRects(&bd->Triangles.back(), rects, rects_count))
+                    bd->Triangles.pop_back();
+            }
+        }
+    }
+
+    // Bin triangles into tiles: count, prefix sum, then fill. Each tile keeps triangles in submission order.
+    bd->TileOffsets.resize(tiles_count + 1);
+    memset(bd->TileOffsets.Data, 0, (size_t)bd->TileOffsets.size_in_bytes());
+    for (const ImGui_ImplSoft_Triangle& tri : bd->Triangles)
+        for (int ty = tri.MinY / bd->TileSize; ty <= tri.MaxY / bd->TileSize; ty++)
+            for (int tx = tri.MinX / bd->TileSize; tx <= tri.MaxX / bd->TileSize; tx++)
+                bd->TileOffsets[ty * bd->TilesX + tx + 1]++;
+    for (int tile_n = 0; tile_n < tiles_count; tile_n++)
+        bd->TileOffsets[tile_n + 1] += bd->TileOffsets[tile_n];
+    bd->TileEntries.resize(bd->TileOffsets[tiles_count]);
+    {
+        ImVector<int> write_offsets;
+        write_offsets.resize(tiles_count);
+        memcpy(write_offsets.Data, bd->TileOffsets.Data, (size_t)write_offsets.size_in_bytes());
+        for (int tri_n = 0; tri_n < bd->Triangles.Size; tri_n++)
+        {
+            const ImGui_ImplSoft_Triangle& tri = bd->Triangles[tri_n];
+            for (int ty = tri.MinY / bd->TileSize; ty <= tri.MaxY / bd->TileSize; ty++)
+                for (int tx = tri.MinX / bd->TileSize; tx <= tri.MaxX / bd->TileSize; tx++)
+                    bd->TileEntries[write_offsets[ty * bd->TilesX + tx]++] = tri_n;
+        }
+    }
+
+    // Rasterize tiles. Tiles don't overlap so they can be processed in any order and in parallel.
+    if (bd->ParallelFor != nullptr)
+        bd->ParallelFor(tiles_count, ImGui_ImplSoft_RasterizeTile, bd, bd->ParallelForUserData);
+    else
+        for (int tile_n = 0; tile_n < tiles_count; tile_n++)
+            ImGui_ImplSoft_RasterizeTile(tile_n, bd);
+
+    bd->FbPixels = nullptr;
+    bd->Rects = nullptr;
+}
+
+bool ImGui_ImplSoft_Init()
+{
+    ImGuiIO& io = ImGui::GetIO();
+    IMGUI_CHECKVERSION();
+    IM_ASSERT(io.BackendRendererUserData == nullptr && "Already initialized a renderer backend!");
+
+    // Setup backend capabilities flags
+    ImGui_ImplSoft_Data* bd = IM_NEW(ImGui_ImplSoft_Data)();
+    io.BackendRendererUserData = (void*)bd;
+    io.BackendRendererName = "imgui_impl_soft";
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;  // We can honor the ImDrawCmd::VtxOffset field, allowing for large meshes.
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasTextures;   // We can honor ImGuiPlatformIO::Textures[] requests during render.
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasSdfFonts;   // We can honor ImDrawCallback_SetSdfRenderState, allowing for ImFontFlags_SDF fonts.
+
+    ImGuiPlatformIO& platform_io = ImGui::GetPlatformIO();
+    platform_io.Renderer_TextureMaxWidth = platform_io.Renderer_TextureMaxHeight = 8192;
+
+    return true;
+}
+
+void ImGui_ImplSoft_Shutdown()
+{
+    ImGui_ImplSoft_Data* bd = ImGui_ImplSoft_GetBackendData();
+    IM_ASSERT(bd != nullptr && "No renderer backend to shutdown, or already shutdown?");
+    ImGuiIO& io = ImGui::GetIO();
+
+    // Destroy all textures
+    for (ImTextureData* tex : ImGui::GetPlatformIO().Textures)
+        if (tex->RefCount == 1)
+        {
+            tex->SetStatus(ImTextureStatus_WantDestroy);
+            ImGui_ImplSoft_UpdateTexture(tex);
+        }
+    io.BackendRendererName = nullptr;
+    io.BackendRendererUserData = nullptr;
+    io.BackendFlags &= ~(ImGuiBackendFlags_RendererHasVtxOffset | ImGuiBackendFlags_RendererHasTextures | ImGuiBackendFlags_RendererHasSdfFonts);
+    IM_DELETE(bd);
+}
+
+void ImGui_ImplSoft_NewFrame()
+{
+    ImGui_ImplSoft_Data* bd = ImGui_ImplSoft_GetBackendData();
+    IM_ASSERT(bd != nullptr && "Context or backend not initialized! Did you call ImGui_ImplSoft_Init()?");
+    bd->TexUploadRects = bd->TexUploadBytes = 0;
+}
+
+void ImGui_ImplSoft_GetTexUploadStats(int* out_rects, int* out_bytes)
+{
+    ImGui_ImplSoft_Data* bd = ImGui_ImplSoft_GetBackendData();
+    *out_rects = bd->TexUploadRects;
+    *out_bytes = bd->TexUploadBytes;
+}
+
+void ImGui_ImplSoft_SetParallelFor(ImGui_ImplSoft_ParallelForFunc func, void* user_data)
+{
+    ImGui_ImplSoft_Data* bd = ImGui_ImplSoft_GetBackendData();
+    bd->ParallelFor = func;
+    bd->ParallelForUserData = user_data;
+}
+
+void ImGui_ImplSoft_SetTileSize(int tile_size)
+{
+    ImGui_ImplSoft_Data* bd = ImGui_ImplSoft_GetBackendData();
+    IM_ASSERT(tile_size >= 4 && (tile_size & 3) == 0);
+    bd->TileSize = tile_size;
+}
+
+// Copy a block into our RGBA storage, expanding Alpha8 to white + alpha.
+static void ImGui_ImplSoft_CopyTextureRegion(ImTextureData* tex, ImGui_ImplSoft_Texture* dst_tex, int x, int y, int w, int h)
+{
+    for (int yy = y; yy < y + h; yy++)
+    {
+        ImU32* dst = dst_tex->Pixels + yy * dst_tex->Width + x;
+        if (tex->Format == ImTextureFormat_RGBA32)
+        {
+            memcpy(dst, tex->GetPixelsAt(x, yy), (size_t)w * 4);
+        }
+        else
+        {
+            const unsigned char* src = (const unsigned char*)tex->GetPixelsAt(x, yy);
+            for (int xx = 0; xx < w; xx++)
+                dst[xx] = IM_COL32(255, 255, 255, src[xx]);
+        }
+    }
+}
+
+void ImGui_ImplSoft_UpdateTexture(ImTextureData* tex)
+{
+    if (tex->Status == ImTextureStatus_WantCreate)
+    {
+        // Create and upload new texture
+        IM_ASSERT(tex->TexID == ImTextureID_Invalid && tex->BackendUserData == nullptr);
+        ImGui_ImplSoft_Texture* backend_tex = IM_NEW(ImGui_ImplSoft_Texture)();
+        backend_tex->Width = tex->Width;
+        backend_tex->Height = tex->Height;
+        backend_tex->Pixels = (ImU32*)IM_ALLOC((size_t)tex->Width * tex->Height * 4);
+        ImGui_ImplSoft_CopyTextureRegion(tex, backend_tex, 0, 0, tex->Width, tex->Height);
+        ImGui_ImplSoft_Data* bd = ImGui_ImplSoft_GetBackendData();
+        bd->TexUploadRects++;
+        bd->TexUploadBytes += tex->GetSizeInBytes();
+
+        // Store identifiers
+        tex->SetTexID((ImTextureID)(intptr_t)backend_tex);
+        tex->SetStatus(ImTextureStatus_OK);
+    }
+    else if (tex->Status == ImTextureStatus_WantUpdates)
+    {
+        // Update selected blocks. We only ever write to textures regions which have never been used before!
+        ImGui_ImplSoft_Data* bd = ImGui_ImplSoft_GetBackendData();
+        ImGui_ImplSoft_Texture* backend_tex = (ImGui_ImplSoft_Texture*)(intptr_t)tex->TexID;
+        for (ImTextureRect& r : tex->Updates)
+        {
+            ImGui_ImplSoft_CopyTextureRegion(tex, backend_tex, r.x, r.y, r.w, r.h);
+            bd->TexUploadRects++;
+            bd->TexUploadBytes += r.w * r.h * tex->BytesPerPixel;
+        }
+        tex->SetStatus(ImTextureStatus_OK);
+    }
+    else if (tex->Status == ImTextureStatus_WantDestroy)
+    {
+        ImGui_ImplSoft_Texture* backend_tex = (ImGui_ImplSoft_Texture*)(intptr_t)tex->TexID;
+        if (backend_tex == nullptr)
+            return;
+        IM_FREE(backend_tex->Pixels);
+        IM_DELETE(backend_tex);
+
+        // Clear identifiers and mark as destroyed (in order to allow e.g. calling InvalidateDeviceObjects while running)
+        tex->SetTexID(ImTextureID_Invalid);
+        tex->SetStatus(ImTextureStatus_Destroyed);
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+#endif // #ifndef IMGUI_DISABLE
@@ -0,0 +1,62 @@
+// dear imgui: Renderer Backend for CPU software rasterization (headless, no graphics API required)
+// This needs to be used along with a Platform Backend, or with no Platform Backend at all for headless/offscreen uses.
+
+// Implemented features:
+//  [X] Renderer: User texture binding. Use 'ImGui_ImplSoft_Texture*' as texture identifier. Read the FAQ about ImTextureID/ImTextureRef!
+//  [X] Renderer: Large meshes support (64k+ vertices) even with 16-bit indices (ImGuiBackendFlags_RendererHasVtxOffset).
+//  [X] Renderer: Texture updates support for dynamic font atlas (ImGuiBackendFlags_RendererHasTextures).
+//  [X] Renderer: Tile-binned rasterization, tiles may be processed in parallel by providing a ParallelFor function.
+//  [X] Renderer: Partial repaint of a set of rectangles (e.g. from ImDrawDataDamageTracker).
+//  [X] Renderer: Packed vertices support (IMGUI_USE_PACKED_DRAWVERT).
+//  [X] Renderer: Signed distance field fonts (ImGuiBackendFlags_RendererHasSdfFonts).
+
+// Output is a RGBA framebuffer using the same packing as IM_COL32() (honoring IMGUI_USE_BGRA_PACKED_COLOR).
+// Output is deterministic: it doesn't depend on tile size, number of threads or order of execution of tiles.
+// - Vertices are snapped to 1/256th of a pixel, coverage is evaluated at pixel centers with a top-left fill rule.
+// - Textures are sampled with bilinear filtering and clamping, matching the sampler state used by our DirectX9 backend.
+// - Blending matches our other backends: color = src * src_a + dst * (1 - src_a), alpha = src_a + dst_a * (1 - src_a).
+
+// You can use unmodified imgui_impl_* files in your project. See examples/ folder for examples of using this.
+// Prefer including the entire imgui/ repository into your project (either as a copy or as a submodule), and only build the backends you need.
+// Learn about Dear ImGui:
+// - FAQ                  https://dearimgui.com/faq
+// - Getting Started      https://dearimgui.com/getting-started
+// - Documentation        https://dearimgui.com/docs (same as your local docs/ folder).
+// - Introduction, links and more at the top of imgui.cpp
+
+#pragma once
+#include "imgui.h"      // IMGUI_IMPL_API
+#ifndef IMGUI_DISABLE
+
+// Texture storage used by this backend. ImTextureID values passed to ImGui::Image() are expected to point to one of those.
+// Pixels are RGBA using the same packing as IM_COL32().
+struct ImGui_ImplSoft_Texture
+{
+    int         Width;
+    int         Height;
+    ImU32*      Pixels;
+};
+
+// Optional: run 'jobs_count' independent jobs, possibly in parallel, and return once they are all done.
+// Each job writes to a separate region of the framebuffer. Default implementation runs them serially on the calling thread.
+typedef void (*ImGui_ImplSoft_JobFunc)(int job_index, void* job_data);
+typedef void (*ImGui_ImplSoft_ParallelForFunc)(int jobs_count, ImGui_ImplSoft_JobFunc job_func, void* job_data, void* user_data);
+
+// Follow "Getting Started" link and check examples/ folder to learn about using backends!
+IMGUI_IMPL_API bool     ImGui_ImplSoft_Init();
+IMGUI_IMPL_API void     ImGui_ImplSoft_Shutdown();
+IMGUI_IMPL_API void     ImGui_ImplSoft_NewFrame();
+IMGUI_IMPL_API void     ImGui_ImplSoft_RenderDrawData(ImDrawData* draw_data, ImU32* fb_pixels, int fb_width, int fb_height, int fb_pitch); // fb_pitch in pixels, 0 == fb_width
+IMGUI_IMPL_API void     ImGui_ImplSoft_RenderDrawDataInRects(ImDrawData* draw_data, ImU32* fb_pixels, int fb_width, int fb_height, int fb_pitch, const ImVec4* rects, int rects_count, ImU32 clear_col); // Clear to 'clear_col' and repaint only non-overlapping rectangles (x1,y1,x2,y2 in pixels) e.g. ImDrawDataDamageTracker::DamageRects[]. Other pixels are left untouched.
+
+// Configuration (optional)
+IMGUI_IMPL_API void     ImGui_ImplSoft_SetParallelFor(ImGui_ImplSoft_ParallelForFunc func, void* user_data);
+IMGUI_IMPL_API void     ImGui_ImplSoft_SetTileSize(int tile_size);                          // Default to 64. Must be a multiple of 4.
+
+// (Advanced) Use e.g. if you need to precisely control the timing of texture updates (e.g. for staged rendering), by setting ImDrawData::Textures = NULL to handle this manually.
+IMGUI_IMPL_API void     ImGui_ImplSoft_UpdateTexture(ImTextureData* tex);
+
+// (Advanced) Texture rectangles and bytes (in source ImTextureData format) uploaded since last ImGui_ImplSoft_NewFrame(). Should match io.MetricsTexUploadRects/io.MetricsTexUploadBytes.
+IMGUI_IMPL_API void     ImGui_ImplSoft_GetTexUploadStats(int* out_rects, int* out_bytes);
+
+#endif // #ifndef IMGUI_DISABLE
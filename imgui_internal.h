@@ -58,11 +58,17 @@ Index of this file:
 #include <stdlib.h>     // NULL, malloc, free, qsort, atoi, atof
 #include <math.h>       // sqrtf, fabsf, fmodf, powf, floorf, ceilf, cosf, sinf
 #include <limits.h>     // INT_MIN, INT_MAX
+#ifdef _MSC_VER
+#include <intrin.h>     // _BitScanForward
+#endif
 
 // Enable SSE intrinsics if available
 #if (defined __SSE__ || defined __x86_64__ || defined _M_X64 || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))) && !defined(IMGUI_DISABLE_SSE)
 #define IMGUI_ENABLE_SSE
 #include <immintrin.h>
+#if (defined __SSE2__ || defined __x86_64__ || defined _M_X64 || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+#define IMGUI_ENABLE_SSE2
+#endif
 #if (defined __AVX__ || defined __SSE4_2__)
 #define IMGUI_ENABLE_SSE4_2
 #include <nmmintrin.h>
@@ -137,11 +143,16 @@ Index of this file:
 struct ImBitVector;                 // Store 1-bit per value
 struct ImRect;                      // An axis-aligned rectangle (2 points)
 struct ImGuiTextIndex;              // Maintain a line index for a text buffer.
+struct ImGuiTextViewer;             // Storage for TextViewer()
 
 // ImDrawList/ImFontAtlas
 struct ImDrawDataBuilder;           // Helper to build a ImDrawData instance
 struct ImDrawListSharedData;        // Data shared between all ImDrawList instances
 struct ImFontAtlasBuilder;          // Internal storage for incrementally packing and building a ImFontAtlas
+struct ImFontAtlasGlyphCache;       // Persistent cache of baked glyphs
+struct ImFontAtlasGlyphJob;         // Deferred glyph rasterization job
+struct ImFontAtlasGlyphJobScratch;  // Temporary memory given to a glyph rasterization job
+struct ImFontAtlasPage;             // Texture page of a font atlas, with its own packing state
 struct ImFontAtlasPostProcessData;  // Data available to potential texture post-processing functions
 struct ImFontAtlasRectEntry;        // Packed rectangle lookup entry
 
@@ -173,6 +184,7 @@ struct ImGuiStyleMod;               // Stacked style modifier, backup of modifie
 struct ImGuiStyleVarInfo;           // Style variable information (e.g. to access style variables from an enum)
 struct ImGuiTabBar;                 // Storage for a tab bar
 struct ImGuiTabItem;                // Storage for a tab item (within a tab bar)
+struct ImGuiTextLayout;             // Cached size and line breaks of a wrapped text
 struct ImGuiTable;                  // Storage for a table
 struct ImGuiTableHeaderData;        // Storage for TableAngledHeadersRow()
 struct ImGuiTableColumn;            // Storage for one column of a table
@@ -380,6 +392,13 @@ inline bool             ImIsPowerOfTwo(int v)               { return v != 0 && (
 inline bool             ImIsPowerOfTwo(ImU64 v)             { return v != 0 && (v & (v - 1)) == 0; }
 inline int              ImUpperPowerOfTwo(int v)            { v--; v |= v >> 1; v |= v >> 2; v |= v >> 4; v |= v >> 8; v |= v >> 16; v++; return v; }
 inline unsigned int     ImCountSetBits(unsigned int v)      { unsigned int count = 0; while (v > 0) { v = v & (v - 1); count++; } return count; }
+#if defined(_MSC_VER) && !defined(__clang__)
+inline unsigned int     ImCountTrailingZeros(unsigned int v){ unsigned long index; _BitScanForward(&index, v); return (unsigned int)index; } // v must not be 0
+#elif defined(__GNUC__) || defined(__clang__)
+inline unsigned int     ImCountTrailingZeros(unsigned int v){ return (unsigned int)__builtin_ctz(v); }                                     // v must not be 0
+#else
+inline unsigned int     ImCountTrailingZeros(unsigned int v){ unsigned int count = 0; while ((v & 1) == 0) { v >>= 1; count++; } return count; } // v must not be 0
+#endif
 
 // Helpers: String
 #define ImStrlen strlen
@@ -426,6 +445,7 @@ IMGUI_API int           ImTextCountUtf8BytesFromChar(const char* in_text, const
 IMGUI_API int           ImTextCountUtf8BytesFromStr(const ImWchar* in_text, const ImWchar* in_text_end);                        // return number of bytes to express string in UTF-8
 IMGUI_API const char*   ImTextFindPreviousUtf8Codepoint(const char* in_text_start, const char* in_text_curr);                   // return previous UTF-8 code-point.
 IMGUI_API int           ImTextCountLines(const char* in_text, const char* in_text_end);                                         // return number of lines taken by text. trailing carriage return doesn't count as an extra line.
+IMGUI_API const char*   ImTextFindPrintableAsciiEnd(const char* in_text, const char* in_text_end);                              // return end of run of 0x20..0x7F characters (no control characters, no multi-byte sequences). in_text_end may be NULL for zero-terminated text.
 
 // Helpers: File System
 #ifdef IMGUI_DISABLE_FILE_FUNCTIONS
@@ -449,6 +469,45 @@ IMGUI_API ImU64             ImFileWrite(const void* data, ImU64 size, ImU64 coun
 #endif
 IMGUI_API void*             ImFileLoadToMemory(const char* filename, const char* mode, size_t* out_file_size = NULL, int padding_bytes = 0);
 
+// Helpers: File Mapping
+// - Read-only view of a whole file without copying it (mmap() / MapViewOfFile()), e.g. to browse very large logs.
+// - Data is NOT zero-terminated, and is NULL when the file is empty. Data/Size are only modified by ImFileMapUpdate()/ImFileMapClose().
+// - Call ImFileMapUpdate() to follow a file which is being appended to. When it returns ImFileMapUpdateResult_Truncated, the mapping
+//   was released: drop every pointer into previous Data (e.g. call viewer->Clear()), then call ImFileMapUpdate() again to map the new contents.
+// - POSIX: the file is mapped with MAP_SHARED. If another process truncates it, reading mapped pages past the new end raises SIGBUS
+//   until ImFileMapUpdate() notices the shrink. Only use this on files which are appended to (e.g. logs), not rewritten in place.
+//   Windows: truncating a file while it is mapped fails, so the writer gets an error instead.
+// - With IMGUI_DISABLE_DEFAULT_FILE_MAPPING_FUNCTIONS (or IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS) this falls back to ImFileLoadToMemory().
+struct ImFileMapping
+{
+    const char*                 Data;               // File contents
+    ImU64                       Size;               // File size in bytes
+    char*                       Filename;           // Owned copy, used to reopen/reload
+    ImS64                       PlatformFile;       // Windows: file HANDLE. POSIX: file descriptor. -1 if none.
+    void*                       PlatformMapping;    // Windows: file mapping HANDLE. Fallback: IM_ALLOC()-ed copy of the file.
+
+    ImFileMapping()             { memset(this, 0, sizeof(*this)); PlatformFile = -1; }
+};
+enum ImFileMapUpdateResult
+{
+    ImFileMapUpdateResult_Unchanged,    // File size didn't change (or couldn't be read)
+    ImFileMapUpdateResult_Grown,        // Data/Size changed and previous contents are preserved, e.g. call viewer->SetText(map->Data, (int)map->Size)
+    ImFileMapUpdateResult_Truncated,    // File shrunk (or couldn't be remapped): mapping was released, Data == NULL and Size == 0. Clear users of previous Data then call ImFileMapUpdate() again.
+};
+#ifdef IMGUI_DISABLE_FILE_FUNCTIONS
+inline bool                 ImFileMapOpen(ImFileMapping*, const char*)              { return false; }
+inline ImFileMapUpdateResult ImFileMapUpdate(ImFileMapping*)                        { return ImFileMapUpdateResult_Unchanged; }
+inline void                 ImFileMapClose(ImFileMapping*)                          { }
+#else
+IMGUI_API bool              ImFileMapOpen(ImFileMapping* map, const char* filename);// Return false if the file can't be opened or mapped.
+IMGUI_API ImFileMapUpdateResult ImFileMapUpdate(ImFileMapping* map);                // Remap if the file grew, release mapping if it shrunk. See ImFileMapUpdateResult.
+IMGUI_API void              ImFileMapClose(ImFileMapping* map);
+#endif
+
+// Helpers: Time
+// - High resolution monotonic clock, only used to report timings in the Metrics/Debugger window. Returns 0.0 with IMGUI_DISABLE_DEFAULT_TIME_FUNCTIONS.
+IMGUI_API double            ImTimeGetSeconds();
+
 // Helpers: Maths
 IM_MSVC_RUNTIME_CHECKS_OFF
 // - Wrapper for standard libs functions. (Note that imgui_demo.cpp does _not_ use them to keep the code easy to copy)
@@ -752,6 +811,7 @@ struct ImPool
     void        Remove(ImGuiID key, const T* p)     { Remove(key, GetIndex(p)); }
     void        Remove(ImGuiID key, ImPoolIdx idx)  { Buf[idx].~T(); *(int*)&Buf[idx] = FreeIdx; FreeIdx = idx; Map.SetInt(key, -1); AliveCount--; }
     void        Reserve(int capacity)               { Buf.reserve(capacity); Map.Data.reserve(capacity); }
+    void        CompactMap()                        { int dst_n = 0; for (int n = 0; n < Map.Data.Size; n++) if (Map.Data[n].val_i != -1) Map.Data[dst_n++] = Map.Data[n]; Map.Data.resize(dst_n); } // Remove keys of removed items, useful when keys are not reused.
 
     // To iterate a ImPool: for (int n = 0; n < pool.GetMapSize(); n++) if (T* t = pool.TryGetMapData(n)) { ... }
     // Can be avoided if you know .Remove() has never been called on the pool, or AliveCount == GetMapSize()
@@ -798,6 +858,27 @@ struct ImGuiTextIndex
     void            append(const char* base, int old_size, int new_size);
 };
 
+// Helper: State for ImGui::TextViewer(), which displays a large read-only text buffer (e.g. a log file mapped with ImFileMapOpen()).
+// - The line index is built incrementally: at most IndexBytesPerFrame bytes are scanned per frame, so the first frame can be displayed immediately.
+// - Text may grow between frames (e.g. after ImFileMapUpdate() on a log being written to): only new bytes are indexed. If it shrinks the index is rebuilt.
+//   A truncated mapped file doesn't keep previous contents: call Clear() when ImFileMapUpdate() returns ImFileMapUpdateResult_Truncated.
+// - Line offsets are stored as int: text is limited to 2 GB.
+struct ImGuiTextViewer
+{
+    const char*     Text = NULL;                            // Text buffer, doesn't need to be zero-terminated. Pointer may change between frames as long as previous contents are preserved.
+    int             TextSize = 0;
+    ImGuiTextIndex  Index;                                  // Line index for [0, Index.EndOffset)
+    int             IndexBytesPerFrame = 32 * 1024 * 1024;  // Max number of bytes to index every frame
+    bool            AutoScroll = true;                      // Keep scrolling to the last line when text grows and we are already at the bottom
+    bool            VirtualScroll = false;                  // [Internal] Total height too large for accurate float scrolling: FirstLine is the scroll position, the window scrollbar only reflects it.
+    double          FirstLine = 0.0;                        // [Internal] Fractional first visible line when VirtualScroll is set
+    float           LastScrollY = 0.0f;                     // [Internal] Scroll value set by last frame when VirtualScroll is set
+
+    void            SetText(const char* text, int text_size)    { IM_ASSERT(text_size >= 0 && (text != NULL || text_size == 0)); if (text_size < Index.EndOffset) Index.clear(); Text = text; TextSize = text_size; }
+    void            Clear()                                     { Text = NULL; TextSize = 0; Index.clear(); FirstLine = 0.0; }
+    bool            IsIndexing() const                          { return Index.EndOffset < TextSize; }
+};
+
 // Helper: ImGuiStorage
 IMGUI_API ImGuiStoragePair* ImLowerBound(ImGuiStoragePair* in_begin, ImGuiStoragePair* in_end, ImGuiID key);
 
@@ -829,6 +910,21 @@ IMGUI_API ImGuiStoragePair* ImLowerBound(ImGuiStoragePair* in_begin, ImGuiStorag
 #define IM_DRAWLIST_ARCFAST_TABLE_SIZE                          48 // Number of samples in lookup table.
 #endif
 #define IM_DRAWLIST_ARCFAST_SAMPLE_MAX                          IM_DRAWLIST_ARCFAST_TABLE_SIZE // Sample index _PathArcToFastEx() for 360 angle.
+#define IM_DRAWLIST_ARCFAST_STEP_MAX                            (IM_DRAWLIST_ARCFAST_TABLE_SIZE / 4) // Largest step used by _PathArcToFastEx() (one quarter of the circle).
+
+// ImDrawList: Unit-radius geometry for filled circles and rounded rectangle corners, for each _PathArcToFastEx() step.
+// Normals are the averaged (miter) normals that AddConvexPolyFilled() would compute for the same points, which don't depend on radius.
+struct ImDrawListShapeTemplateVtx
+{
+    ImVec2          Pos;                        // Position on unit circle
+    ImVec2          Normal;                     // Averaged normal, AA fringe is +/- Normal * AA_SIZE * 0.5f
+};
+
+struct ImDrawListShapeTemplate
+{
+    int             VtxOffset;                  // Index of first vertex in ImDrawListSharedData::ShapeTemplateVtx[]
+    int             VtxCount;
+};
 
 // Data shared between all ImDrawList instances
 // Conceptually this could have been called e.g. ImDrawListSharedContext
@@ -855,10 +951,24 @@ struct IMGUI_API ImDrawListSharedData
     ImVec2          ArcFastVtx[IM_DRAWLIST_ARCFAST_TABLE_SIZE]; // Sample points on the quarter of the circle.
     float           ArcFastRadiusCutoff;                        // Cutoff radius after which arc drawing will fallback to slower PathArcTo()
     ImU8            CircleSegmentCounts[64];    // Precomputed segment count for given radius before we calculate it dynamically (to avoid calculation overhead)
+    ImDrawListShapeTemplate CircleTemplates[IM_DRAWLIST_ARCFAST_STEP_MAX + 1];        // [step] Closed circle, used by AddCircleFilled() with automatic segment count.
+    ImDrawListShapeTemplate CornerTemplates[IM_DRAWLIST_ARCFAST_STEP_MAX + 1][4];     // [step][corner] Rounded rectangle corner (0: bottom-right, 1: bottom-left, 2: top-left, 3: top-right), used by AddRectFilled(). Step 0 is a square corner.
+    ImVector<ImDrawListShapeTemplateVtx> ShapeTemplateVtx;
+
+    // Worker copies (see ImGui::SetupWorkerDrawListSharedData())
+    // A worker copy is never registered into an atlas, so ImDrawList using it may be built from another thread while the main thread keeps running.
+    bool            IsWorkerCopy;               // Set by SetupWorkerDrawListSharedData(). Text functions only read from WorkerFontBakeds[] and never load glyphs.
+    ImTextureRef    WorkerTexRef;               // Copy of FontAtlas->TexRef at the time of setup
+    ImTextureData*  WorkerTexData;              // Copy of FontAtlas->TexData at the time of setup, used to detect atlas changes before merging.
+    ImVector<ImTextureData*> WorkerTexPages;    // Copy of atlas page textures ([0] == WorkerTexData), for ImFontAtlasFlags_MultiPage.
+    ImVec4          WorkerTexUvLines[IM_DRAWLIST_TEX_LINES_WIDTH_MAX + 1]; // Copy of FontAtlas->TexUvLines[], TexUvLines points here.
+    float           WorkerFontRasterizerDensity; // Copy of context FontRasterizerDensity at the time of setup. Fonts are looked up by size and density, like GetFontBaked() does on main thread.
+    ImVector<ImFontBaked*> WorkerFontBakeds;    // Read-only copies of the ImFontBaked registered with AddWorkerDrawListFont()
 
     ImDrawListSharedData();
     ~ImDrawListSharedData();
     void SetCircleTessellationMaxError(float max_error);
+    void BuildShapeTemplates();
 };
 
 struct ImDrawDataBuilder
@@ -1192,6 +1302,28 @@ struct IMGUI_API ImGuiInputTextDeactivatedState
     void    ClearFreeMemory()           { ID = 0; TextA.clear(); }
 };
 
+// Internal line index for the text edited by a multi-line InputText().
+// Updated on each insertion/deletion so that rendering, cursor positioning and mouse/keyboard navigation don't need to scan the
+// whole buffer, which matters with very large texts. Line starts after 'StepLine' are stored without the pending 'StepDelta' offset:
+// that offset is only propagated when an edit happens elsewhere, so repeated edits at the same location only touch nearby lines.
+struct IMGUI_API ImGuiInputTextLineIndex
+{
+    ImVector<int>   LineStarts;         // Offset of the first character of each line. Lines after StepLine are stored minus StepDelta. Empty == invalid/not maintained.
+    int             StepLine;
+    int             StepDelta;
+
+    ImGuiInputTextLineIndex()           { memset(this, 0, sizeof(*this)); }
+    void    Clear()                     { LineStarts.resize(0); StepLine = StepDelta = 0; }
+    bool    IsValid() const             { return LineStarts.Size > 0; }
+    int     GetLineCount() const        { return LineStarts.Size; }
+    int     GetLineStart(int line) const { IM_ASSERT(line >= 0 && line < LineStarts.Size); return LineStarts.Data[line] + (line > StepLine ? StepDelta : 0); }
+    void    Build(const char* text, int text_len);
+    int     FindLine(int offset) const; // Return index of the line containing byte 'offset' (a '\n' belongs to the line it terminates)
+    void    OnInsertChars(int pos, const char* new_text, int new_text_len);
+    void    OnDeleteChars(int pos, int n);
+    void    MoveStep(int line);
+};
+
 // Forward declare imstb_textedit.h structure + make its main configuration define accessible
 #undef IMSTB_TEXTEDIT_STRING
 #undef IMSTB_TEXTEDIT_CHARTYPE
@@ -1216,6 +1348,7 @@ struct IMGUI_API ImGuiInputTextState
     ImVector<char>          TextA;                  // main UTF8 buffer. TextA.Size is a buffer size! Should always be >= buf_size passed by user (and of course >= CurLenA + 1).
     ImVector<char>          TextToRevertTo;         // value to revert to when pressing Escape = backup of end-user buffer at the time of focus (in UTF-8, unaltered)
     ImVector<char>          CallbackTextBackup;     // temporary storage for callback to support automatic reconcile of undo-stack
+    ImGuiInputTextLineIndex LineIndex;              // line starts in TextA, maintained while a multi-line InputText() is active and not read-only
     int                     BufCapacity;            // end-user buffer capacity (include zero terminator)
     ImVec2                  Scroll;                 // horizontal offset (managed manually) + vertical scrolling (pulled from child window's own Scroll.y)
     float                   CursorAnim;             // timer for cursor blink, reset on every user action so the cursor reappears immediately
@@ -1228,8 +1361,8 @@ struct IMGUI_API ImGuiInputTextState
 
     ImGuiInputTextState();
     ~ImGuiInputTextState();
-    void        ClearText()                 { TextLen = 0; TextA[0] = 0; CursorClamp(); }
-    void        ClearFreeMemory()           { TextA.clear(); TextToRevertTo.clear(); }
+    void        ClearText()                 { TextLen = 0; TextA[0] = 0; CursorClamp(); if (LineIndex.IsValid()) LineIndex.Build(TextA.Data, 0); }
+    void        ClearFreeMemory()           { TextA.clear(); TextToRevertTo.clear(); LineIndex.LineStarts.clear(); LineIndex.Clear(); }
     void        OnKeyPressed(int key);      // Cannot be inline because we call in code in stb_textedit.h implementation
     void        OnCharPressed(unsigned int c);
 
@@ -1420,6 +1553,24 @@ struct ImGuiDeactivatedItemData
     bool        IsAlive;
 };
 
+// Cached size and line breaks of a wrapped text, see CalcTextLayoutWrapped().
+// Keyed by hash of (baked font, font size, wrap width, text contents). Garbage collected after io.ConfigMemoryCompactTimer seconds without use.
+struct ImGuiTextLayout
+{
+    ImGuiID             ID;
+    ImGuiID             Seed;               // Hash of (font, font size, wrap width)
+    ImU64               TextHash;           // Hash of text contents using Seed. ID is the lower 32-bits, the rest is used to reject collisions.
+    int                 TextLength;
+    int                 BakedGeneration;    // Copy of ImFontAtlas::BakedGeneration when measured
+    int                 LastFrameUsed;
+    float               LastTimeUsed;
+    const char*         LastText;           // Text pointer when last used, to skip hashing when looked up again during the same frame
+    ImVec2              Size;               // Output of ImFont::CalcTextSizeA() (unrounded)
+    ImVector<int>       Lines;              // [begin, end) offsets of each line, two entries per line
+
+    ImGuiTextLayout()   { ID = Seed = 0; TextHash = 0; TextLength = BakedGeneration = 0; LastFrameUsed = -1; LastTimeUsed = -1.0f; LastText = NULL; }
+};
+
 //-----------------------------------------------------------------------------
 // [SECTION] Popup support
 //-----------------------------------------------------------------------------
@@ -1634,10 +1785,13 @@ struct ImGuiListClipperData
     float                           LossynessOffset;
     int                             StepNo;
     int                             ItemsFrozen;
+    int                             CursorItem;             // Variable height mode: item the cursor will be positioned at on the next step
+    int                             MeasureItem;            // Variable height mode: item submitted by the last step, measured on the next step (-1 if none)
+    float                           MeasureStartPosY;       // Variable height mode: cursor position before submitting MeasureItem
     ImVector<ImGuiListClipperRange> Ranges;
 
     ImGuiListClipperData()          { memset(this, 0, sizeof(*this)); }
-    void                            Reset(ImGuiListClipper* clipper) { ListClipper = clipper; StepNo = ItemsFrozen = 0; Ranges.resize(0); }
+    void                            Reset(ImGuiListClipper* clipper) { ListClipper = clipper; StepNo = ItemsFrozen = CursorItem = 0; MeasureItem = -1; Ranges.resize(0); }
 };
 
 //-----------------------------------------------------------------------------
@@ -2335,6 +2489,7 @@ struct ImGuiContext
 
     // Render
     float                   DimBgRatio;                         // 0.0..1.0 animation when fading in a dimming background (for modal window and CTRL+TAB list)
+    int                     TexUploadRectsRequested;            // Texture rectangles queued for upload during last Render(), before merging them (see io.MetricsTexUploadRects)
 
     // Drag and Drop
     bool                    DragDropActive;
@@ -2367,7 +2522,10 @@ struct ImGuiContext
     ImVector<ImGuiTableTempData>    TablesTempData;             // Temporary table data (buffers reused/shared across instances, support nesting)
     ImPool<ImGuiTable>              Tables;                     // Persistent table data
     ImVector<float>                 TablesLastTimeActive;       // Last used timestamp of each tables (SOA, for efficient GC)
-    ImVector<ImDrawChannel>         DrawChannelsTempMergeBuffer;
+
+    // Text layouts
+    ImPool<ImGuiTextLayout>         TextLayouts;                // Cached measurements of wrapped text, see CalcTextLayoutWrapped()
+    int                             TextLayoutsLastIdx;         // Index of last used entry, to skip hashing when the same text is measured then rendered
 
     // Tab bars
     ImGuiTabBar*                    CurrentTabBar;
@@ -2793,7 +2951,7 @@ struct IMGUI_API ImGuiTabBar
 //-----------------------------------------------------------------------------
 
 #define IM_COL32_DISABLE                IM_COL32(0,0,0,1)   // Special sentinel code which cannot be used as a regular color.
-#define IMGUI_TABLE_MAX_COLUMNS         512                 // Arbitrary "safety" maximum, may be lifted in the future if needed. Must fit in ImGuiTableColumnIdx/ImGuiTableDrawChannelIdx.
+#define IMGUI_TABLE_MAX_COLUMNS         16384               // Arbitrary "safety" maximum, may be lifted in the future if needed. Must fit in ImGuiTableColumnIdx/ImGuiTableDrawChannelIdx.
 
 // [Internal] sizeof() ~ 112
 // We use the terminology "Enabled" to refer to a column that is not Hidden by user/api.
@@ -2819,7 +2977,7 @@ struct ImGuiTableColumn
     float                   ContentMaxXUnfrozen;
     float                   ContentMaxXHeadersUsed;         // Contents maximum position for headers rows (regardless of freezing). TableHeader() automatically softclip itself + report ideal desired size, to avoid creating extraneous draw calls
     float                   ContentMaxXHeadersIdeal;
-    ImS16                   NameOffset;                     // Offset into parent ColumnsNames[]
+    ImS32                   NameOffset;                     // Offset into parent ColumnsNames[]
     ImGuiTableColumnIdx     DisplayOrder;                   // Index within Table's IndexToDisplayOrder[] (column may be reordered by users)
     ImGuiTableColumnIdx     IndexWithinEnabledSet;          // Index within enabled/visible set (<= IndexToDisplayOrder)
     ImGuiTableColumnIdx     PrevEnabledColumn;              // Index of prev enabled/visible column within Columns[], -1 if first enabled/visible column
@@ -2895,11 +3053,12 @@ struct IMGUI_API ImGuiTable
 {
     ImGuiID                     ID;
     ImGuiTableFlags             Flags;
-    void*                       RawData;                    // Single allocation to hold Columns[], DisplayOrderToIndex[], and RowCellData[]
+    void*                       RawData;                    // Single allocation to hold Columns[], DisplayOrderToIndex[], OutputColumns[] and RowCellData[]
     ImGuiTableTempData*         TempData;                   // Transient data while table is active. Point within g.CurrentTableStack[]
     ImSpan<ImGuiTableColumn>    Columns;                    // Point within RawData[]
     ImSpan<ImGuiTableColumnIdx> DisplayOrderToIndex;        // Point within RawData[]. Store display order of columns (when not reordered, the values are 0...Count-1)
     ImSpan<ImGuiTableCellData>  RowCellData;                // Point within RawData[]. Store cells background requests for current row.
+    ImSpan<ImGuiTableColumnIdx> OutputColumns;              // Point within RawData[]. Index of columns requesting output (visible or auto-fitting), sorted by index. Only the first OutputColumnsCount are valid.
     ImBitArrayPtr               EnabledMaskByDisplayOrder;  // Column DisplayOrder -> IsEnabled map
     ImBitArrayPtr               EnabledMaskByIndex;         // Column Index -> IsEnabled map (== not hidden by user/api) in a format adequate for iterating column without touching cold data
     ImBitArrayPtr               VisibleMaskByIndex;         // Column Index -> IsVisibleX|IsVisibleY map (== not hidden by user/api && not hidden by scrolling/cliprect)
@@ -2958,9 +3117,14 @@ struct IMGUI_API ImGuiTable
     ImGuiTableColumnSortSpecs   SortSpecsSingle;
     ImVector<ImGuiTableColumnSortSpecs> SortSpecsMulti;     // FIXME-OPT: Using a small-vector pattern would be good.
     ImGuiTableSortSpecs         SortSpecs;                  // Public facing sorts specs, this is what we return in TableGetSortSpecs()
+    ImVector<int>               DrawChannelsMergeOrder;     // Draw channels in the order they are merged by DrawSplitter->Merge(), see TableMergeDrawChannels(). Rebuilt only when DrawChannelsMergeRanks[] changes.
+    ImVector<ImS8>              DrawChannelsMergeRanks;     // Rank of each draw channel used to build DrawChannelsMergeOrder[] (merge group, Bg2 channel or unmerged).
+    float                       DrawChannelsMergeTime;      // [DEBUG] Time spent computing channels order and merging them in last EndTable(), in seconds. Displayed in Metrics window.
     ImGuiTableColumnIdx         SortSpecsCount;
     ImGuiTableColumnIdx         ColumnsEnabledCount;        // Number of enabled columns (<= ColumnsCount)
     ImGuiTableColumnIdx         ColumnsEnabledFixedCount;   // Number of enabled columns using fixed width (<= ColumnsCount)
+    ImGuiTableColumnIdx         ColumnsVisibleCount;        // Number of visible columns (<= ColumnsEnabledCount), aka number of bits set in VisibleMaskByIndex
+    ImGuiTableColumnIdx         OutputColumnsCount;         // Number of valid entries in OutputColumns[]
     ImGuiTableColumnIdx         DeclColumnsCount;           // Count calls to TableSetupColumn()
     ImGuiTableColumnIdx         AngledHeadersCount;         // Count columns with angled headers
     ImGuiTableColumnIdx         HoveredColumnBody;          // Index of column whose visible region is being hovered. Important: == ColumnsCount when hovering empty region after the right-most column!
@@ -3005,6 +3169,7 @@ struct IMGUI_API ImGuiTable
     bool                        HasScrollbarYCurr;          // Whether ANY instance of this table had a vertical scrollbar during the current frame.
     bool                        HasScrollbarYPrev;          // Whether ANY instance of this table had a vertical scrollbar during the previous.
     bool                        MemoryCompacted;
+    bool                        IsDrawChannelsMergeOrderReused; // [DEBUG] Set when last EndTable() reused DrawChannelsMergeOrder[] from a previous frame.
     bool                        HostSkipItems;              // Backup of InnerWindow->SkipItem at the end of BeginTable(), because we will overwrite InnerWindow->SkipItem on a per-column basis
 
     ImGuiTable()                { memset(this, 0, sizeof(*this)); LastFrameActive = -1; }
@@ -3136,6 +3301,7 @@ namespace ImGui
     inline float            GetFontRasterizerDensity() { return GImGui->FontRasterizerDensity; }
     inline float            GetRoundedFontSize(float size) { return IM_ROUND(size); }
     IMGUI_API ImFont*       GetDefaultFont();
+    IMGUI_API ImGuiTextLayout* CalcTextLayoutWrapped(const char* text, const char* text_end, float wrap_width); // Measure wrapped text with current font, using the text layout cache.
     IMGUI_API void          PushPasswordFont();
     IMGUI_API void          PopPasswordFont();
     inline ImDrawList*      GetForegroundDrawList(ImGuiWindow* window) { IM_UNUSED(window); return GetForegroundDrawList(); } // This seemingly unnecessary wrapper simplifies compatibility between the 'master' and 'docking' branches.
@@ -3143,6 +3309,15 @@ namespace ImGui
     IMGUI_API ImDrawList*   GetForegroundDrawList(ImGuiViewport* viewport);                     // get foreground draw list for the given viewport. this draw list will be the last rendered one. Useful to quickly draw shapes/text over dear imgui contents.
     IMGUI_API void          AddDrawListToDrawDataEx(ImDrawData* draw_data, ImVector<ImDrawList*>* out_list, ImDrawList* draw_list);
 
+    // Drawing from worker threads [EXPERIMENTAL]
+    // - Main thread, once per frame after NewFrame(): SetupWorkerDrawListSharedData() on one ImDrawListSharedData per worker, then AddWorkerDrawListFont() for each font/size you need.
+    // - Worker threads: ResetWorkerDrawList() then use regular ImDrawList functions. Glyphs not loaded at AddWorkerDrawListFont() time render as the fallback glyph. Word-wrapping is not supported.
+    // - Main thread, after joining workers and calling Render(): AddWorkerDrawListsToDrawData(). Lists are appended in array order, so output is deterministic regardless of thread scheduling.
+    IMGUI_API void          SetupWorkerDrawListSharedData(ImDrawListSharedData* worker_data);
+    IMGUI_API void          AddWorkerDrawListFont(ImDrawListSharedData* worker_data, ImFont* font, float font_size, const char* preload_text = NULL, const char* preload_text_end = NULL);
+    IMGUI_API void          ResetWorkerDrawList(ImDrawList* draw_list);
+    IMGUI_API int           AddWorkerDrawListsToDrawData(ImDrawData* draw_data, ImDrawList* const* draw_lists, int draw_lists_count); // Return number of lists added. Lists built against a since-replaced atlas texture are skipped.
+
     // Init
     IMGUI_API void          Initialize();
     IMGUI_API void          Shutdown();    // Since 1.60 this is a _private_ function. You can call DestroyContext() to destroy the context created by CreateContext().
@@ -3456,7 +3631,7 @@ namespace ImGui
     IMGUI_API void          TableDrawBorders(ImGuiTable* table);
     IMGUI_API void          TableDrawDefaultContextMenu(ImGuiTable* table, ImGuiTableFlags flags_for_section_to_display);
     IMGUI_API bool          TableBeginContextMenuPopup(ImGuiTable* table);
-    IMGUI_API void          TableMergeDrawChannels(ImGuiTable* table);
+    IMGUI_API const int*    TableMergeDrawChannels(ImGuiTable* table);
     inline ImGuiTableInstanceData*  TableGetInstanceData(ImGuiTable* table, int instance_no) { if (instance_no == 0) return &table->InstanceDataFirst; return &table->InstanceDataExtra[instance_no - 1]; }
     inline ImGuiID                  TableGetInstanceID(ImGuiTable* table, int instance_no)   { return TableGetInstanceData(table, instance_no)->TableInstanceID; }
     IMGUI_API void          TableSortSpecsSanitize(ImGuiTable* table);
@@ -3540,6 +3715,7 @@ namespace ImGui
     IMGUI_API void          TextEx(const char* text, const char* text_end = NULL, ImGuiTextFlags flags = 0);
     IMGUI_API void          TextAligned(float align_x, float size_x, const char* fmt, ...);               // FIXME-WIP: Works but API is likely to be reworked. This is designed for 1 item on the line. (#7024)
     IMGUI_API void          TextAlignedV(float align_x, float size_x, const char* fmt, va_list args);
+    IMGUI_API void          TextViewer(const char* str_id, ImGuiTextViewer* viewer, const ImVec2& size = ImVec2(0, 0)); // Scrolling child window displaying a large read-only text buffer. See ImGuiTextViewer.
 
     // Widgets
     IMGUI_API bool          ButtonEx(const char* label, const ImVec2& size_arg = ImVec2(0, 0), ImGuiButtonFlags flags = 0);
@@ -3621,6 +3797,7 @@ namespace ImGui
     IMGUI_API void          GcCompactTransientMiscBuffers();
     IMGUI_API void          GcCompactTransientWindowBuffers(ImGuiWindow* window);
     IMGUI_API void          GcAwakeTransientWindowBuffers(ImGuiWindow* window);
+    IMGUI_API void          GcCompactTextLayouts(float memory_compact_start_time);
 
     // Error handling, State Recovery
     IMGUI_API bool          ErrorLog(const char* msg);
@@ -3703,6 +3880,7 @@ struct ImFontLoader
     bool            (*FontBakedInit)(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void* loader_data_for_baked_src);
     void            (*FontBakedDestroy)(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void* loader_data_for_baked_src);
     bool            (*FontBakedLoadGlyph)(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void* loader_data_for_baked_src, ImWchar codepoint, ImFontGlyph* out_glyph, float* out_advance_x);
+    bool            (*FontBakedRasterizeGlyph)(ImFontAtlas* atlas, ImFontConfig* src, const ImFontAtlasGlyphJob* job, unsigned char* out_pixels, ImFontAtlasGlyphJobScratch* scratch); // Optional: render a glyph queued by FontBakedLoadGlyph() with ImFontAtlasBuildAddGlyphJob(). See ImFontAtlasGlyphJob for threading rules.
 
     // Size of backend data, Per Baked * Per Source. Buffers are managed by core to avoid excessive allocations.
     // FIXME: At this point the two other types of buffers may be managed by core to be consistent?
@@ -3724,6 +3902,8 @@ typedef ImFontLoader ImFontBuilderIO; // [renamed/changed in 1.92] The types are
 
 #define IMGUI_FONT_SIZE_MAX                                     (512.0f)
 #define IMGUI_FONT_SIZE_THRESHOLD_FOR_LOADADVANCEXONLYMODE      (128.0f)
+#define IMGUI_FONT_SDF_BAKE_SIZE                                (32.0f)     // Single baked size of ImFontFlags_SDF fonts.
+#define IMGUI_FONT_SDF_PADDING                                  (4)         // Texels of distance field around ImFontFlags_SDF glyphs: 128 / IM_FONT_SDF_PIXEL_DIST_SCALE, so the field saturates to 0 at the padding edge.
 
 // Helpers: ImTextureRef ==/!= operators provided as convenience
 // (note that _TexID and _TexData are never set simultaneously)
@@ -3748,6 +3928,7 @@ struct ImFontAtlasRectEntry
     int                 TargetIndex : 20;   // When Used: ImFontAtlasRectId -> into Rects[]. When unused: index to next unused RectsIndex[] slot to consume free-list.
     int                 Generation : 10;    // Increased each time the entry is reused for a new rectangle.
     unsigned int        IsUsed : 1;
+    unsigned int        Page : 5;           // Index into builder->Pages[]. Always 0 for custom rectangles.
 };
 
 // Data available to potential texture post-processing functions
@@ -3777,18 +3958,118 @@ typedef stbrp_node stbrp_node_im;
 #endif
 struct stbrp_context_opaque { char data[80]; };
 
-// Internal storage for incrementally packing and building a ImFontAtlas
-struct ImFontAtlasBuilder
+// Deferred glyph rasterization job.
+// Between ImFontAtlasBuildBeginGlyphJobs() and ImFontAtlasBuildEndGlyphJobs(), loaders may register glyph metrics and pack rectangle
+// right away but queue the rendering of pixels, which are then rendered in batch (possibly in parallel, see ImFontAtlas::ParallelFor) and copied into the texture.
+// ImFontLoader::FontBakedRasterizeGlyph() may be called from any thread:
+// - it must only read font data and write to 'out_pixels' (Width*Height bytes, Alpha8 format, cleared to zero).
+// - when 'scratch' is not NULL, it must take temporary memory from it instead of calling IM_ALLOC(). Setting scratch->Overflow makes the job run again from main thread.
+struct ImFontAtlasGlyphJob
+{
+    ImFontBaked*        Baked;
+    ImFontConfig*       Src;
+    int                 GlyphIdx;           // Index into Baked->Glyphs[]. The glyph is added by the caller of FontBakedLoadGlyph().
+    ImFontAtlasRectId   PackId;
+    int                 Width, Height;
+    int                 PixelsOffset;       // Offset into ImFontAtlasBuilder::GlyphJobsPixels[]
+    bool                Done;
+    int                 LoaderGlyphIndex;   // Free for loader use
+    float               LoaderScaleX, LoaderScaleY;
+    int                 LoaderOversampleH, LoaderOversampleV;
+};
+
+// Fixed size linear allocator for glyph rasterization jobs. Memory is reclaimed after each job.
+struct ImFontAtlasGlyphJobScratch
+{
+    unsigned char*      Data;
+    int                 Size;
+    int                 Used;
+    bool                Overflow;           // Set when an allocation didn't fit.
+
+    void*               Alloc(size_t sz)    { sz = (sz + 15) & ~(size_t)15; if ((size_t)(Size - Used) < sz) { Overflow = true; return NULL; } void* p = Data + Used; Used += (int)sz; return p; }
+};
+
+// Persistent cache of baked glyphs (see ImFontAtlas::LoadGlyphCacheFromFile())
+// File layout is designed to be used in place (e.g. from a memory-mapped file). Offsets are relative to start of section, fields are 4-bytes aligned.
+// Values are stored in native byte order: a file written on a machine of different endianness is rejected by the Version check.
+// - ImFontAtlasGlyphCacheHeader
+// - ImFontAtlasGlyphCacheBlock[BlocksCount]    One per (font source, baked size, rasterizer density). Key is a hash of everything affecting output, see ImFontAtlasGlyphCacheGetKey().
+// - ImFontAtlasGlyphCacheGlyph[GlyphsCount]    Sorted by codepoint within each block. Metrics are final (clamped/snapped/offset).
+// - unsigned char[PixelsSize]                  Alpha8 bitmaps, already post-processed.
+#define IM_FONTATLAS_GLYPHCACHE_MAGIC       "ImGlyph"
+#define IM_FONTATLAS_GLYPHCACHE_VERSION     2
+
+struct ImFontAtlasGlyphCacheHeader
+{
+    char                Magic[8];
+    ImU32               Version;
+    ImU32               BlocksCount;
+    ImU32               GlyphsCount;
+    ImU32               PixelsSize;
+};
+
+struct ImFontAtlasGlyphCacheBlock
+{
+    ImGuiID             Key;
+    ImU32               GlyphsStart;        // Index into glyphs section
+    ImU32               GlyphsCount;
+    ImU32               Reserved;
+};
+
+struct ImFontAtlasGlyphCacheGlyph
+{
+    ImU32               Codepoint;
+    ImU16               Width, Height;      // Size of bitmap. May be 0.
+    float               AdvanceX;
+    float               X0, Y0, X1, Y1;
+    ImU32               PixelsOffset;       // Offset into pixels section
+    ImU32               Visible;
+};
+
+struct ImFontAtlasGlyphCache
 {
+    const unsigned char*                Data;
+    size_t                              DataSize;
+    bool                                DataOwned;      // Data was allocated by us (LoadGlyphCacheFromFile)
+    const ImFontAtlasGlyphCacheBlock*   Blocks;
+    const ImFontAtlasGlyphCacheGlyph*   Glyphs;
+    const unsigned char*                Pixels;
+    int                                 BlocksCount;
+    ImGuiStorage                        BlocksMap;      // Key --> Index into Blocks[]
+    int                                 GlyphsLoadedCount; // Stats: number of glyphs obtained from cache
+
+    ImFontAtlasGlyphCache()             { memset(this, 0, sizeof(*this)); }
+};
+
+// A texture of the atlas, with its own rectangle packing state.
+// There is a single page unless using ImFontAtlasFlags_MultiPage. Then, once pages reached TexMaxWidth x TexMaxHeight, glyphs
+// which don't fit go to additional pages of that size. Page 0 is always atlas->TexData and holds all custom rectangles.
+#define IM_FONTATLAS_MAX_PAGES      32      // Limited by ImFontGlyph::TexPage and ImFontAtlasRectEntry::Page bits.
+struct ImFontAtlasPage
+{
+    ImTextureData*              Tex;
+    ImVec2                      TexUvScale;             // = (1.0f/Tex->Width, 1.0f/Tex->Height).
     stbrp_context_opaque        PackContext;            // Actually 'stbrp_context' but we don't want to define this in the header file.
     ImVector<stbrp_node_im>     PackNodes;
+    int                         RectsPackedCount;       // Number of rectangles packed since last repack of this page (incl. discarded ones).
+    int                         RectsPackedSurface;     // Number of packed pixels since last repack of this page (incl. discarded ones).
+    int                         RectsDiscardedSurface;  // Number of pixels lost to discarded rectangles, reclaimed by repacking the page.
+
+    ImFontAtlasPage()           { memset(this, 0, sizeof(*this)); }
+};
+
+// Internal storage for incrementally packing and building a ImFontAtlas
+struct ImFontAtlasBuilder
+{
+    ImVector<ImFontAtlasPage*>  Pages;                  // Texture pages. Pages[0]->Tex == atlas->TexData.
+    int                         PagesCurrent;           // Page where new glyphs are packed.
     ImVector<ImTextureRect>     Rects;
     ImVector<ImFontAtlasRectEntry> RectsIndex;          // ImFontAtlasRectId -> index into Rects[]
     ImVector<unsigned char>     TempBuffer;             // Misc scratch buffer
     int                         RectsIndexFreeListStart;// First unused entry
-    int                         RectsPackedCount;       // Number of packed rectangles.
-    int                         RectsPackedSurface;     // Number of packed pixels. Used when compacting to heuristically find the ideal texture size.
-    int                         RectsDiscardedCount;
+    int                         RectsPackedCount;       // Number of packed rectangles, all pages.
+    int                         RectsPackedSurface;     // Number of packed pixels, all pages. Used when compacting to heuristically find the ideal texture size.
+    int                         RectsDiscardedCount;    // Number of discarded rectangles still taking a slot in Rects[].
     int                         RectsDiscardedSurface;
     int                         FrameCount;             // Current frame count
     ImVec2i                     MaxRectSize;            // Largest rectangle to pack (de-facto used as a "minimum texture size")
@@ -3805,6 +4086,11 @@ struct ImFontAtlasBuilder
     ImFontAtlasRectId           PackIdMouseCursors;     // White pixel + mouse cursors. Also happen to be fallback in case of packing failure.
     ImFontAtlasRectId           PackIdLinesTexData;
 
+    // Deferred glyph rasterization (see ImFontAtlasBuildBeginGlyphJobs())
+    ImVector<ImFontAtlasGlyphJob> GlyphJobs;
+    ImVector<unsigned char>     GlyphJobsPixels;        // Output bitmaps of pending jobs, see ImFontAtlasGlyphJob::PixelsOffset
+    int                         GlyphJobsDeferDepth;    // >0 while glyphs rasterization is deferred
+
     ImFontAtlasBuilder()        { memset(this, 0, sizeof(*this)); FrameCount = -1; RectsIndexFreeListStart = -1; PackIdMouseCursors = PackIdLinesTexData = -1; }
 };
 
@@ -3819,6 +4105,8 @@ IMGUI_API void              ImFontAtlasBuildClear(ImFontAtlas* atlas); // Clear
 IMGUI_API ImTextureData*    ImFontAtlasTextureAdd(ImFontAtlas* atlas, int w, int h);
 IMGUI_API void              ImFontAtlasTextureMakeSpace(ImFontAtlas* atlas);
 IMGUI_API void              ImFontAtlasTextureRepack(ImFontAtlas* atlas, int w, int h);
+IMGUI_API void              ImFontAtlasTextureRepackPage(ImFontAtlas* atlas, int page_n, int w, int h);
+IMGUI_API ImFontAtlasPage*  ImFontAtlasTextureAddPage(ImFontAtlas* atlas);
 IMGUI_API void              ImFontAtlasTextureGrow(ImFontAtlas* atlas, int old_w = -1, int old_h = -1);
 IMGUI_API void              ImFontAtlasTextureCompact(ImFontAtlas* atlas);
 IMGUI_API ImVec2i           ImFontAtlasTextureGetSizeEstimate(ImFontAtlas* atlas);
@@ -3844,9 +4132,24 @@ IMGUI_API ImFontGlyph*      ImFontAtlasBakedAddFontGlyph(ImFontAtlas* atlas, ImF
 IMGUI_API void              ImFontAtlasBakedAddFontGlyphAdvancedX(ImFontAtlas* atlas, ImFontBaked* baked, ImFontConfig* src, ImWchar codepoint, float advance_x);
 IMGUI_API void              ImFontAtlasBakedDiscardFontGlyph(ImFontAtlas* atlas, ImFont* font, ImFontBaked* baked, ImFontGlyph* glyph);
 IMGUI_API void              ImFontAtlasBakedSetFontGlyphBitmap(ImFontAtlas* atlas, ImFontBaked* baked, ImFontConfig* src, ImFontGlyph* glyph, ImTextureRect* r, const unsigned char* src_pixels, ImTextureFormat src_fmt, int src_pitch);
+IMGUI_API ImVec2            ImFontCalcTextSizeWithLines(ImFont* font, float size, float wrap_width, const char* text_begin, const char* text_end, ImVector<int>* out_lines); // Same as CalcTextSizeA() + output [begin, end) offsets of each line.
+IMGUI_API void              ImFontAtlasBakedLoadGlyphsForText(ImFontAtlas* atlas, ImFontBaked* baked, const char* text, const char* text_end); // Load all missing glyphs used by text, in a batch.
+
+IMGUI_API void              ImFontAtlasBuildBeginGlyphJobs(ImFontAtlas* atlas);     // Defer glyphs rasterization until matching ImFontAtlasBuildEndGlyphJobs() call. Can be nested.
+IMGUI_API void              ImFontAtlasBuildEndGlyphJobs(ImFontAtlas* atlas);
+IMGUI_API void              ImFontAtlasBuildFlushGlyphJobs(ImFontAtlas* atlas);     // Render pending glyphs (possibly in parallel) and copy them into texture.
+IMGUI_API ImFontAtlasGlyphJob* ImFontAtlasBuildAddGlyphJob(ImFontAtlas* atlas, ImFontBaked* baked, ImFontConfig* src, ImFontAtlasRectId pack_id, int w, int h); // For loaders. Return NULL when not deferring: render immediately.
+
+IMGUI_API ImFontAtlasGlyphCache* ImFontAtlasGlyphCacheCreate(const void* data, size_t data_size); // Return NULL if data is invalid
+IMGUI_API void              ImFontAtlasGlyphCacheDestroy(ImFontAtlasGlyphCache* cache);
+IMGUI_API ImGuiID           ImFontAtlasGlyphCacheGetKey(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked);
+IMGUI_API const ImFontAtlasGlyphCacheGlyph* ImFontAtlasGlyphCacheFind(ImFontAtlasGlyphCache* cache, ImGuiID key, ImWchar codepoint);
+IMGUI_API bool              ImFontAtlasGlyphCacheBuild(ImFontAtlas* atlas, ImVector<unsigned char>* out_data); // Serialize currently baked glyphs (+ unused entries of loaded cache)
 
-IMGUI_API void              ImFontAtlasPackInit(ImFontAtlas* atlas);
+IMGUI_API void              ImFontAtlasPackInit(ImFontAtlas* atlas, int page_n = 0);
 IMGUI_API ImFontAtlasRectId ImFontAtlasPackAddRect(ImFontAtlas* atlas, int w, int h, ImFontAtlasRectEntry* overwrite_entry = NULL);
+IMGUI_API ImFontAtlasRectId ImFontAtlasPackAddGlyphRect(ImFontAtlas* atlas, int w, int h); // Same as ImFontAtlasPackAddRect() but may use any page of a ImFontAtlasFlags_MultiPage atlas. For glyphs only.
+IMGUI_API int               ImFontAtlasPackGetRectPage(ImFontAtlas* atlas, ImFontAtlasRectId id); // Return index into builder->Pages[]
 IMGUI_API ImTextureRect*    ImFontAtlasPackGetRect(ImFontAtlas* atlas, ImFontAtlasRectId id);
 IMGUI_API ImTextureRect*    ImFontAtlasPackGetRectSafe(ImFontAtlas* atlas, ImFontAtlasRectId id);
 IMGUI_API void              ImFontAtlasPackDiscardRect(ImFontAtlas* atlas, ImFontAtlasRectId id);
@@ -3867,6 +4170,7 @@ IMGUI_API void              ImFontAtlasTextureBlockQueueUpload(ImFontAtlas* atla
 IMGUI_API int               ImTextureDataGetFormatBytesPerPixel(ImTextureFormat format);
 IMGUI_API const char*       ImTextureDataGetStatusName(ImTextureStatus status);
 IMGUI_API const char*       ImTextureDataGetFormatName(ImTextureFormat format);
+IMGUI_API void              ImTextureDataMergeUpdates(ImTextureData* tex, float max_waste); // Merge Updates[] rectangles, see ImFontAtlas::TexUpdatesMergeWaste
 
 #ifndef IMGUI_DISABLE_DEBUG_TOOLS
 IMGUI_API void              ImFontAtlasDebugLogTextureRequests(ImFontAtlas* atlas);
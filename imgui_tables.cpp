@@ -166,6 +166,8 @@ Index of this file:
 //   width measurements. Otherwise, you may skip submitting the contents of a cell/column, BUT ONLY if you know
 //   it is not going to contribute to row height.
 //   In many situations, you may skip submitting contents for every column but one (e.g. the first one).
+// - TableNextVisibleColumn() only visits columns requesting output: in tables with thousands of columns and
+//   horizontal scrolling, this avoids paying for every clipped cell of every row.
 // - Case A: column is not hidden by user, and at least partially in sight (most common case).
 // - Case B: column is clipped / out of sight (because of scrolling or parent ClipRect): TableNextColumn() return false as a hint but we still allow layout output.
 // - Case C: column is hidden explicitly by the user (e.g. via the context menu, or _DefaultHide column flag, etc.).
@@ -650,27 +652,30 @@ bool    ImGui::BeginTableEx(const char* name, ImGuiID id, int columns_count, ImG
 // Shared allocations for the maximum number of simultaneously nested tables (generally a very small number)
 // + 1 (for table->Splitter._Channels)
 // + 2 * active_channels_count (for ImDrawCmd and ImDrawIdx buffers inside channels)
-// Where active_channels_count is variable but often == columns_count or == columns_count + 1, see TableSetupDrawChannels() for details.
+// Where active_channels_count is variable but often == visible_columns_count or == visible_columns_count + 1, see TableSetupDrawChannels() for details.
 // Unused channels don't perform their +2 allocations.
 void ImGui::TableBeginInitMemory(ImGuiTable* table, int columns_count)
 {
     // Allocate single buffer for our arrays
     const int columns_bit_array_size = (int)ImBitArrayGetStorageSizeInBytes(columns_count);
-    ImSpanAllocator<6> span_allocator;
+    ImSpanAllocator<7> span_allocator;
     span_allocator.Reserve(0, columns_count * sizeof(ImGuiTableColumn));
     span_allocator.Reserve(1, columns_count * sizeof(ImGuiTableColumnIdx));
-    span_allocator.Reserve(2, columns_count * sizeof(ImGuiTableCellData), 4);
-    for (int n = 3; n < 6; n++)
+    span_allocator.Reserve(2, columns_count * sizeof(ImGuiTableColumnIdx));
+    span_allocator.Reserve(3, columns_count * sizeof(ImGuiTableCellData), 4);
+    for (int n = 4; n < 7; n++)
         span_allocator.Reserve(n, columns_bit_array_size);
     table->RawData = IM_ALLOC(span_allocator.GetArenaSizeInBytes());
     memset(table->RawData, 0, span_allocator.GetArenaSizeInBytes());
     span_allocator.SetArenaBasePtr(table->RawData);
     span_allocator.GetSpan(0, &table->Columns);
     span_allocator.GetSpan(1, &table->DisplayOrderToIndex);
-    span_allocator.GetSpan(2, &table->RowCellData);
-    table->EnabledMaskByDisplayOrder = (ImU32*)span_allocator.GetSpanPtrBegin(3);
-    table->EnabledMaskByIndex = (ImU32*)span_allocator.GetSpanPtrBegin(4);
-    table->VisibleMaskByIndex = (ImU32*)span_allocator.GetSpanPtrBegin(5);
+    span_allocator.GetSpan(2, &table->OutputColumns);
+    span_allocator.GetSpan(3, &table->RowCellData);
+    table->EnabledMaskByDisplayOrder = (ImU32*)span_allocator.GetSpanPtrBegin(4);
+    table->EnabledMaskByIndex = (ImU32*)span_allocator.GetSpanPtrBegin(5);
+    table->VisibleMaskByIndex = (ImU32*)span_allocator.GetSpanPtrBegin(6);
+    table->OutputColumnsCount = 0;
 }
 
 // Apply queued resizing/reordering/hiding requests
@@ -1054,6 +1059,7 @@ void ImGui::TableUpdateLayout(ImGuiTable* table)
     ImRect host_clip_rect = table->InnerClipRect;
     //host_clip_rect.Max.x += table->CellPaddingX + table->CellSpacingX2;
     ImBitArrayClearAllBits(table->VisibleMaskByIndex, table->ColumnsCount);
+    table->ColumnsVisibleCount = 0;
     for (int order_n = 0; order_n < table->ColumnsCount; order_n++)
     {
         const int column_n = table->DisplayOrderToIndex[order_n];
@@ -1121,7 +1127,10 @@ void ImGui::TableUpdateLayout(ImGuiTable* table)
         column->IsVisibleY = true; // (column->ClipRect.Max.y > column->ClipRect.Min.y);
         const bool is_visible = column->IsVisibleX; //&& column->IsVisibleY;
         if (is_visible)
+        {
             ImBitArraySetBit(table->VisibleMaskByIndex, column_n);
+            table->ColumnsVisibleCount++;
+        }
 
         // Mark column as requesting output from user. Note that fixed + non-resizable sets are auto-fitting at all times and therefore always request output.
         column->IsRequestOutput = is_visible || column->AutoFitQueue != 0 || column->CannotSkipItemsQueue != 0;
@@ -1197,6 +1206,13 @@ void ImGui::TableUpdateLayout(ImGuiTable* table)
         table->Columns[table->LeftMostEnabledColumn].IsSkipItems = false;
     }
 
+    // Build list of columns requesting output, sorted by index, so very wide tables can iterate only those (see TableNextVisibleColumn()).
+    // With horizontal scrolling this is typically a small fraction of all columns.
+    table->OutputColumnsCount = 0;
+    for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
+        if (table->Columns[column_n].IsRequestOutput)
+            table->OutputColumns[table->OutputColumnsCount++] = (ImGuiTableColumnIdx)column_n;
+
     // [Part 7] Detect/store when we are hovering the unused space after the right-most column (so e.g. context menus can react on it)
     // Clear Resizable flag if none of our column are actually resizable (either via an explicit _NoResize flag, either
     // because of using _WidthAuto/_WidthStretch). This will hide the resizing option from the context menu.
@@ -1428,11 +1444,14 @@ void    ImGui::EndTable()
 #endif
 
     // Flatten channels and merge draw calls
+    const double merge_start_time = ImTimeGetSeconds();
     ImDrawListSplitter* splitter = table->DrawSplitter;
     splitter->SetCurrentChannel(inner_window->DrawList, 0);
+    const int* channels_order = NULL;
     if ((table->Flags & ImGuiTableFlags_NoClip) == 0)
-        TableMergeDrawChannels(table);
-    splitter->Merge(inner_window->DrawList);
+        channels_order = TableMergeDrawChannels(table);
+    splitter->Merge(inner_window->DrawList, channels_order);
+    table->DrawChannelsMergeTime = (float)(ImTimeGetSeconds() - merge_start_time);
 
     // Update ColumnsAutoFitWidth to get us ahead for host using our size to auto-resize without waiting for next BeginTable()
     float auto_fit_width_for_fixed = 0.0f;
@@ -1651,7 +1670,7 @@ void ImGui::TableSetupColumn(const char* label, ImGuiTableColumnFlags flags, flo
     column->NameOffset = -1;
     if (label != NULL && label[0] != 0)
     {
-        column->NameOffset = (ImS16)table->ColumnsNames.size();
+        column->NameOffset = (ImS32)table->ColumnsNames.size();
         table->ColumnsNames.append(label, label + ImStrlen(label) + 1);
     }
 }
@@ -2101,6 +2120,7 @@ void ImGui::TableEndRow(ImGuiTable* table)
 // - TableGetColumnIndex()
 // - TableSetColumnIndex()
 // - TableNextColumn()
+// - TableNextVisibleColumn()
 // - TableBeginCell() [Internal]
 // - TableEndCell() [Internal]
 //-------------------------------------------------------------------------
@@ -2164,6 +2184,38 @@ bool ImGui::TableNextColumn()
     return table->Columns[table->CurrentColumn].IsRequestOutput;
 }
 
+// [Public] Append into the next column requesting output (visible or auto-fitting), skipping all clipped columns.
+// Return false when there are no more such columns in the current row: unlike TableNextColumn(), this doesn't wrap around
+// to the next row. Cost is proportional to the number of visible columns, not to the total number of columns, e.g.:
+//   TableNextRow(); while (TableNextVisibleColumn()) { Text("%d", TableGetColumnIndex()); }
+bool ImGui::TableNextVisibleColumn()
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiTable* table = g.CurrentTable;
+    if (!table)
+        return false;
+    if (!table->IsInsideRow)
+        TableNextRow();
+
+    // Binary search first output column after current one (OutputColumns[] is sorted by index)
+    int lo = 0, hi = table->OutputColumnsCount;
+    while (lo < hi)
+    {
+        const int mid = (lo + hi) >> 1;
+        if (table->OutputColumns[mid] <= table->CurrentColumn)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    if (lo == table->OutputColumnsCount)
+        return false;
+
+    if (table->CurrentColumn != -1)
+        TableEndCell(table);
+    TableBeginCell(table, table->OutputColumns[lo]);
+    return true;
+}
+
 
 // [Internal] Called by TableSetColumnIndex()/TableNextColumn()
 // This is called very frequently, so we need to be mindful of unnecessary overhead.
@@ -2529,9 +2581,9 @@ void ImGui::TablePopColumnChannel()
 void ImGui::TableSetupDrawChannels(ImGuiTable* table)
 {
     const int freeze_row_multiplier = (table->FreezeRowsCount > 0) ? 2 : 1;
-    const int channels_for_row = (table->Flags & ImGuiTableFlags_NoClip) ? 1 : table->ColumnsEnabledCount;
+    const int channels_for_row = (table->Flags & ImGuiTableFlags_NoClip) ? 1 : table->ColumnsVisibleCount; // Only visible columns get a channel, so clipped columns of a wide table are free
     const int channels_for_bg = 1 + 1 * freeze_row_multiplier;
-    const int channels_for_dummy = (table->ColumnsEnabledCount < table->ColumnsCount || (memcmp(table->VisibleMaskByIndex, table->EnabledMaskByIndex, ImBitArrayGetStorageSizeInBytes(table->ColumnsCount)) != 0)) ? +1 : 0;
+    const int channels_for_dummy = (table->ColumnsVisibleCount < table->ColumnsCount) ? +1 : 0; // Visible columns are a subset of enabled columns
     const int channels_total = channels_for_bg + (channels_for_row * freeze_row_multiplier) + channels_for_dummy;
     table->DrawSplitter->Split(table->InnerWindow->DrawList, channels_total);
     table->DummyDrawChannel = (ImGuiTableDrawChannelIdx)((channels_for_dummy > 0) ? channels_total - 1 : -1);
@@ -2565,13 +2617,21 @@ void ImGui::TableSetupDrawChannels(ImGuiTable* table)
     IM_ASSERT(table->BgClipRect.Min.y <= table->BgClipRect.Max.y);
 }
 
-// This function reorder draw channels based on matching clip rectangle, to facilitate merging them. Called by EndTable().
-// For simplicity we call it TableMergeDrawChannels() but in fact it only reorder channels + overwrite ClipRect,
+// Rank of draw channels in merge order: [Group 0][Group 1][Bg2 unfrozen][Group 2][Group 3][Unmerged channels]
+static const int TABLE_MERGE_RANK_BG2_UNFROZEN = 2;
+static const int TABLE_MERGE_RANK_UNMERGED = 5;
+static inline int TableMergeGroupToRank(int merge_group_n) { return (merge_group_n < 2) ? merge_group_n : merge_group_n + 1; }
+
+// This function computes an order for draw channels based on matching clip rectangle, to facilitate merging them. Called by EndTable().
+// For simplicity we call it TableMergeDrawChannels() but in fact it only returns channels order + overwrite ClipRect,
 // actual merging is done by table->DrawSplitter.Merge() which is called right after TableMergeDrawChannels().
 //
 // Columns where the contents didn't stray off their local clip rectangle can be merged. To achieve
-// this we merge their clip rect and make them contiguous in the channel list, so they can be merged
+// this we merge their clip rect and make them contiguous in the channels order, so they can be merged
 // by the call to DrawSplitter.Merge() following to the call to this function.
+// Channels are not moved: DrawSplitter.Merge() appends them directly in the returned order (NULL: unchanged order).
+// The order only depends on the merge group of each channel, so it is reused as long as those don't change,
+// which is the common case when scrolling or when contents are changing but still fitting in columns.
 // We reorder draw commands by arranging them into a maximum of 4 distinct groups:
 //
 //   1 group:               2 groups:              2 groups:              4 groups:
@@ -2582,8 +2642,7 @@ void ImGui::TableSetupDrawChannels(ImGuiTable* table)
 // When the contents of a column didn't stray off its limit, we move its channels into the corresponding group
 // based on its position (within frozen rows/columns groups or not).
 // At the end of the operation our 1-4 groups will each have a ImDrawCmd using the same ClipRect.
-// This function assume that each column are pointing to a distinct draw channel,
-// otherwise merge_group->ChannelsCount will not match set bit count of merge_group->ChannelsMask.
+// This function assume that each column are pointing to a distinct draw channel.
 //
 // Column channels will not be merged into one of the 1-4 groups in the following cases:
 // - The contents stray off its clipping rectangle (we only compare the MaxX value, not the MinX value).
@@ -2594,7 +2653,7 @@ void ImGui::TableSetupDrawChannels(ImGuiTable* table)
 // Columns for which the draw channel(s) haven't been merged with other will use their own ImDrawCmd.
 //
 // This function is particularly tricky to understand.. take a breath.
-void ImGui::TableMergeDrawChannels(ImGuiTable* table)
+const int* ImGui::TableMergeDrawChannels(ImGuiTable* table)
 {
     ImGuiContext& g = *GImGui;
     ImDrawListSplitter* splitter = table->DrawSplitter;
@@ -2602,28 +2661,26 @@ void ImGui::TableMergeDrawChannels(ImGuiTable* table)
     const bool has_freeze_h = (table->FreezeColumnsCount > 0);
     IM_ASSERT(splitter->_Current == 0);
 
-    // Track which groups we are going to attempt to merge, and which channels goes into each group.
+    // Track which groups we are going to attempt to merge
     struct MergeGroup
     {
         ImRect          ClipRect;
         int             ChannelsCount = 0;
-        ImBitArrayPtr   ChannelsMask = NULL;
     };
     int merge_group_mask = 0x00;
     MergeGroup merge_groups[4];
 
-    // Use a reusable temp buffer for the merge masks as they are dynamically sized.
-    const int max_draw_channels = (4 + table->ColumnsCount * 2);
-    const int size_for_masks_bitarrays_one = (int)ImBitArrayGetStorageSizeInBytes(max_draw_channels);
-    g.TempBuffer.reserve(size_for_masks_bitarrays_one * 5);
-    memset(g.TempBuffer.Data, 0, size_for_masks_bitarrays_one * 5);
-    for (int n = 0; n < IM_ARRAYSIZE(merge_groups); n++)
-        merge_groups[n].ChannelsMask = (ImBitArrayPtr)(void*)(g.TempBuffer.Data + (size_for_masks_bitarrays_one * n));
-    ImBitArrayPtr remaining_mask = (ImBitArrayPtr)(void*)(g.TempBuffer.Data + (size_for_masks_bitarrays_one * 4));
+    // Use a reusable temp buffer to store the rank of each channel in merge order.
+    const int channels_count = splitter->_Count;
+    g.TempBuffer.reserve(channels_count);
+    ImS8* channels_rank = (ImS8*)(void*)g.TempBuffer.Data;
+    memset(channels_rank, TABLE_MERGE_RANK_UNMERGED, (size_t)channels_count);
 
     // 1. Scan channels and take note of those which can be merged
-    for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
+    // (visible columns are a subset of OutputColumns[], which is much smaller than ColumnsCount in a very wide table)
+    for (int output_n = 0; output_n < table->OutputColumnsCount; output_n++)
     {
+        const int column_n = table->OutputColumns[output_n];
         if (!IM_BITARRAY_TESTBIT(table->VisibleMaskByIndex, column_n))
             continue;
         ImGuiTableColumn* column = &table->Columns[column_n];
@@ -2656,11 +2713,11 @@ void ImGui::TableMergeDrawChannels(ImGuiTable* table)
             }
 
             const int merge_group_n = (has_freeze_h && column_n < table->FreezeColumnsCount ? 0 : 1) + (has_freeze_v && merge_group_sub_n == 0 ? 0 : 2);
-            IM_ASSERT(channel_no < max_draw_channels);
+            IM_ASSERT(channel_no < channels_count);
             MergeGroup* merge_group = &merge_groups[merge_group_n];
             if (merge_group->ChannelsCount == 0)
                 merge_group->ClipRect = ImRect(+FLT_MAX, +FLT_MAX, -FLT_MAX, -FLT_MAX);
-            ImBitArraySetBit(merge_group->ChannelsMask, channel_no);
+            channels_rank[channel_no] = (ImS8)TableMergeGroupToRank(merge_group_n);
             merge_group->ChannelsCount++;
             merge_group->ClipRect.Add(src_channel->_CmdBuffer[0].ClipRect);
             merge_group_mask |= (1 << merge_group_n);
@@ -2689,79 +2746,82 @@ void ImGui::TableMergeDrawChannels(ImGuiTable* table)
         }
 #endif
 
-    // 2. Rewrite channel list in our preferred order
-    if (merge_group_mask != 0)
-    {
-        // We skip channel 0 (Bg0/Bg1) and 1 (Bg2 frozen) from the shuffling since they won't move - see channels allocation in TableSetupDrawChannels().
-        const int LEADING_DRAW_CHANNELS = 2;
-        g.DrawChannelsTempMergeBuffer.resize(splitter->_Count - LEADING_DRAW_CHANNELS); // Use shared temporary storage so the allocation gets amortized
-        ImDrawChannel* dst_tmp = g.DrawChannelsTempMergeBuffer.Data;
-        ImBitArraySetBitRange(remaining_mask, LEADING_DRAW_CHANNELS, splitter->_Count);
-        ImBitArrayClearBit(remaining_mask, table->Bg2DrawChannelUnfrozen);
-        IM_ASSERT(has_freeze_v == false || table->Bg2DrawChannelUnfrozen != TABLE_DRAW_CHANNEL_BG2_FROZEN);
-        int remaining_count = splitter->_Count - (has_freeze_v ? LEADING_DRAW_CHANNELS + 1 : LEADING_DRAW_CHANNELS);
-        //ImRect host_rect = (table->InnerWindow == table->OuterWindow) ? table->InnerClipRect : table->HostClipRect;
-        ImRect host_rect = table->HostClipRect;
-        for (int merge_group_n = 0; merge_group_n < IM_ARRAYSIZE(merge_groups); merge_group_n++)
-        {
-            if (int merge_channels_count = merge_groups[merge_group_n].ChannelsCount)
-            {
-                MergeGroup* merge_group = &merge_groups[merge_group_n];
-                ImRect merge_clip_rect = merge_group->ClipRect;
-
-                // Extend outer-most clip limits to match those of host, so draw calls can be merged even if
-                // outer-most columns have some outer padding offsetting them from their parent ClipRect.
-                // The principal cases this is dealing with are:
-                // - On a same-window table (not scrolling = single group), all fitting columns ClipRect -> will extend and match host ClipRect -> will merge
-                // - Columns can use padding and have left-most ClipRect.Min.x and right-most ClipRect.Max.x != from host ClipRect -> will extend and match host ClipRect -> will merge
-                // FIXME-TABLE FIXME-WORKRECT: We are wasting a merge opportunity on tables without scrolling if column doesn't fit
-                // within host clip rect, solely because of the half-padding difference between window->WorkRect and window->InnerClipRect.
-                if ((merge_group_n & 1) == 0 || !has_freeze_h)
-                    merge_clip_rect.Min.x = ImMin(merge_clip_rect.Min.x, host_rect.Min.x);
-                if ((merge_group_n & 2) == 0 || !has_freeze_v)
-                    merge_clip_rect.Min.y = ImMin(merge_clip_rect.Min.y, host_rect.Min.y);
-                if ((merge_group_n & 1) != 0)
-                    merge_clip_rect.Max.x = ImMax(merge_clip_rect.Max.x, host_rect.Max.x);
-                if ((merge_group_n & 2) != 0 && (table->Flags & ImGuiTableFlags_NoHostExtendY) == 0)
-                    merge_clip_rect.Max.y = ImMax(merge_clip_rect.Max.y, host_rect.Max.y);
-                //GetForegroundDrawList()->AddRect(merge_group->ClipRect.Min, merge_group->ClipRect.Max, IM_COL32(255, 0, 0, 200), 0.0f, 0, 1.0f); // [DEBUG]
-                //GetForegroundDrawList()->AddLine(merge_group->ClipRect.Min, merge_clip_rect.Min, IM_COL32(255, 100, 0, 200));
-                //GetForegroundDrawList()->AddLine(merge_group->ClipRect.Max, merge_clip_rect.Max, IM_COL32(255, 100, 0, 200));
-                remaining_count -= merge_group->ChannelsCount;
-                for (int n = 0; n < (size_for_masks_bitarrays_one >> 2); n++)
-                    remaining_mask[n] &= ~merge_group->ChannelsMask[n];
-                for (int n = 0; n < splitter->_Count && merge_channels_count != 0; n++)
-                {
-                    // Copy + overwrite new clip rect
-                    if (!IM_BITARRAY_TESTBIT(merge_group->ChannelsMask, n))
-                        continue;
-                    IM_BITARRAY_CLEARBIT(merge_group->ChannelsMask, n);
-                    merge_channels_count--;
-
-                    ImDrawChannel* channel = &splitter->_Channels[n];
-                    IM_ASSERT(channel->_CmdBuffer.Size == 1 && merge_clip_rect.Contains(ImRect(channel->_CmdBuffer[0].ClipRect)));
-                    channel->_CmdBuffer[0].ClipRect = merge_clip_rect.ToVec4();
-                    memcpy(dst_tmp++, channel, sizeof(ImDrawChannel));
-                }
-            }
+    // 2. Overwrite ClipRect of merged channels
+    if (merge_group_mask == 0)
+    {
+        table->DrawChannelsMergeOrder.resize(0);
+        table->IsDrawChannelsMergeOrderReused = false;
+        return NULL;
+    }
+    //ImRect host_rect = (table->InnerWindow == table->OuterWindow) ? table->InnerClipRect : table->HostClipRect;
+    ImRect host_rect = table->HostClipRect;
+    ImRect merge_clip_rects_by_rank[TABLE_MERGE_RANK_UNMERGED];
+    for (int merge_group_n = 0; merge_group_n < IM_ARRAYSIZE(merge_groups); merge_group_n++)
+    {
+        if (merge_groups[merge_group_n].ChannelsCount == 0)
+            continue;
+        MergeGroup* merge_group = &merge_groups[merge_group_n];
+        ImRect merge_clip_rect = merge_group->ClipRect;
+
+        // Extend outer-most clip limits to match those of host, so draw calls can be merged even if
+        // outer-most columns have some outer padding offsetting them from their parent ClipRect.
+        // The principal cases this is dealing with are:
+        // - On a same-window table (not scrolling = single group), all fitting columns ClipRect -> will extend and match host ClipRect -> will merge
+        // - Columns can use padding and have left-most ClipRect.Min.x and right-most ClipRect.Max.x != from host ClipRect -> will extend and match host ClipRect -> will merge
+        // FIXME-TABLE FIXME-WORKRECT: We are wasting a merge opportunity on tables without scrolling if column doesn't fit
+        // within host clip rect, solely because of the half-padding difference between window->WorkRect and window->InnerClipRect.
+        if ((merge_group_n & 1) == 0 || !has_freeze_h)
+            merge_clip_rect.Min.x = ImMin(merge_clip_rect.Min.x, host_rect.Min.x);
+        if ((merge_group_n & 2) == 0 || !has_freeze_v)
+            merge_clip_rect.Min.y = ImMin(merge_clip_rect.Min.y, host_rect.Min.y);
+        if ((merge_group_n & 1) != 0)
+            merge_clip_rect.Max.x = ImMax(merge_clip_rect.Max.x, host_rect.Max.x);
+        if ((merge_group_n & 2) != 0 && (table->Flags & ImGuiTableFlags_NoHostExtendY) == 0)
+            merge_clip_rect.Max.y = ImMax(merge_clip_rect.Max.y, host_rect.Max.y);
+        //GetForegroundDrawList()->AddRect(merge_group->ClipRect.Min, merge_group->ClipRect.Max, IM_COL32(255, 0, 0, 200), 0.0f, 0, 1.0f); // [DEBUG]
+        //GetForegroundDrawList()->AddLine(merge_group->ClipRect.Min, merge_clip_rect.Min, IM_COL32(255, 100, 0, 200));
+        //GetForegroundDrawList()->AddLine(merge_group->ClipRect.Max, merge_clip_rect.Max, IM_COL32(255, 100, 0, 200));
+        merge_clip_rects_by_rank[TableMergeGroupToRank(merge_group_n)] = merge_clip_rect;
+    }
 
-            // Make sure Bg2DrawChannelUnfrozen appears in the middle of our groups (whereas Bg0/Bg1 and Bg2 frozen are fixed to 0 and 1)
-            if (merge_group_n == 1 && has_freeze_v)
-                memcpy(dst_tmp++, &splitter->_Channels[table->Bg2DrawChannelUnfrozen], sizeof(ImDrawChannel));
-        }
+    // We skip channel 0 (Bg0/Bg1) and 1 (Bg2 frozen) from the shuffling since they won't move - see channels allocation in TableSetupDrawChannels().
+    const int LEADING_DRAW_CHANNELS = 2;
+    IM_ASSERT(has_freeze_v == false || table->Bg2DrawChannelUnfrozen != TABLE_DRAW_CHANNEL_BG2_FROZEN);
+    if (has_freeze_v)
+        channels_rank[table->Bg2DrawChannelUnfrozen] = TABLE_MERGE_RANK_BG2_UNFROZEN; // Make sure Bg2DrawChannelUnfrozen appears in the middle of our groups
+    for (int channel_n = LEADING_DRAW_CHANNELS; channel_n < channels_count; channel_n++)
+    {
+        const int rank = channels_rank[channel_n];
+        if (rank == TABLE_MERGE_RANK_UNMERGED || rank == TABLE_MERGE_RANK_BG2_UNFROZEN)
+            continue;
+        ImDrawChannel* channel = &splitter->_Channels[channel_n];
+        IM_ASSERT(channel->_CmdBuffer.Size == 1 && merge_clip_rects_by_rank[rank].Contains(ImRect(channel->_CmdBuffer[0].ClipRect)));
+        channel->_CmdBuffer[0].ClipRect = merge_clip_rects_by_rank[rank].ToVec4();
+    }
 
-        // Append unmergeable channels that we didn't reorder at the end of the list
-        for (int n = 0; n < splitter->_Count && remaining_count != 0; n++)
-        {
-            if (!IM_BITARRAY_TESTBIT(remaining_mask, n))
-                continue;
-            ImDrawChannel* channel = &splitter->_Channels[n];
-            memcpy(dst_tmp++, channel, sizeof(ImDrawChannel));
-            remaining_count--;
-        }
-        IM_ASSERT(dst_tmp == g.DrawChannelsTempMergeBuffer.Data + g.DrawChannelsTempMergeBuffer.Size);
-        memcpy(splitter->_Channels.Data + LEADING_DRAW_CHANNELS, g.DrawChannelsTempMergeBuffer.Data, (splitter->_Count - LEADING_DRAW_CHANNELS) * sizeof(ImDrawChannel));
+    // 3. Build channels order (stable counting sort by rank), unless the one from previous frame is still valid.
+    ImVector<int>& order = table->DrawChannelsMergeOrder;
+    table->IsDrawChannelsMergeOrderReused = (order.Size == channels_count && memcmp(table->DrawChannelsMergeRanks.Data, channels_rank, (size_t)channels_count) == 0);
+    if (table->IsDrawChannelsMergeOrderReused)
+        return order.Data;
+    table->DrawChannelsMergeRanks.resize(channels_count);
+    memcpy(table->DrawChannelsMergeRanks.Data, channels_rank, (size_t)channels_count);
+
+    int rank_offsets[TABLE_MERGE_RANK_UNMERGED + 1] = {};
+    for (int channel_n = LEADING_DRAW_CHANNELS; channel_n < channels_count; channel_n++)
+        rank_offsets[channels_rank[channel_n]]++;
+    for (int rank = 0, offset = LEADING_DRAW_CHANNELS; rank <= TABLE_MERGE_RANK_UNMERGED; rank++)
+    {
+        const int rank_count = rank_offsets[rank];
+        rank_offsets[rank] = offset;
+        offset += rank_count;
     }
+    order.resize(channels_count);
+    for (int channel_n = 0; channel_n < LEADING_DRAW_CHANNELS; channel_n++)
+        order[channel_n] = channel_n;
+    for (int channel_n = LEADING_DRAW_CHANNELS; channel_n < channels_count; channel_n++)
+        order[rank_offsets[channels_rank[channel_n]]++] = channel_n;
+    return order.Data;
 }
 
 static ImU32 TableGetColumnBorderCol(ImGuiTable* table, int order_n, int column_n)
@@ -2870,6 +2930,7 @@ void ImGui::TableDrawBorders(ImGuiTable* table)
 // - TableSetColumnSortDirection() [Internal]
 // - TableSortSpecsSanitize() [Internal]
 // - TableSortSpecsBuild() [Internal]
+// - ImGuiTableSorter
 //-------------------------------------------------------------------------
 
 // Return NULL if no sort specs (most often when ImGuiTableFlags_Sortable is not set)
@@ -3056,6 +3117,386 @@ void ImGui::TableSortSpecsBuild(ImGuiTable* table)
     table->SortSpecs.SpecsCount = table->SortSpecsCount;
 }
 
+// Convert a value to an unsigned integer with the same ordering, so it can be radix sorted (adding 0.0 turns -0.0 into +0.0 so they compare equal)
+static inline ImU32 TableSorterOrderedBits(ImS32 v)     { return (ImU32)v ^ 0x80000000u; }
+static inline ImU32 TableSorterOrderedBits(ImU32 v)     { return v; }
+static inline ImU64 TableSorterOrderedBits(ImS64 v)     { return (ImU64)v ^ ((ImU64)1 << 63); }
+static inline ImU64 TableSorterOrderedBits(ImU64 v)     { return v; }
+static inline ImU32 TableSorterOrderedBits(float v)     { ImU32 u; v += 0.0f; memcpy(&u, &v, sizeof(u)); return (u & 0x80000000u) ? ~u : (u | 0x80000000u); }
+static inline ImU64 TableSorterOrderedBits(double v)    { ImU64 u; v += 0.0; memcpy(&u, &v, sizeof(u)); return (u & ((ImU64)1 << 63)) ? ~u : (u | ((ImU64)1 << 63)); }
+
+// Read keys of rows in their current order. 'TPROMOTED' is the type used to convert a small type (e.g. ImS8 -> ImS32).
+// Descending order is obtained by inverting all bits of the key, which preserves stability.
+template<typename T, typename TPROMOTED, typename TKEY>
+static void TableSorterGatherKeys(TKEY* out_keys, const int* rows, int rows_count, const void* data, size_t stride, TKEY xor_mask)
+{
+    for (int n = 0; n < rows_count; n++)
+        out_keys[n] = (TKEY)TableSorterOrderedBits((TPROMOTED)*(const T*)(const void*)((const char*)data + stride * (size_t)rows[n])) ^ xor_mask;
+}
+
+// Stable LSD radix sort of (key, row) pairs, 8 bits at a time. Histograms for all digits are built in a single read,
+// and digits which are identical for all keys (e.g. high bits of small values) are skipped.
+template<typename TKEY>
+static void TableSorterRadixSort(TKEY* keys, int* rows, TKEY* tmp_keys, int* tmp_rows, int count)
+{
+    const int DIGITS = (int)sizeof(TKEY);
+    ImU32 histograms[sizeof(TKEY)][256];
+    memset(histograms, 0, sizeof(histograms));
+    for (int n = 0; n < count; n++)
+    {
+        const TKEY key = keys[n];
+        for (int digit = 0; digit < DIGITS; digit++)
+            histograms[digit][(key >> (digit * 8)) & 0xFF]++;
+    }
+
+    int* rows_out = rows;
+    for (int digit = 0; digit < DIGITS; digit++)
+    {
+        ImU32* histogram = histograms[digit];
+        const int shift = digit * 8;
+        if (histogram[(keys[0] >> shift) & 0xFF] == (ImU32)count)
+            continue;
+        ImU32 offset = 0;
+        for (int bucket = 0; bucket < 256; bucket++)
+        {
+            const ImU32 bucket_count = histogram[bucket];
+            histogram[bucket] = offset;
+            offset += bucket_count;
+        }
+        for (int n = 0; n < count; n++)
+        {
+            const ImU32 dst = histogram[(keys[n] >> shift) & 0xFF]++;
+            tmp_keys[dst] = keys[n];
+            tmp_rows[dst] = rows[n];
+        }
+        ImSwap(keys, tmp_keys);
+        ImSwap(rows, tmp_rows);
+    }
+    if (rows != rows_out)
+        memcpy(rows_out, rows, (size_t)count * sizeof(int));
+}
+
+// Read keys of rows [rows_begin, rows_end) in their current order, into 'out_keys' (ImU32 or ImU64 array, depending on data type)
+static void TableSorterGatherKeysRange(const ImGuiTableSorter* sorter, const ImGuiTableSorterKey* key, bool descending, void* out_keys, const int* rows, int rows_begin, int rows_end)
+{
+    const ImU32 mask32 = descending ? ~(ImU32)0 : 0;
+    const ImU64 mask64 = descending ? ~(ImU64)0 : 0;
+    ImU32* k32 = (ImU32*)out_keys + rows_begin;
+    ImU64* k64 = (ImU64*)out_keys + rows_begin;
+    const int* r = rows + rows_begin;
+    const int n = rows_end - rows_begin;
+    switch (key->DataType)
+    {
+    case ImGuiDataType_S8:      TableSorterGatherKeys<ImS8,  ImS32, ImU32>(k32, r, n, key->Data, key->Stride, mask32); break;
+    case ImGuiDataType_U8:      TableSorterGatherKeys<ImU8,  ImU32, ImU32>(k32, r, n, key->Data, key->Stride, mask32); break;
+    case ImGuiDataType_S16:     TableSorterGatherKeys<ImS16, ImS32, ImU32>(k32, r, n, key->Data, key->Stride, mask32); break;
+    case ImGuiDataType_U16:     TableSorterGatherKeys<ImU16, ImU32, ImU32>(k32, r, n, key->Data, key->Stride, mask32); break;
+    case ImGuiDataType_S32:     TableSorterGatherKeys<ImS32, ImS32, ImU32>(k32, r, n, key->Data, key->Stride, mask32); break;
+    case ImGuiDataType_U32:     TableSorterGatherKeys<ImU32, ImU32, ImU32>(k32, r, n, key->Data, key->Stride, mask32); break;
+    case ImGuiDataType_S64:     TableSorterGatherKeys<ImS64, ImS64, ImU64>(k64, r, n, key->Data, key->Stride, mask64); break;
+    case ImGuiDataType_U64:     TableSorterGatherKeys<ImU64, ImU64, ImU64>(k64, r, n, key->Data, key->Stride, mask64); break;
+    case ImGuiDataType_Float:   TableSorterGatherKeys<float, float, ImU32>(k32, r, n, key->Data, key->Stride, mask32); break;
+    case ImGuiDataType_Double:  TableSorterGatherKeys<double, double, ImU64>(k64, r, n, key->Data, key->Stride, mask64); break;
+    case ImGuiDataType_Bool:    TableSorterGatherKeys<bool,  ImU32, ImU32>(k32, r, n, key->Data, key->Stride, mask32); break;
+    case ImGuiDataType_String:  TableSorterGatherKeys<ImU32, ImU32, ImU32>(k32, r, n, &sorter->StringRanks.Data[key->RanksOffset], sizeof(ImU32), mask32); break;
+    default: IM_ASSERT(0); break;
+    }
+}
+
+// Parallel version of TableSorterGatherKeysRange() + TableSorterRadixSort(), used with ImGuiTableSorter::ParallelFor.
+// Rows are split in contiguous chunks. For each digit, each chunk computes its own histogram, and the offsets are laid out
+// bucket-major then chunk-major, so chunks can scatter independently while keeping the sort stable.
+static const int TABLE_SORTER_PARALLEL_MIN_ROWS = 100000;   // Below this, sort on calling thread
+static const int TABLE_SORTER_PARALLEL_MIN_CHUNK_ROWS = 16384;
+static const int TABLE_SORTER_PARALLEL_MAX_CHUNKS = 16;
+
+enum ImGuiTableSorterJobStage
+{
+    ImGuiTableSorterJobStage_GatherAndCount,    // Gather keys, build histograms for all digits
+    ImGuiTableSorterJobStage_Count,             // Build histogram for current digit (after a scatter)
+    ImGuiTableSorterJobStage_Scatter,           // Scatter keys and rows according to offsets for current digit
+};
+
+template<typename TKEY>
+struct ImGuiTableSorterJobsData
+{
+    const ImGuiTableSorter*     Sorter;
+    const ImGuiTableSorterKey*  Key;
+    bool                        Descending;
+    ImGuiTableSorterJobStage    Stage;
+    int                         Digit;
+    int                         Count;
+    int                         ChunksCount;
+    TKEY*                       Keys;
+    int*                        Rows;
+    TKEY*                       TmpKeys;
+    int*                        TmpRows;
+    ImU32*                      Histograms;     // [ChunksCount][sizeof(TKEY)][256]
+
+    int     GetChunkBegin(int chunk_n) const    { return (int)(((ImS64)Count * chunk_n) / ChunksCount); }
+    ImU32*  GetHistogram(int chunk_n, int digit){ return Histograms + (chunk_n * (int)sizeof(TKEY) + digit) * 256; }
+};
+
+template<typename TKEY>
+static void TableSorterRadixSortJob(int chunk_n, void* job_data)
+{
+    ImGuiTableSorterJobsData<TKEY>* data = (ImGuiTableSorterJobsData<TKEY>*)job_data;
+    const int n_begin = data->GetChunkBegin(chunk_n);
+    const int n_end = data->GetChunkBegin(chunk_n + 1);
+    const TKEY* keys = data->Keys;
+    const int shift = data->Digit * 8;
+    if (data->Stage == ImGuiTableSorterJobStage_GatherAndCount)
+    {
+        TableSorterGatherKeysRange(data->Sorter, data->Key, data->Descending, data->Keys, data->Rows, n_begin, n_end);
+        ImU32* histograms = data->GetHistogram(chunk_n, 0);
+        memset(histograms, 0, sizeof(TKEY) * 256 * sizeof(ImU32));
+        for (int n = n_begin; n < n_end; n++)
+            for (int digit = 0; digit < (int)sizeof(TKEY); digit++)
+                histograms[digit * 256 + ((keys[n] >> (digit * 8)) & 0xFF)]++;
+    }
+    else if (data->Stage == ImGuiTableSorterJobStage_Count)
+    {
+        ImU32* histogram = data->GetHistogram(chunk_n, data->Digit);
+        memset(histogram, 0, 256 * sizeof(ImU32));
+        for (int n = n_begin; n < n_end; n++)
+            histogram[(keys[n] >> shift) & 0xFF]++;
+    }
+    else if (data->Stage == ImGuiTableSorterJobStage_Scatter)
+    {
+        ImU32* offsets = data->GetHistogram(chunk_n, data->Digit);
+        const int* rows = data->Rows;
+        for (int n = n_begin; n < n_end; n++)
+        {
+            const ImU32 dst = offsets[(keys[n] >> shift) & 0xFF]++;
+            data->TmpKeys[dst] = keys[n];
+            data->TmpRows[dst] = rows[n];
+        }
+    }
+}
+
+template<typename TKEY>
+static void TableSorterRadixSortParallel(const ImGuiTableSorter* sorter, const ImGuiTableSorterKey* key, bool descending, TKEY* keys, int* rows, TKEY* tmp_keys, int* tmp_rows, int count)
+{
+    const int DIGITS = (int)sizeof(TKEY);
+    ImVector<ImU32> histograms;
+    ImGuiTableSorterJobsData<TKEY> data;
+    data.Sorter = sorter;
+    data.Key = key;
+    data.Descending = descending;
+    data.Count = count;
+    data.ChunksCount = ImClamp(count / TABLE_SORTER_PARALLEL_MIN_CHUNK_ROWS, 1, TABLE_SORTER_PARALLEL_MAX_CHUNKS);
+    data.Keys = keys;
+    data.Rows = rows;
+    data.TmpKeys = tmp_keys;
+    data.TmpRows = tmp_rows;
+    histograms.resize(data.ChunksCount * DIGITS * 256);
+    data.Histograms = histograms.Data;
+    data.Stage = ImGuiTableSorterJobStage_GatherAndCount;
+    data.Digit = 0;
+    sorter->ParallelFor(data.ChunksCount, TableSorterRadixSortJob<TKEY>, &data, sorter->ParallelForUserData);
+
+    bool histograms_valid = true; // Histograms of all chunks match current layout of rows
+    for (int digit = 0; digit < DIGITS; digit++)
+    {
+        // Skip digits which are identical for all keys (first-pass histograms summed over chunks)
+        const int bucket0 = (int)((data.Keys[0] >> (digit * 8)) & 0xFF);
+        ImU32 bucket0_count = 0;
+        for (int chunk_n = 0; chunk_n < data.ChunksCount; chunk_n++)
+            bucket0_count += histograms[(chunk_n * DIGITS + digit) * 256 + bucket0];
+        if (bucket0_count == (ImU32)count)
+            continue;
+        data.Digit = digit;
+        if (!histograms_valid)
+        {
+            data.Stage = ImGuiTableSorterJobStage_Count;
+            sorter->ParallelFor(data.ChunksCount, TableSorterRadixSortJob<TKEY>, &data, sorter->ParallelForUserData);
+        }
+
+        // Convert counts to offsets: all chunks for bucket 0, then all chunks for bucket 1, etc.
+        ImU32 offset = 0;
+        for (int bucket = 0; bucket < 256; bucket++)
+            for (int chunk_n = 0; chunk_n < data.ChunksCount; chunk_n++)
+            {
+                ImU32* p = &data.GetHistogram(chunk_n, digit)[bucket];
+                const ImU32 bucket_count = *p;
+                *p = offset;
+                offset += bucket_count;
+            }
+        data.Stage = ImGuiTableSorterJobStage_Scatter;
+        sorter->ParallelFor(data.ChunksCount, TableSorterRadixSortJob<TKEY>, &data, sorter->ParallelForUserData);
+        ImSwap(data.Keys, data.TmpKeys);
+        ImSwap(data.Rows, data.TmpRows);
+        histograms_valid = false;
+    }
+    if (data.Rows != rows)
+        memcpy(rows, data.Rows, (size_t)count * sizeof(int));
+}
+
+struct ImGuiTableSorterStringEntry
+{
+    const char* Str;
+    int         Row;
+};
+
+static int IMGUI_CDECL TableSorterStringEntryComparer(const void* lhs, const void* rhs)
+{
+    return strcmp(((const ImGuiTableSorterStringEntry*)lhs)->Str, ((const ImGuiTableSorterStringEntry*)rhs)->Str);
+}
+
+// Stable sort of 'rows' according to a single sort spec
+static void TableSorterSortPass(ImGuiTableSorter* sorter, const ImGuiTableColumnSortSpecs* spec, ImVector<int>* rows, ImVector<int>* tmp_rows, ImVector<ImU32>* keys32, ImVector<ImU64>* keys64)
+{
+    const int rows_count = rows->Size;
+    ImGuiTableSorterKey* key = (spec->ColumnIndex < sorter->Keys.Size) ? &sorter->Keys[spec->ColumnIndex] : NULL;
+    if (key == NULL || key->DataType == -1)
+    {
+        IM_ASSERT_USER_ERROR(0, "ImGuiTableSorter: missing call to SetColumnKey() for a sorted column!");
+        return;
+    }
+    const bool descending = (spec->SortDirection == ImGuiSortDirection_Descending);
+    const bool is_64 = (key->DataType == ImGuiDataType_S64 || key->DataType == ImGuiDataType_U64 || key->DataType == ImGuiDataType_Double);
+    tmp_rows->resize(rows_count);
+    if (is_64)
+        keys64->resize(rows_count * 2);
+    else
+        keys32->resize(rows_count * 2);
+
+    if (key->DataType == ImGuiDataType_String && key->RanksOffset == -1)
+    {
+        // Convert strings to ranks (equal strings share a rank) once: this is the only comparison based sort.
+        ImVector<ImGuiTableSorterStringEntry> entries;
+        entries.resize(rows_count);
+        for (int n = 0; n < rows_count; n++)
+        {
+            const char* str = *(const char* const*)(const void*)((const char*)key->Data + key->Stride * (size_t)n);
+            entries[n].Str = str ? str : "";
+            entries[n].Row = n;
+        }
+        ImQsort(entries.Data, (size_t)entries.Size, sizeof(entries[0]), TableSorterStringEntryComparer);
+        key->RanksOffset = sorter->StringRanks.Size;
+        sorter->StringRanks.resize(sorter->StringRanks.Size + rows_count);
+        ImU32* ranks = &sorter->StringRanks[key->RanksOffset];
+        ImU32 rank = 0;
+        for (int n = 0; n < rows_count; n++)
+        {
+            if (n > 0 && strcmp(entries[n - 1].Str, entries[n].Str) != 0)
+                rank++;
+            ranks[entries[n].Row] = rank;
+        }
+    }
+
+    ImU32* k32 = keys32->Data;
+    ImU64* k64 = keys64->Data;
+    if (sorter->ParallelFor != NULL && rows_count >= TABLE_SORTER_PARALLEL_MIN_ROWS)
+    {
+        if (is_64)
+            TableSorterRadixSortParallel<ImU64>(sorter, key, descending, k64, rows->Data, k64 + rows_count, tmp_rows->Data, rows_count);
+        else
+            TableSorterRadixSortParallel<ImU32>(sorter, key, descending, k32, rows->Data, k32 + rows_count, tmp_rows->Data, rows_count);
+        return;
+    }
+    TableSorterGatherKeysRange(sorter, key, descending, is_64 ? (void*)k64 : (void*)k32, rows->Data, 0, rows_count);
+    if (is_64)
+        TableSorterRadixSort<ImU64>(k64, rows->Data, k64 + rows_count, tmp_rows->Data, rows_count);
+    else
+        TableSorterRadixSort<ImU32>(k32, rows->Data, k32 + rows_count, tmp_rows->Data, rows_count);
+}
+
+void ImGuiTableSorter::SetColumnKey(int column_index, ImGuiDataType data_type, const void* p_data, size_t stride)
+{
+    IM_ASSERT(column_index >= 0 && column_index < IMGUI_TABLE_MAX_COLUMNS);
+    IM_ASSERT(data_type >= 0 && data_type < ImGuiDataType_COUNT);
+    while (Keys.Size <= column_index)
+    {
+        ImGuiTableSorterKey unset_key = { -1, NULL, 0, -1 };
+        Keys.push_back(unset_key);
+    }
+    ImGuiTableSorterKey* key = &Keys[column_index];
+    if (key->DataType == data_type && key->Data == p_data && key->Stride == stride)
+        return;
+    key->DataType = data_type;
+    key->Data = p_data;
+    key->Stride = stride;
+    ClearCache();
+}
+
+void ImGuiTableSorter::ClearCache()
+{
+    CachedSpecs.resize(0);
+    CachedPasses.resize(0);
+    StringRanks.resize(0);
+    for (ImGuiTableSorterKey& key : Keys)
+        key.RanksOffset = -1;
+    RowsCount = -1;
+}
+
+void ImGuiTableSorter::Sort(const ImGuiTableSortSpecs* sort_specs, int rows_count)
+{
+    IM_ASSERT(rows_count >= 0);
+    const bool cache_valid = (RowsCount == rows_count && Indices.Size == rows_count);
+    if (!cache_valid)
+    {
+        ClearCache();
+        RowsCount = rows_count;
+    }
+    const int specs_count = sort_specs ? sort_specs->SpecsCount : 0;
+
+    // Find how many of the lowest priority specs were already applied by the previous call, in the same order.
+    // e.g. previous specs [A,B,C] + new specs [D,B,C] -> we can start from the rows sorted by [B,C] and only apply D.
+    int reuse_count = 0;
+    while (reuse_count < specs_count && reuse_count < CachedSpecs.Size)
+    {
+        const ImGuiTableColumnSortSpecs* new_spec = &sort_specs->Specs[specs_count - 1 - reuse_count];
+        const ImGuiTableColumnSortSpecs* old_spec = &CachedSpecs[CachedSpecs.Size - 1 - reuse_count];
+        if (new_spec->ColumnIndex != old_spec->ColumnIndex || new_spec->SortDirection != old_spec->SortDirection)
+            break;
+        reuse_count++;
+    }
+    if (cache_valid && reuse_count == specs_count && reuse_count == CachedSpecs.Size)
+        return;
+
+    // Retrieve starting point (rows sorted by the 'reuse_count' lowest priority specs)
+    ImVector<int> rows;
+    if (reuse_count == 0)
+    {
+        rows.resize(rows_count);
+        for (int n = 0; n < rows_count; n++)
+            rows[n] = n;
+    }
+    else if (reuse_count == CachedSpecs.Size)
+    {
+        rows.swap(Indices);
+    }
+    else
+    {
+        rows.resize(rows_count);
+        if (rows_count > 0)
+            memcpy(rows.Data, CachedPasses.Data + (reuse_count - 1) * rows_count, (size_t)rows_count * sizeof(int));
+    }
+    const int prev_specs_count = CachedSpecs.Size;
+    CachedSpecs.resize(specs_count);
+    if (specs_count > 0)
+        memcpy(CachedSpecs.Data, sort_specs->Specs, (size_t)specs_count * sizeof(ImGuiTableColumnSortSpecs));
+    CachedPasses.resize(ImMax(specs_count - 1, 0) * rows_count);
+    if (rows_count > 0 && reuse_count > 0 && reuse_count < specs_count && reuse_count == prev_specs_count)
+        memcpy(CachedPasses.Data + (reuse_count - 1) * rows_count, rows.Data, (size_t)rows_count * sizeof(int)); // Previous final result becomes an intermediate result
+
+    // Apply remaining passes, from lowest to highest priority
+    ImVector<int> tmp_rows;
+    ImVector<ImU32> keys32;
+    ImVector<ImU64> keys64;
+    for (int pass_n = reuse_count; pass_n < specs_count; pass_n++)
+    {
+        if (rows_count > 1)
+            TableSorterSortPass(this, &CachedSpecs[specs_count - 1 - pass_n], &rows, &tmp_rows, &keys32, &keys64);
+
+        // Keep intermediate results, so a later change of higher priority specs can restart from here
+        if (pass_n + 1 < specs_count && rows_count > 0)
+            memcpy(CachedPasses.Data + pass_n * rows_count, rows.Data, (size_t)rows_count * sizeof(int));
+    }
+    Indices.swap(rows);
+}
+
 //-------------------------------------------------------------------------
 // [SECTION] Tables: Headers
 //-------------------------------------------------------------------------
@@ -3079,7 +3520,12 @@ float ImGui::TableGetHeaderRowHeight()
     for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
         if (IM_BITARRAY_TESTBIT(table->EnabledMaskByIndex, column_n))
             if ((table->Columns[column_n].Flags & ImGuiTableColumnFlags_NoHeaderLabel) == 0)
-                row_height = ImMax(row_height, CalcTextSize(TableGetColumnName(table, column_n)).y);
+            {
+                // Single-line labels are always FontSize tall: only measure multi-line ones, which matters for tables with many columns.
+                const char* name = TableGetColumnName(table, column_n);
+                if (strchr(name, '\n') != NULL)
+                    row_height = ImMax(row_height, CalcTextSize(name).y);
+            }
     return row_height + g.Style.CellPadding.y * 2.0f;
 }
 
@@ -3124,11 +3570,11 @@ void ImGui::TableHeadersRow()
     if (table->HostSkipItems) // Merely an optimization, you may skip in your own code.
         return;
 
+    // Only visit columns requesting output: other columns would be skipped anyway.
     const int columns_count = TableGetColumnCount();
-    for (int column_n = 0; column_n < columns_count; column_n++)
+    while (TableNextVisibleColumn())
     {
-        if (!TableSetColumnIndex(column_n))
-            continue;
+        const int column_n = TableGetColumnIndex();
 
         // Push an id to allow empty/unnamed headers. This is also idiomatic as it ensure there is a consistent ID path to access columns (for e.g. automation)
         const char* name = (TableGetColumnFlags(column_n) & ImGuiTableColumnFlags_NoHeaderLabel) ? "" : TableGetColumnName(column_n);
@@ -3137,6 +3583,10 @@ void ImGui::TableHeadersRow()
         PopID();
     }
 
+    // End on the last column, as iterating all columns would, so a following TableNextColumn() wraps to the next row.
+    if (table->CurrentColumn != columns_count - 1)
+        TableSetColumnIndex(columns_count - 1);
+
     // Allow opening popup from the right-most section after the last column.
     ImVec2 mouse_pos = ImGui::GetMousePos();
     if (IsMouseReleased(1) && TableGetHoveredColumn() == columns_count)
@@ -3964,6 +4414,8 @@ void ImGui::TableGcCompactTransientBuffers(ImGuiTable* table)
     table->SortSpecsMulti.clear();
     table->IsSortSpecsDirty = true; // FIXME: In theory shouldn't have to leak into user performing a sort on resume.
     table->ColumnsNames.clear();
+    table->DrawChannelsMergeOrder.clear();
+    table->DrawChannelsMergeRanks.clear();
     table->MemoryCompacted = true;
     for (int n = 0; n < table->ColumnsCount; n++)
         table->Columns[n].NameOffset = -1;
@@ -4041,6 +4493,8 @@ void ImGui::DebugNodeTable(ImGuiTable* table)
     BulletText("CellPaddingX: %.1f, CellSpacingX: %.1f/%.1f, OuterPaddingX: %.1f", table->CellPaddingX, table->CellSpacingX1, table->CellSpacingX2, table->OuterPaddingX);
     BulletText("HoveredColumnBody: %d, HoveredColumnBorder: %d", table->HoveredColumnBody, table->HoveredColumnBorder);
     BulletText("ResizedColumn: %d, ReorderColumn: %d, HeldHeaderColumn: %d", table->ResizedColumn, table->ReorderColumn, table->HeldHeaderColumn);
+    BulletText("ColumnsEnabledCount: %d, ColumnsVisibleCount: %d, OutputColumnsCount: %d", table->ColumnsEnabledCount, table->ColumnsVisibleCount, table->OutputColumnsCount);
+    BulletText("DrawChannels merge: %.3f ms, %d channels, order %s", table->DrawChannelsMergeTime * 1000.0f, table->DrawChannelsMergeOrder.Size, table->DrawChannelsMergeOrder.Size == 0 ? "unchanged" : table->IsDrawChannelsMergeOrderReused ? "reused" : "rebuilt");
     for (int n = 0; n < table->InstanceCurrent + 1; n++)
     {
         ImGuiTableInstanceData* table_instance = TableGetInstanceData(table, n);
@@ -155,6 +155,7 @@ static ImVec2   InputTextCalcTextSize(ImGuiContext* ctx, const char* text_begin,
 // - LabelTextV()
 // - BulletText()
 // - BulletTextV()
+// - TextViewer() [Internal]
 //-------------------------------------------------------------------------
 
 void ImGui::TextEx(const char* text, const char* text_end, ImGuiTextFlags flags)
@@ -451,6 +452,95 @@ void ImGui::BulletTextV(const char* fmt, va_list args)
     RenderText(bb.Min + ImVec2(g.FontSize + style.FramePadding.x * 2, 0.0f), text_begin, text_end, false);
 }
 
+// Scrolling child window displaying a large read-only text buffer, one item per line. See ImGuiTextViewer.
+// - Only visible lines are submitted (using ImGuiListClipper).
+// - Past a certain total height, float coordinates can't accurately position lines anymore (e.g. 10M lines = 170M pixels).
+//   We then switch to "virtual scrolling": window content is limited to TEXT_VIEWER_VIRTUAL_HEIGHT pixels, the scrollbar position is
+//   proportional to viewer->FirstLine, and relative scrolling (mouse wheel, navigation) is converted to lines.
+static const float TEXT_VIEWER_VIRTUAL_HEIGHT = (float)(1 << 20);
+
+void ImGui::TextViewer(const char* str_id, ImGuiTextViewer* viewer, const ImVec2& size_arg)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiTextIndex& index = viewer->Index;
+
+    // Index new text (time-sliced)
+    if (viewer->TextSize < index.EndOffset)
+        index.clear();
+    const int prev_lines_count = index.size();
+    if (index.EndOffset < viewer->TextSize)
+    {
+        const int index_end = (int)ImMin((ImS64)viewer->TextSize, (ImS64)index.EndOffset + ImMax(viewer->IndexBytesPerFrame, 1));
+        index.append(viewer->Text, index.EndOffset, index_end);
+    }
+    const int lines_count = index.size();
+    const bool auto_scroll = viewer->AutoScroll && prev_lines_count > 0 && lines_count != prev_lines_count && !viewer->IsIndexing(); // Only follow text appended after initial indexing
+
+    if (!BeginChild(str_id, size_arg, ImGuiChildFlags_None, ImGuiWindowFlags_HorizontalScrollbar))
+    {
+        EndChild();
+        return;
+    }
+    ImGuiWindow* window = g.CurrentWindow;
+    const float line_height = GetTextLineHeightWithSpacing();
+    const bool virtual_scroll = (lines_count * line_height > TEXT_VIEWER_VIRTUAL_HEIGHT);
+    const bool was_at_bottom = (window->Scroll.y >= window->ScrollMax.y);
+
+    if (!virtual_scroll)
+    {
+        if (viewer->VirtualScroll)
+            SetScrollY((float)(viewer->FirstLine * line_height));
+        viewer->VirtualScroll = false;
+
+        ImGuiListClipper clipper;
+        clipper.Begin(lines_count, line_height);
+        while (clipper.Step())
+            for (int line_no = clipper.DisplayStart; line_no < clipper.DisplayEnd; line_no++)
+                TextUnformatted(index.get_line_begin(viewer->Text, line_no), index.get_line_end(viewer->Text, line_no));
+        clipper.End();
+
+        if (auto_scroll && was_at_bottom)
+            SetScrollHereY(1.0f);
+        EndChild();
+        return;
+    }
+
+    // Virtual scrolling: update FirstLine from scrollbar interaction, or from relative scrolling since last frame
+    const float visible_height = ImMax(window->InnerRect.GetHeight() - window->WindowPadding.y * 2.0f, line_height);
+    const double lines_max = ImMax(lines_count - (double)(visible_height / line_height), 0.0);
+    const float scroll_max = (window->ScrollMax.y > 0.0f) ? window->ScrollMax.y : ImMax(TEXT_VIEWER_VIRTUAL_HEIGHT - visible_height, 1.0f);
+    if (!viewer->VirtualScroll)
+        viewer->FirstLine = window->Scroll.y / line_height;
+    else if (g.ActiveId == GetWindowScrollbarID(window, ImGuiAxis_Y))
+        viewer->FirstLine = (double)(window->Scroll.y / scroll_max) * lines_max;
+    else
+        viewer->FirstLine += (window->Scroll.y - viewer->LastScrollY) / line_height;
+
+    // Mouse wheel: scroll by lines ourselves, as window scrolling would be clamped near edges and scaled by the scrollbar mapping.
+    if (IsWindowHovered() && !g.IO.KeyCtrl && !g.IO.KeyShift)
+    {
+        if (TestKeyOwner(ImGuiKey_MouseWheelY, window->ID) && g.IO.MouseWheel != 0.0f)
+            viewer->FirstLine -= g.IO.MouseWheel * ImTrunc(ImMin(5 * window->FontRefSize, window->InnerRect.GetHeight() * 0.67f)) / line_height;
+        SetKeyOwner(ImGuiKey_MouseWheelY, window->ID);
+    }
+    if (auto_scroll && was_at_bottom)
+        viewer->FirstLine = lines_max;
+    viewer->FirstLine = ImClamp(viewer->FirstLine, 0.0, lines_max);
+    viewer->VirtualScroll = true;
+
+    // Submit visible lines, positioned relative to the visible area
+    const int line_first = (int)viewer->FirstLine;
+    window->DC.CursorPos.y = window->InnerRect.Min.y + window->WindowPadding.y - (float)(viewer->FirstLine - line_first) * line_height;
+    for (int line_no = line_first; line_no < lines_count && window->DC.CursorPos.y < window->InnerRect.Max.y; line_no++)
+        TextUnformatted(index.get_line_begin(viewer->Text, line_no), index.get_line_end(viewer->Text, line_no));
+
+    // Fixed content height (lines only contribute to width), scrollbar position reflects FirstLine
+    window->DC.CursorMaxPos.y = window->DC.CursorStartPos.y + TEXT_VIEWER_VIRTUAL_HEIGHT;
+    viewer->LastScrollY = (lines_max > 0.0) ? ImRound64((float)(viewer->FirstLine / lines_max) * scroll_max) : 0.0f; // Scroll values are rounded
+    SetScrollY(viewer->LastScrollY);
+    EndChild();
+}
+
 //-------------------------------------------------------------------------
 // [SECTION] Widgets: Main
 //-------------------------------------------------------------------------
@@ -4010,6 +4100,88 @@ static ImVec2 InputTextCalcTextSize(ImGuiContext* ctx, const char* text_begin, c
     return text_size;
 }
 
+// Text ending with a '\n' has an extra empty line, which is where the cursor goes after pressing Enter on the last line.
+void ImGuiInputTextLineIndex::Build(const char* text, int text_len)
+{
+    // Reuse the vectorized scan of ImGuiTextIndex, whose LineOffsets[] have the same meaning
+    ImGuiTextIndex index;
+    LineStarts.resize(0);
+    index.LineOffsets.swap(LineStarts);
+    index.append(text, 0, text_len);
+    index.LineOffsets.swap(LineStarts);
+    if (LineStarts.Size == 0)
+        LineStarts.push_back(0);
+    if (text_len > 0 && text[text_len - 1] == '\n')
+        LineStarts.push_back(text_len);
+    StepLine = StepDelta = 0;
+}
+
+int ImGuiInputTextLineIndex::FindLine(int offset) const
+{
+    // Binary search for the last line starting at or before 'offset'
+    int lo = 0;
+    int hi = LineStarts.Size - 1;
+    while (lo < hi)
+    {
+        const int mid = (lo + hi + 1) >> 1;
+        if (GetLineStart(mid) <= offset)
+            lo = mid;
+        else
+            hi = mid - 1;
+    }
+    return lo;
+}
+
+// Apply pending StepDelta to the lines between the current step and 'line', so that lines after 'line' are the ones stored without it.
+void ImGuiInputTextLineIndex::MoveStep(int line)
+{
+    int* starts = LineStarts.Data;
+    if (StepDelta != 0 && line > StepLine)
+        for (int n = StepLine + 1; n <= line; n++)
+            starts[n] += StepDelta;
+    else if (StepDelta != 0 && line < StepLine)
+        for (int n = line + 1; n <= StepLine; n++)
+            starts[n] -= StepDelta;
+    StepLine = line;
+    if (StepLine == LineStarts.Size - 1)
+        StepDelta = 0;
+}
+
+void ImGuiInputTextLineIndex::OnInsertChars(int pos, const char* new_text, int new_text_len)
+{
+    if (!IsValid() || new_text_len <= 0)
+        return;
+    const int line = FindLine(pos);
+    MoveStep(line);
+    StepDelta += new_text_len;
+
+    // Insert a line start after each inserted '\n'
+    int new_lines = 0;
+    const char* new_text_end = new_text + new_text_len;
+    for (const char* p = new_text; (p = (const char*)ImMemchr(p, '\n', new_text_end - p)) != NULL; p++)
+        new_lines++;
+    if (new_lines == 0)
+        return;
+    const int old_size = LineStarts.Size;
+    LineStarts.resize(old_size + new_lines);
+    int* dst = LineStarts.Data + line + 1;
+    memmove(dst + new_lines, dst, (size_t)(old_size - line - 1) * sizeof(int));
+    for (const char* p = new_text; (p = (const char*)ImMemchr(p, '\n', new_text_end - p)) != NULL; )
+        *dst++ = pos + (int)(++p - new_text) - StepDelta;
+}
+
+void ImGuiInputTextLineIndex::OnDeleteChars(int pos, int n)
+{
+    if (!IsValid() || n <= 0)
+        return;
+    const int line = FindLine(pos);
+    const int line_last = FindLine(pos + n); // Lines starting inside the deleted range are removed
+    MoveStep(line);
+    if (line_last > line)
+        LineStarts.erase(LineStarts.Data + line + 1, LineStarts.Data + line_last + 1);
+    StepDelta -= n;
+}
+
 // Wrapper for stb_textedit.h to edit text (our wrapper is for: statically sized buffer, single-line, wchar characters. InputText converts between UTF-8 and wchar)
 // With our UTF-8 use of stb_textedit:
 // - STB_TEXTEDIT_GETCHAR is nothing more than a a "GETBYTE". It's only used to compare to ascii or to copy blocks of text so we are fine.
@@ -4053,6 +4225,29 @@ static int IMSTB_TEXTEDIT_GETPREVCHARINDEX_IMPL(ImGuiInputTextState* obj, int id
     return (int)(p - obj->TextSrc);
 }
 
+// When a line index is available (multi-line), let stb_textedit start its row scanning from the row before the one we are looking for,
+// instead of laying out all rows from the beginning of the text. Rows are lines and all have a height of FontSize.
+#define IMSTB_TEXTEDIT_FINDROWFROMCHAR   IMSTB_TEXTEDIT_FINDROWFROMCHAR_IMPL
+#define IMSTB_TEXTEDIT_FINDROWFROMY      IMSTB_TEXTEDIT_FINDROWFROMY_IMPL
+
+static int IMSTB_TEXTEDIT_FINDROWFROMCHAR_IMPL(ImGuiInputTextState* obj, int idx, float* out_row_y, int* out_prev_row_start)
+{
+    const ImGuiInputTextLineIndex& index = obj->LineIndex;
+    const int line = index.IsValid() ? ImMax(index.FindLine(idx) - 1, 0) : 0;
+    *out_row_y = line * obj->Ctx->FontSize;
+    *out_prev_row_start = (line > 0) ? index.GetLineStart(line - 1) : 0;
+    return (line > 0) ? index.GetLineStart(line) : 0;
+}
+
+static int IMSTB_TEXTEDIT_FINDROWFROMY_IMPL(ImGuiInputTextState* obj, float y, float* out_row_y)
+{
+    const ImGuiInputTextLineIndex& index = obj->LineIndex;
+    const float line_height = obj->Ctx->FontSize;
+    const int line = index.IsValid() ? (int)ImClamp(ImFloor(y / line_height) - 1.0f, 0.0f, (float)(index.GetLineCount() - 1)) : 0;
+    *out_row_y = line * line_height;
+    return (line > 0) ? index.GetLineStart(line) : 0;
+}
+
 static bool ImCharIsSeparatorW(unsigned int c)
 {
     static const unsigned int separator_list[] =
@@ -4136,6 +4331,7 @@ static void STB_TEXTEDIT_DELETECHARS(ImGuiInputTextState* obj, int pos, int n)
     memmove(dst, src, obj->TextLen - n - pos + 1);
     obj->Edited = true;
     obj->TextLen -= n;
+    obj->LineIndex.OnDeleteChars(pos, n);
 }
 
 static bool STB_TEXTEDIT_INSERTCHARS(ImGuiInputTextState* obj, int pos, const char* new_text, int new_text_len)
@@ -4165,6 +4361,7 @@ static bool STB_TEXTEDIT_INSERTCHARS(ImGuiInputTextState* obj, int pos, const ch
     obj->Edited = true;
     obj->TextLen += new_text_len;
     obj->TextA[obj->TextLen] = '\0';
+    obj->LineIndex.OnInsertChars(pos, new_text, new_text_len);
 
     return true;
 }
@@ -4481,6 +4678,20 @@ static void InputTextReconcileUndoState(ImGuiInputTextState* state, const char*
                 p[i] = old_buf[first_diff + i];
 }
 
+// Return offset of the first byte where our text differs from the zero-terminated user buffer, or -1 if they are identical.
+// This lets us only copy modified contents back to the user buffer, and memcmp() over blocks is faster than a byte loop.
+static int InputTextFindFirstDifference(const char* text, int text_len, const char* buf, int buf_size)
+{
+    const int compare_len = ImMin(text_len + 1, buf_size);
+    const int block_size = 4096;
+    for (int block_offset = 0; block_offset < compare_len; block_offset += block_size)
+        if (memcmp(text + block_offset, buf + block_offset, (size_t)ImMin(block_size, compare_len - block_offset)) != 0)
+            for (int n = block_offset; ; n++)
+                if (text[n] != buf[n])
+                    return n;
+    return (compare_len == text_len + 1) ? -1 : 0;
+}
+
 // As InputText() retain textual data and we currently provide a path for user to not retain it (via local variables)
 // we need some form of hook to reapply data back to user buffer on deactivation frame. (#4714)
 // It would be more desirable that we discourage users from taking advantage of the "user not retaining data" trick,
@@ -4636,6 +4847,10 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         state->TextA.resize(buf_size + 1); // we use +1 to make sure that .Data is always pointing to at least an empty string.
         state->TextLen = new_len;
         memcpy(state->TextA.Data, buf, state->TextLen + 1);
+        if (is_multiline && !is_readonly)
+            state->LineIndex.Build(state->TextA.Data, state->TextLen);
+        else
+            state->LineIndex.Clear();
         state->Stb->select_start = state->ReloadSelectionStart;
         state->Stb->cursor = state->Stb->select_end = state->ReloadSelectionEnd;
         state->CursorClamp();
@@ -4671,6 +4886,12 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
             memcpy(state->TextA.Data, buf, state->TextLen + 1);
         }
 
+        // Index lines of multi-line text, so that large texts don't need to be scanned on every edit and every frame.
+        if (is_multiline && !is_readonly)
+            state->LineIndex.Build(state->TextA.Data, state->TextLen);
+        else
+            state->LineIndex.Clear();
+
         // Find initial scroll position for right alignment
         state->Scroll = ImVec2(0.0f, 0.0f);
         if (flags & ImGuiInputTextFlags_ElideLeft)
@@ -5047,6 +5268,7 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
     // Process callbacks and apply result back to user's buffer.
     const char* apply_new_text = NULL;
     int apply_new_text_length = 0;
+    int apply_new_text_offset = 0; // Contents before this offset are known to be identical in user buffer
     if (g.ActiveId == id)
     {
         IM_ASSERT(state != NULL);
@@ -5160,16 +5382,20 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
                         IM_ASSERT(callback_data.BufTextLen == (int)ImStrlen(callback_data.Buf)); // You need to maintain BufTextLen if you change the text!
                         InputTextReconcileUndoState(state, state->CallbackTextBackup.Data, state->CallbackTextBackup.Size - 1, callback_data.Buf, callback_data.BufTextLen);
                         state->TextLen = callback_data.BufTextLen;  // Assume correct length and valid UTF-8 from user, saves us an extra strlen()
+                        if (state->LineIndex.IsValid())
+                            state->LineIndex.Build(state->TextA.Data, state->TextLen);
                         state->CursorAnimReset();
                     }
                 }
             }
 
             // Will copy result string if modified
-            if (!is_readonly && strcmp(state->TextSrc, buf) != 0)
+            const int first_diff = is_readonly ? -1 : InputTextFindFirstDifference(state->TextSrc, state->TextLen, buf, buf_size);
+            if (first_diff != -1)
             {
                 apply_new_text = state->TextSrc;
                 apply_new_text_length = state->TextLen;
+                apply_new_text_offset = first_diff;
                 value_changed = true;
             }
         }
@@ -5206,6 +5432,8 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
             callback_data.BufSize = ImMax(buf_size, apply_new_text_length + 1);
             callback_data.UserData = callback_user_data;
             callback(&callback_data);
+            if (buf != callback_data.Buf)
+                apply_new_text_offset = 0;
             buf = callback_data.Buf;
             buf_size = callback_data.BufSize;
             apply_new_text_length = ImMin(callback_data.BufTextLen, buf_size - 1);
@@ -5214,7 +5442,9 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         //IMGUI_DEBUG_PRINT("InputText(\"%s\"): apply_new_text length %d\n", label, apply_new_text_length);
 
         // If the underlying buffer resize was denied or not carried to the next frame, apply_new_text_length+1 may be >= buf_size.
-        ImStrncpy(buf, apply_new_text, ImMin(apply_new_text_length + 1, buf_size));
+        const int apply_new_text_size = ImMin(apply_new_text_length + 1, buf_size);
+        apply_new_text_offset = ImMin(apply_new_text_offset, apply_new_text_size - 1);
+        ImStrncpy(buf + apply_new_text_offset, apply_new_text + apply_new_text_offset, apply_new_text_size - apply_new_text_offset);
     }
 
     // Release active ID at the end of the function (so e.g. pressing Return still does a final application of the value)
@@ -5274,6 +5504,7 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         // FIXME: This should occur on buf_display but we'd need to maintain cursor/select_start/select_end for UTF-8.
         const char* text_begin = buf_display;
         const char* text_end = text_begin + state->TextLen;
+        const ImGuiInputTextLineIndex* line_index = (is_multiline && buf_display_from_state && !is_displaying_hint && state->LineIndex.IsValid()) ? &state->LineIndex : NULL;
         ImVec2 cursor_offset, select_start_offset;
 
         {
@@ -5285,7 +5516,15 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
 
             // Count lines and find line number for cursor and selection ends
             int line_count = 1;
-            if (is_multiline)
+            if (line_index != NULL)
+            {
+                line_count = line_index->GetLineCount();
+                if (render_cursor)
+                    cursor_line_no = line_index->FindLine(state->Stb->cursor) + 1;
+                if (render_selection)
+                    selmin_line_no = line_index->FindLine(ImMin(state->Stb->select_start, state->Stb->select_end)) + 1;
+            }
+            else if (is_multiline)
             {
                 for (const char* s = text_begin; (s = (const char*)ImMemchr(s, '\n', (size_t)(text_end - s))) != NULL; s++)
                 {
@@ -5363,10 +5602,21 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
             {
                 if (rect_pos.y > clip_rect.w + g.FontSize)
                     break;
-                if (rect_pos.y < clip_rect.y)
+                if (rect_pos.y < clip_rect.y && line_index != NULL)
+                {
+                    // Skip all lines above clipping rectangle at once
+                    const int skip_lines = (int)ImCeil((clip_rect.y - rect_pos.y) / g.FontSize);
+                    const int line_cur = line_index->FindLine((int)(p - text_begin));
+                    const int line_no = ImMin(line_cur + skip_lines, line_index->GetLineCount());
+                    p = (line_no < line_index->GetLineCount()) ? ImMin(text_begin + line_index->GetLineStart(line_no), text_selected_end) : text_selected_end;
+                    rect_pos.x = draw_pos.x - draw_scroll.x;
+                    rect_pos.y += (line_no - line_cur - 1) * g.FontSize; // Advance by lines actually skipped (loop adds the last one)
+                }
+                else if (rect_pos.y < clip_rect.y)
                 {
                     p = (const char*)ImMemchr((void*)p, '\n', text_selected_end - p);
                     p = p ? p + 1 : text_selected_end;
+                    rect_pos.x = draw_pos.x - draw_scroll.x;
                 }
                 else
                 {
@@ -5383,8 +5633,18 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         }
 
         // We test for 'buf_display_max_length' as a way to avoid some pathological cases (e.g. single-line 1 MB string) which would make ImDrawList crash.
-        // FIXME-OPT: Multiline could submit a smaller amount of contents to AddText() since we already iterated through it.
-        if (is_multiline || (buf_display_end - buf_display) < buf_display_max_length)
+        // When we have a line index, only submit visible lines to AddText() (+1 line on each side to be on the safe side of rounding).
+        if (line_index != NULL)
+        {
+            const int line_count = line_index->GetLineCount();
+            const int line_first = (int)ImClamp(ImFloor((clip_rect.y - draw_pos.y) / g.FontSize) - 1.0f, 0.0f, (float)(line_count - 1));
+            const int line_last = (int)ImClamp(ImCeil((clip_rect.w - draw_pos.y) / g.FontSize) + 1.0f, (float)(line_first + 1), (float)line_count);
+            const char* line_first_begin = buf_display + line_index->GetLineStart(line_first);
+            const char* line_last_end = (line_last < line_count) ? buf_display + line_index->GetLineStart(line_last) : buf_display_end;
+            ImU32 col = GetColorU32(ImGuiCol_Text);
+            draw_window->DrawList->AddText(g.Font, g.FontSize, draw_pos - draw_scroll + ImVec2(0.0f, line_first * g.FontSize), col, line_first_begin, line_last_end);
+        }
+        else if (is_multiline || (buf_display_end - buf_display) < buf_display_max_length)
         {
             ImU32 col = GetColorU32(is_displaying_hint ? ImGuiCol_TextDisabled : ImGuiCol_Text);
             draw_window->DrawList->AddText(g.Font, g.FontSize, draw_pos - draw_scroll, col, buf_display, buf_display_end, 0.0f, is_multiline ? NULL : &clip_rect);
@@ -5491,6 +5751,7 @@ void ImGui::DebugNodeInputTextState(ImGuiInputTextState* state)
     Text("CurLenA: %d, Cursor: %d, Selection: %d..%d", state->TextLen, stb_state->cursor, stb_state->select_start, stb_state->select_end);
     Text("BufCapacity: %d", state->BufCapacity);
     Text("(Internal Buffer: TextA Size: %d, Capacity: %d)", state->TextA.Size, state->TextA.Capacity);
+    Text("LineIndex: %d lines, StepLine: %d, StepDelta: %d", state->LineIndex.GetLineCount(), state->LineIndex.StepLine, state->LineIndex.StepDelta);
     Text("has_preferred_x: %d (%.2f)", stb_state->has_preferred_x, stb_state->preferred_x);
     Text("undo_point: %d, redo_point: %d, undo_char_point: %d, redo_char_point: %d", undo_state->undo_point, undo_state->redo_point, undo_state->undo_char_point, undo_state->redo_char_point);
     if (BeginChild("undopoints", ImVec2(0.0f, GetTextLineHeight() * 10), ImGuiChildFlags_Borders | ImGuiChildFlags_ResizeY)) // Visualize undo state
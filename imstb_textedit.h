@@ -5,6 +5,7 @@
 // - Fix in stb_textedit_find_charpos to handle last line (see https://github.com/ocornut/imgui/issues/6000 + #6783)
 // - Added name to struct or it may be forward declared in our code.
 // - Added UTF-8 support (see https://github.com/nothings/stb/issues/188 + https://github.com/ocornut/imgui/pull/7925)
+// - Added optional IMSTB_TEXTEDIT_FINDROWFROMCHAR/IMSTB_TEXTEDIT_FINDROWFROMY to skip laying out all rows from the start of large texts.
 // Grep for [DEAR IMGUI] to find the changes.
 // - Also renamed macros used or defined outside of IMSTB_TEXTEDIT_IMPLEMENTATION block from STB_TEXTEDIT_* to IMSTB_TEXTEDIT_*
 
@@ -421,6 +422,17 @@ typedef struct
 #define IMSTB_TEXTEDIT_GETNEXTCHARINDEX(OBJ, IDX) ((IDX) + 1)
 #endif
 
+// [DEAR IMGUI]
+// Optional functions to find a starting row for the row searches in stb_textedit_find_charpos() and stb_text_locate_coord(),
+// e.g. using a line index. They must return the start of a row located before the row containing character IDX or position Y
+// (returning 0 for the first row is always valid), output its Y position, and for the first one the start of the row before it.
+#ifndef IMSTB_TEXTEDIT_FINDROWFROMCHAR
+#define IMSTB_TEXTEDIT_FINDROWFROMCHAR(OBJ, IDX, OUT_ROW_Y, OUT_PREV_ROW_START) (*(OUT_ROW_Y) = 0, *(OUT_PREV_ROW_START) = 0, 0)
+#endif
+#ifndef IMSTB_TEXTEDIT_FINDROWFROMY
+#define IMSTB_TEXTEDIT_FINDROWFROMY(OBJ, Y, OUT_ROW_Y) (*(OUT_ROW_Y) = 0, 0)
+#endif
+
 /////////////////////////////////////////////////////////////////////////////
 //
 //      Mouse input handling
@@ -437,6 +449,7 @@ static int stb_text_locate_coord(IMSTB_TEXTEDIT_STRING *str, float x, float y)
    r.x0 = r.x1 = 0;
    r.ymin = r.ymax = 0;
    r.num_chars = 0;
+   i = IMSTB_TEXTEDIT_FINDROWFROMY(str, y, &base_y); // [DEAR IMGUI]
 
    // search rows to find one that straddles 'y'
    while (i < n) {
@@ -567,6 +580,7 @@ static void stb_textedit_find_charpos(StbFindState *find, IMSTB_TEXTEDIT_STRING
 
    // search rows to find the one that straddles character n
    find->y = 0;
+   i = IMSTB_TEXTEDIT_FINDROWFROMCHAR(str, n, &find->y, &prev_start); // [DEAR IMGUI]
 
    for(;;) {
       STB_TEXTEDIT_LAYOUTROW(&r, str, i);
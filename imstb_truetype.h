@@ -1124,6 +1124,10 @@ typedef int stbtt__test_oversample_pow2[(STBTT_MAX_OVERSAMPLE & (STBTT_MAX_OVERS
 #define STBTT_RASTERIZER_VERSION 2
 #endif
 
+#ifdef STBTT_SSE2 // [DEAR IMGUI] Optional SSE2 scanline accumulation, see stbtt__accumulate_scanline_sse2()
+#include <emmintrin.h>
+#endif
+
 #ifdef _MSC_VER
 #define STBTT__NOTUSED(v)  (void)(v)
 #else
@@ -3302,6 +3306,47 @@ static void stbtt__fill_active_edges_new(float *scanline, float *scanline_fill,
 }
 
 // directly AA rasterize edges w/o supersampling
+#ifdef STBTT_SSE2
+// [DEAR IMGUI] SSE2 version of the coverage accumulation at the end of each scanline, 8 pixels at a time.
+// The running sum of scanline2[] is still added in the same order as the scalar loop (and is a plain
+// broadcast when a block has no fill contributions, which is the common case), so output is bit-identical.
+// Returns the number of pixels written; the caller finishes the remaining ones with the scalar loop.
+static int stbtt__accumulate_scanline_sse2(unsigned char *out, const float *scanline, const float *fill, int len, float *p_sum)
+{
+   const __m128 sign_mask = _mm_castsi128_ps(_mm_set1_epi32(0x80000000));
+   const __m128 scale = _mm_set1_ps(255.0f);
+   const __m128 bias = _mm_set1_ps(0.5f);
+   const __m128 clamp = _mm_set1_ps(255.0f);
+   const __m128 zero = _mm_setzero_ps();
+   float sum = *p_sum;
+   int i;
+   for (i = 0; i + 8 <= len; i += 8) {
+      __m128i m[2];
+      int half;
+      for (half = 0; half < 2; ++half) {
+         const int base = i + half * 4;
+         __m128 sums, k;
+         if (_mm_movemask_ps(_mm_cmpneq_ps(_mm_loadu_ps(fill + base), zero)) == 0) {
+            sums = _mm_set1_ps(sum);
+         } else {
+            float s[4];
+            s[0] = sum += fill[base + 0];
+            s[1] = sum += fill[base + 1];
+            s[2] = sum += fill[base + 2];
+            s[3] = sum += fill[base + 3];
+            sums = _mm_loadu_ps(s);
+         }
+         k = _mm_add_ps(_mm_loadu_ps(scanline + base), sums);
+         k = _mm_add_ps(_mm_mul_ps(_mm_andnot_ps(sign_mask, k), scale), bias);
+         m[half] = _mm_cvttps_epi32(_mm_min_ps(k, clamp));
+      }
+      _mm_storel_epi64((__m128i *) (out + i), _mm_packus_epi16(_mm_packs_epi32(m[0], m[1]), _mm_setzero_si128()));
+   }
+   *p_sum = sum;
+   return i;
+}
+#endif
+
 static void stbtt__rasterize_sorted_edges(stbtt__bitmap *result, stbtt__edge *e, int n, int vsubsample, int off_x, int off_y, void *userdata)
 {
    stbtt__hheap hh = { 0, 0, 0 };
@@ -3370,7 +3415,11 @@ static void stbtt__rasterize_sorted_edges(stbtt__bitmap *result, stbtt__edge *e,
 
       {
          float sum = 0;
-         for (i=0; i < result->w; ++i) {
+         i = 0;
+         #ifdef STBTT_SSE2
+         i = stbtt__accumulate_scanline_sse2(result->pixels + j*result->stride, scanline, scanline2, result->w, &sum); // [DEAR IMGUI]
+         #endif
+         for (; i < result->w; ++i) {
             float k;
             int m;
             sum += scanline2[i];